@@ -1,12 +1,13 @@
 #pragma once
 #include "Entity/GameObject.h"
+#include "System/Memory/SlabPool.h"
 
 namespace SimpleGame {
 
 /**
  * @brief Experience Gem dropped by monsters.
  */
-class ExpGem : public GameObject
+class ExpGem : public GameObject, public ::System::SlabPooled<ExpGem>
 {
 public:
     ExpGem(int32_t id, int32_t expAmount) : GameObject(id, Protocol::ObjectType::ITEM), _expAmount(expAmount)
@@ -27,9 +28,19 @@ public:
         _vx = _vy = 0.0f;
     }
 
+    void Reset() override
+    {
+        GameObject::Reset();
+        _expAmount = 0;
+        _isPickedUp = false;
+        _pickerId = 0;
+    }
+
     virtual void ReturnToPool() override
     {
-        // ExpGems belong to ObjectManager or pool. To be handled via factory.
+        // Room slab (ObjectManager::GetExpGemPool); standalone gems are plain heap objects
+        if (!ReturnToSlab())
+            delete this;
     }
 
     int32_t GetExpAmount() const
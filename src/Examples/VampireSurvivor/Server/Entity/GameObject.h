@@ -10,7 +10,9 @@ namespace SimpleGame {
 
 class Room; // Forward declaration
 
-class GameObject : public System::RefCounted<GameObject>
+// [RefCount] Room-owned entities are confined to the room strand -> non-atomic counting.
+// Types referenced from other threads opt out per instance with ShareAcrossThreads() (see Player).
+class GameObject : public System::RefCounted<GameObject, System::StrandLocalRefCount>
 {
 public:
     GameObject(int32_t id, Protocol::ObjectType type) : _id(id), _type(type)
@@ -23,7 +23,9 @@ Monster::Monster() : GameObject(0, Protocol::ObjectType::MONSTER)
 
 void Monster::ReturnToPool()
 {
-    MonsterFactory::Instance().Release(const_cast<Monster *>(this));
+    // Slab slot of the owning room; directly constructed monsters (tests/tools) are plain heap objects
+    if (!ReturnToSlab())
+        delete this;
 }
 
 void Monster::SetMovementStrategy(std::shared_ptr<IMovementStrategy> strategy)
@@ -65,6 +67,7 @@ void Monster::TakeDamage(int32_t damage, Room *room)
     _hp -= damage;
 
     // [HP 동기화] 모든 클라이언트에게 몬스터 HP 변경 알림
+    // 몬스터 HP 바는 표시용 (사망은 Despawn 으로 전달) -> 메모리 압박 시 생략 가능
     if (room != nullptr)
     {
         Protocol::S_HpChange hpMsg;
@@ -72,7 +75,7 @@ void Monster::TakeDamage(int32_t damage, Room *room)
         hpMsg.set_current_hp(static_cast<float>(_hp));
         hpMsg.set_max_hp(static_cast<float>(_maxHp));
 
-        room->BroadcastPacket(S_HpChangePacket(std::move(hpMsg)));
+        room->BroadcastPacket(S_HpChangePacket(std::move(hpMsg)), 0, System::AllocPriority::Optional);
     }
 
     if (_hp <= 0)
@@ -83,8 +86,8 @@ void Monster::TakeDamage(int32_t damage, Room *room)
         // [Unified Gem Drop] 모든 대미지 원인에 대해 사망 시 젬 스폰
         if (room != nullptr)
         {
-            auto gem = ::System::RefPtr<ExpGem>(new ExpGem(room->GetObjectManager().GenerateId(), 10));
-            gem->Initialize(gem->GetId(), _x, _y, 10);
+            auto gem = room->GetObjectManager().GetExpGemPool().Pop();
+            gem->Initialize(room->GetObjectManager().GenerateId(), _x, _y, 10);
 
             room->GetObjectManager().AddObject(gem);
 
@@ -2,6 +2,7 @@
 #include "AI/IAIBehavior.h"
 #include "Entity/GameObject.h"
 #include "Game/GameConfig.h"
+#include "System/Memory/SlabPool.h"
 #include <memory>
 
 namespace SimpleGame {
@@ -10,7 +11,7 @@ class IAIBehavior;
 class Room;
 class IMovementStrategy;
 
-class Monster : public GameObject
+class Monster : public GameObject, public ::System::SlabPooled<Monster>
 {
 public:
     Monster(int32_t id, int32_t monsterTypeId);
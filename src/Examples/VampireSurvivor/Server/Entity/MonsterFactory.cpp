@@ -20,8 +20,6 @@ MonsterFactory &MonsterFactory::Instance()
 
 MonsterFactory::MonsterFactory()
 {
-    _pool = std::make_unique<::System::LockFreeObjectPool<Monster>>();
-    _pool->Init(0, 1000);
 }
 
 ::System::RefPtr<Monster>
@@ -36,13 +34,8 @@ MonsterFactory::CreateMonster(ObjectManager &objMgr, int32_t monsterTypeId, floa
 
     int32_t finalHp = (hpOverride > 0) ? hpOverride : tmpl->hp;
 
-    // Acquire from pool or alloc
-    ::System::RefPtr<Monster> monster = _pool->Pop();
-    if (!monster)
-    {
-        // Should not happen with current SimplePool unless alloc limit reached
-        return nullptr;
-    }
+    // Acquire from the room's slab (reused slot or new slot in the current chunk)
+    ::System::RefPtr<Monster> monster = objMgr.GetMonsterPool().Pop();
 
     int32_t id = objMgr.GenerateId();
 
@@ -84,16 +77,6 @@ std::vector<::System::RefPtr<Monster>> MonsterFactory::SpawnBatch(
     return monsters;
 }
 
-void MonsterFactory::Release(Monster *monster)
-{
-    if (monster)
-    {
-        // lock-free object pool actually calls Reset() in Pop(), but it's okay.
-        // monster->Reset(); // We can omit this per LockFreeObjectPool's design.
-        _pool->Push(monster);
-    }
-}
-
 std::unique_ptr<IAIBehavior> MonsterFactory::CreateAI(MonsterAIType type, float speed)
 {
     switch (type)
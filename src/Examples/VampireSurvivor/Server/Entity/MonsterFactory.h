@@ -1,7 +1,6 @@
 #pragma once
 #include "Entity/Monster.h"
 #include "Entity/MonsterAIType.h"
-#include "System/Memory/LockFreeObjectPool.h"
 #include "System/Memory/RefPtr.h"
 #include <vector>
 
@@ -13,7 +12,8 @@ class IAIBehavior;
 /**
  * @brief Factory for creating monsters with appropriate AI.
  *
- * Uses object pooling via IObjectPool interface.
+ * Monsters come from the room's typed slab pool (ObjectManager::GetMonsterPool),
+ * so one room's monsters sit contiguously in memory.
  */
 class MonsterFactory
 {
@@ -33,11 +33,6 @@ public:
     std::vector<::System::RefPtr<Monster>>
     SpawnBatch(ObjectManager &objMgr, int32_t monsterTypeId, int count, float minX, float maxX, float minY, float maxY);
 
-    /**
-     * @brief Release a monster back to the pool.
-     */
-    void Release(Monster *monster);
-
 private:
     MonsterFactory();
     ~MonsterFactory() = default;
@@ -50,8 +45,6 @@ private:
      * @brief Create AI behavior based on type.
      */
     std::unique_ptr<IAIBehavior> CreateAI(MonsterAIType type, float speed);
-
-    std::unique_ptr<::System::LockFreeObjectPool<Monster>> _pool;
 };
 
 } // namespace SimpleGame
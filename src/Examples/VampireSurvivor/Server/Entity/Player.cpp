@@ -15,11 +15,14 @@ namespace SimpleGame {
 Player::Player(int32_t gameId, uint64_t sessionId)
     : GameObject(gameId, Protocol::ObjectType::PLAYER), _sessionId(sessionId)
 {
+    // Also held by RoomManager / packet handlers on other threads
+    ShareAcrossThreads();
     _inventory = std::make_unique<PlayerInventory>();
 }
 
 Player::Player() : GameObject(0, Protocol::ObjectType::PLAYER), _sessionId(0)
 {
+    ShareAcrossThreads();
     _inventory = std::make_unique<PlayerInventory>();
 }
 
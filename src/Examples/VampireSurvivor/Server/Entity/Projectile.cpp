@@ -7,7 +7,8 @@ namespace SimpleGame {
 
 void Projectile::ReturnToPool()
 {
-    ProjectileFactory::Instance().Release(const_cast<Projectile *>(this));
+    if (!ReturnToSlab())
+        delete this;
 }
 
 void Projectile::Update(float dt, Room *room)
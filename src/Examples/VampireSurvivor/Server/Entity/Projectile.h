@@ -1,9 +1,10 @@
 #pragma once
 #include "Entity/GameObject.h"
+#include "System/Memory/SlabPool.h"
 
 namespace SimpleGame {
 
-class Projectile : public GameObject
+class Projectile : public GameObject, public ::System::SlabPooled<Projectile>
 {
 public:
     Projectile(int32_t id, int32_t ownerId, int32_t skillId)
@@ -12,7 +12,6 @@ ProjectileFactory &ProjectileFactory::Instance()
 
 ProjectileFactory::ProjectileFactory()
 {
-    _pool.Init(0, 20000);
 }
 
 ::System::RefPtr<Projectile> ProjectileFactory::CreateProjectile(
@@ -20,9 +19,7 @@ ProjectileFactory::ProjectileFactory()
     int32_t damage, float lifetime
 )
 {
-    ::System::RefPtr<Projectile> proj = _pool.Pop();
-    if (!proj)
-        return nullptr;
+    ::System::RefPtr<Projectile> proj = objMgr.GetProjectilePool().Pop();
 
     int32_t id = objMgr.GenerateId();
     proj->Initialize(id, ownerId, skillId, typeId);
@@ -34,12 +31,4 @@ ProjectileFactory::ProjectileFactory()
     return proj;
 }
 
-void ProjectileFactory::Release(Projectile *proj)
-{
-    if (proj)
-    {
-        _pool.Push(proj);
-    }
-}
-
 } // namespace SimpleGame
@@ -1,6 +1,5 @@
 #pragma once
 #include "Entity/Projectile.h"
-#include "System/Memory/LockFreeObjectPool.h"
 #include "System/Memory/RefPtr.h"
 
 namespace SimpleGame {
@@ -8,7 +7,7 @@ namespace SimpleGame {
 class ObjectManager;
 
 /**
- * @brief Factory for creating Projectiles with pooling.
+ * @brief Factory for creating Projectiles (pooled in the room's slab, ObjectManager::GetProjectilePool).
  */
 class ProjectileFactory
 {
@@ -19,13 +18,10 @@ public:
         ObjectManager &objMgr, int32_t ownerId, int32_t skillId, int32_t typeId, float x, float y, float vx, float vy,
         int32_t damage, float lifetime
     );
-    void Release(Projectile *proj);
 
 private:
     ProjectileFactory();
     ~ProjectileFactory() = default;
-
-    ::System::LockFreeObjectPool<Projectile> _pool;
 };
 
 } // namespace SimpleGame
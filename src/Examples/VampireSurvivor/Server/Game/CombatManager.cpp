@@ -36,45 +36,39 @@ void CombatManager::Update(float dt, Room *room)
 void CombatManager::ResolveCleanup(Room *room)
 {
     // Handle all cleanup (projectiles, monsters, items, etc.)
-    auto objects = room->_objMgr.GetAllObjects();
-    std::vector<int32_t> despawnIds;
-    std::vector<int32_t> pickerIds;
+    // [Slab] Dense per-type scan, removal after the scan (the last release frees the slot)
+    std::pmr::vector<int32_t> despawnIds(&room->_frameArena);
+    std::pmr::vector<int32_t> pickerIds(&room->_frameArena);
+    auto &objMgr = room->_objMgr;
 
-    for (auto &obj : objects)
+    for (Projectile &proj : objMgr.GetProjectilePool())
     {
-        bool shouldRemove = false;
-        int32_t pickerId = 0;
-
-        if (obj->GetType() == Protocol::ObjectType::PROJECTILE)
+        if (proj.IsExpired() && objMgr.GetObject(proj.GetId()))
         {
-            auto proj = ::System::RefPtr<Projectile>(static_cast<Projectile *>(obj.get()));
-            if (proj->IsExpired())
-                shouldRemove = true;
+            despawnIds.push_back(proj.GetId());
+            pickerIds.push_back(0);
         }
-        if (obj->GetType() == Protocol::ObjectType::MONSTER)
+    }
+    for (Monster &monster : objMgr.GetMonsterPool())
+    {
+        if (monster.IsDead() && objMgr.GetObject(monster.GetId()))
         {
-
-            auto monster = ::System::RefPtr<Monster>(static_cast<Monster *>(obj.get()));
-            if (monster->IsDead())
-                shouldRemove = true;
+            despawnIds.push_back(monster.GetId());
+            pickerIds.push_back(0);
         }
-        else if (obj->GetType() == Protocol::ObjectType::ITEM)
+    }
+    for (ExpGem &gem : objMgr.GetExpGemPool())
+    {
+        if (gem.IsPickedUp() && objMgr.GetObject(gem.GetId()))
         {
-            auto gem = ::System::RefPtr<ExpGem>(static_cast<ExpGem *>(obj.get()));
-            if (gem->IsPickedUp())
-            {
-                shouldRemove = true;
-                pickerId = gem->GetPickerId();
-            }
+            despawnIds.push_back(gem.GetId());
+            pickerIds.push_back(gem.GetPickerId());
         }
+    }
 
-        if (shouldRemove)
-        {
-            despawnIds.push_back(obj->GetId());
-            pickerIds.push_back(pickerId);
-
-            room->_objMgr.RemoveObject(obj->GetId());
-        }
+    for (int32_t id : despawnIds)
+    {
+        objMgr.RemoveObject(id);
     }
 
     if (!despawnIds.empty())
@@ -85,159 +79,156 @@ void CombatManager::ResolveCleanup(Room *room)
 
 void CombatManager::ResolveProjectileCollisions(float dt, Room *room)
 {
-    auto objects = room->_objMgr.GetAllObjects();
     Protocol::S_DamageEffect damageEffect;
 
-    for (auto &obj : objects)
+    // [Slab] Projectiles only, contiguous
+    for (Projectile &projRef : room->_objMgr.GetProjectilePool())
     {
-        if (obj->GetType() == Protocol::ObjectType::PROJECTILE)
+        Projectile *proj = &projRef;
+        if (proj->IsExpired())
+            continue;
+
+        // [Optimization] Increase query radius for fast-moving projectiles
+        room->_queryBuffer.clear();
+        room->_grid.Query(proj->GetX(), proj->GetY(), proj->GetRadius() + 1.5f, room->_queryBuffer, room->_objMgr);
+
+        // Use GameObject (Single Path)
+        for (auto &target : room->_queryBuffer)
         {
-            auto proj = (Projectile *)obj.get();
             if (proj->IsExpired())
+                break;
+
+            if (target->GetId() == proj->GetId())
                 continue;
 
-            // [Optimization] Increase query radius for fast-moving projectiles
-            room->_queryBuffer.clear();
-            room->_grid.Query(proj->GetX(), proj->GetY(), proj->GetRadius() + 1.5f, room->_queryBuffer, room->_objMgr);
+            // Projectiles never hit any player (self or others)
+            if (target->GetType() == Protocol::ObjectType::PLAYER)
+                continue;
 
-            // Use GameObject (Single Path)
-            for (auto &target : room->_queryBuffer)
+            if (target->GetType() == Protocol::ObjectType::MONSTER)
             {
-                if (proj->IsExpired())
-                    break;
-
-                if (target->GetId() == proj->GetId())
+                auto monster = ::System::RefPtr<Monster>(static_cast<Monster *>(target.get()));
+                if (monster->IsDead())
                     continue;
 
-                // Projectiles never hit any player (self or others)
-                if (target->GetType() == Protocol::ObjectType::PLAYER)
-                    continue;
+                float dx = proj->GetX() - monster->GetX();
+                float dy = proj->GetY() - monster->GetY();
+                float distSq = dx * dx + dy * dy;
+                float sumRad = proj->GetRadius() + monster->GetRadius();
 
-                if (target->GetType() == Protocol::ObjectType::MONSTER)
+                // [Precision] Using a slight margin for hit detection stability
+                if (distSq <= (sumRad + 0.1f) * (sumRad + 0.1f))
                 {
-                    auto monster = ::System::RefPtr<Monster>(static_cast<Monster *>(target.get()));
-                    if (monster->IsDead())
+                    // [Fix] Check if already hit this target (prevent piercing projectile from hitting same target
+                    // repeatedly)
+                    if (proj->HasHit(monster->GetId()))
                         continue;
 
-                    float dx = proj->GetX() - monster->GetX();
-                    float dy = proj->GetY() - monster->GetY();
-                    float distSq = dx * dx + dy * dy;
-                    float sumRad = proj->GetRadius() + monster->GetRadius();
+                    // [Critical Hit] Check for critical hit
+                    bool isCritical = false;
+                    float critMultiplier = 1.0f;
+                    float additionalCritChance = 0.0f;
 
-                    // [Precision] Using a slight margin for hit detection stability
-                    if (distSq <= (sumRad + 0.1f) * (sumRad + 0.1f))
+                    // Get projectile owner (player)
+                    auto ownerObj = room->GetObjectManager().GetObject(proj->GetOwnerId());
+                    if (ownerObj && ownerObj->GetType() == Protocol::ObjectType::PLAYER)
                     {
-                        // [Fix] Check if already hit this target (prevent piercing projectile from hitting same target
-                        // repeatedly)
-                        if (proj->HasHit(monster->GetId()))
-                            continue;
-
-                        // [Critical Hit] Check for critical hit
-                        bool isCritical = false;
-                        float critMultiplier = 1.0f;
-                        float additionalCritChance = 0.0f;
-
-                        // Get projectile owner (player)
-                        auto ownerObj = room->GetObjectManager().GetObject(proj->GetOwnerId());
-                        if (ownerObj && ownerObj->GetType() == Protocol::ObjectType::PLAYER)
-                        {
-                            auto player = ::System::RefPtr<Player>(static_cast<Player *>(ownerObj.get()));
-                            float baseCritChance = player->GetCriticalChance();
+                        auto player = ::System::RefPtr<Player>(static_cast<Player *>(ownerObj.get()));
+                        float baseCritChance = player->GetCriticalChance();
 
-                            // Find weapon level info to add crit modifiers
-                            int32_t skillId = proj->GetSkillId();
-                            const auto &allWeapons = DataManager::Instance().GetAllWeapons();
-                            for (const auto &weaponPair : allWeapons)
+                        // Find weapon level info to add crit modifiers
+                        int32_t skillId = proj->GetSkillId();
+                        const auto &allWeapons = DataManager::Instance().GetAllWeapons();
+                        for (const auto &weaponPair : allWeapons)
+                        {
+                            const auto &weapon = weaponPair.second;
+                            for (const auto &levelInfo : weapon.levels)
                             {
-                                const auto &weapon = weaponPair.second;
-                                for (const auto &levelInfo : weapon.levels)
+                                if (levelInfo.skillId == skillId)
                                 {
-                                    if (levelInfo.skillId == skillId)
+                                    int32_t playerWeaponLevel = player->GetInventory().GetWeaponLevel(weapon.id);
+                                    if (playerWeaponLevel > 0 &&
+                                        playerWeaponLevel <= static_cast<int32_t>(weapon.levels.size()))
                                     {
-                                        int32_t playerWeaponLevel = player->GetInventory().GetWeaponLevel(weapon.id);
-                                        if (playerWeaponLevel > 0 &&
-                                            playerWeaponLevel <= static_cast<int32_t>(weapon.levels.size()))
-                                        {
-                                            const auto &levelData = weapon.levels[playerWeaponLevel - 1];
-                                            additionalCritChance = levelData.critChance;
-                                            critMultiplier *= levelData.critDamageMult;
-                                        }
-                                        break;
+                                        const auto &levelData = weapon.levels[playerWeaponLevel - 1];
+                                        additionalCritChance = levelData.critChance;
+                                        critMultiplier *= levelData.critDamageMult;
                                     }
+                                    break;
                                 }
                             }
+                        }
 
-                            float totalCritChance = baseCritChance + additionalCritChance;
+                        float totalCritChance = baseCritChance + additionalCritChance;
 
-                            // Random critical check using FastRandom
-                            static thread_local System::Utility::FastRandom rng;
-                            if (rng.NextFloat() < totalCritChance)
-                            {
-                                isCritical = true;
-                                critMultiplier *= player->GetCriticalDamageMultiplier();
-                            }
+                        // Random critical check using FastRandom
+                        static thread_local System::Utility::FastRandom rng;
+                        if (rng.NextFloat() < totalCritChance)
+                        {
+                            isCritical = true;
+                            critMultiplier *= player->GetCriticalDamageMultiplier();
                         }
+                    }
 
-                        // [Fix Damage Decay] Calculate damage based on hit index (not remaining pierce count)
-                        // Each hit reduces damage by 10% - monotonic decay (never increases)
-                        int32_t baseDamage = proj->GetDamage();
-                        int32_t hitIndex = proj->GetHitCount();
-                        int32_t actualDamage =
-                            static_cast<int32_t>(baseDamage * std::pow(0.9f, hitIndex) * critMultiplier);
-
-                        // [Apply Effects] Check skill info for effects
-                        int32_t skillId = proj->GetSkillId();
-                        const auto *skillInfo = DataManager::Instance().GetSkillInfo(skillId);
-                        if (skillInfo && !skillInfo->effectType.empty())
+                    // [Fix Damage Decay] Calculate damage based on hit index (not remaining pierce count)
+                    // Each hit reduces damage by 10% - monotonic decay (never increases)
+                    int32_t baseDamage = proj->GetDamage();
+                    int32_t hitIndex = proj->GetHitCount();
+                    int32_t actualDamage =
+                        static_cast<int32_t>(baseDamage * std::pow(0.9f, hitIndex) * critMultiplier);
+
+                    // [Apply Effects] Check skill info for effects
+                    int32_t skillId = proj->GetSkillId();
+                    const auto *skillInfo = DataManager::Instance().GetSkillInfo(skillId);
+                    if (skillInfo && !skillInfo->effectType.empty())
+                    {
+                        Effect::Type effectType;
+                        if (skillInfo->effectType == "POISON")
+                            effectType = Effect::Type::POISON;
+                        else if (skillInfo->effectType == "BURN")
+                            effectType = Effect::Type::BURN;
+                        else if (skillInfo->effectType == "SLOW")
+                            effectType = Effect::Type::SLOW;
+                        else
+                            effectType = Effect::Type::POISON;
+
+                        if (effectType == Effect::Type::SLOW)
                         {
-                            Effect::Type effectType;
-                            if (skillInfo->effectType == "POISON")
-                                effectType = Effect::Type::POISON;
-                            else if (skillInfo->effectType == "BURN")
-                                effectType = Effect::Type::BURN;
-                            else if (skillInfo->effectType == "SLOW")
-                                effectType = Effect::Type::SLOW;
-                            else
-                                effectType = Effect::Type::POISON;
-
-                            if (effectType == Effect::Type::SLOW)
-                            {
-                                monster->AddStatusEffect(
-                                    "SLOW", skillInfo->effectValue, skillInfo->effectDuration, room->_totalRunTime
-                                );
-                            }
-                            else
-                            {
-                                Effect::StatusEffect effect;
-                                effect.type = effectType;
-                                effect.sourceId = proj->GetOwnerId();
-                                effect.endTime = room->_totalRunTime + skillInfo->effectDuration;
-                                effect.tickInterval =
-                                    skillInfo->effectInterval > 0.0f ? skillInfo->effectInterval : 0.5f;
-                                effect.lastTickTime = room->_totalRunTime;
-                                effect.value = skillInfo->effectValue;
-                                room->GetEffectManager().ApplyEffect(monster->GetId(), effect);
-                            }
+                            monster->AddStatusEffect(
+                                "SLOW", skillInfo->effectValue, skillInfo->effectDuration, room->_totalRunTime
+                            );
                         }
+                        else
+                        {
+                            Effect::StatusEffect effect;
+                            effect.type = effectType;
+                            effect.sourceId = proj->GetOwnerId();
+                            effect.endTime = room->_totalRunTime + skillInfo->effectDuration;
+                            effect.tickInterval =
+                                skillInfo->effectInterval > 0.0f ? skillInfo->effectInterval : 0.5f;
+                            effect.lastTickTime = room->_totalRunTime;
+                            effect.value = skillInfo->effectValue;
+                            room->GetEffectManager().ApplyEffect(monster->GetId(), effect);
+                        }
+                    }
 
-                        monster->TakeDamage(actualDamage, room);
-                        proj->AddHit(monster->GetId());
+                    monster->TakeDamage(actualDamage, room);
+                    proj->AddHit(monster->GetId());
 
-                        bool consumed = proj->OnHit();
+                    bool consumed = proj->OnHit();
 
-                        damageEffect.add_target_ids(monster->GetId());
-                        damageEffect.add_damage_values(actualDamage);
-                        damageEffect.add_is_critical(isCritical);
+                    damageEffect.add_target_ids(monster->GetId());
+                    damageEffect.add_damage_values(actualDamage);
+                    damageEffect.add_is_critical(isCritical);
 
-                        if (monster->IsDead())
-                        {
-                            // 몬스터 사망 시 처리는 이제 monster->TakeDamage(room) 내부에서 통합 관리됨
-                        }
+                    if (monster->IsDead())
+                    {
+                        // 몬스터 사망 시 처리는 이제 monster->TakeDamage(room) 내부에서 통합 관리됨
+                    }
 
-                        if (consumed)
-                        {
-                            break; // Projectile consumed, stop checking targets
-                        }
+                    if (consumed)
+                    {
+                        break; // Projectile consumed, stop checking targets
                     }
                 }
             }
@@ -263,16 +254,11 @@ void CombatManager::ResolveBodyCollisions(float dt, Room *room)
 
 void CombatManager::CollectAttackEvents(Room *room, std::vector<AttackEvent> &outEvents)
 {
-    // Single Path (GameObject)
-    auto objects = room->_objMgr.GetAllObjects();
-
-    for (auto &obj : objects)
+    // [Slab] Monsters only, contiguous (borrowed: nothing is removed during collection)
+    for (Monster &monsterRef : room->_objMgr.GetMonsterPool())
     {
-        if (obj->GetType() != Protocol::ObjectType::MONSTER)
-            continue;
-
-        auto monster = ::System::RefPtr<Monster>(static_cast<Monster *>(obj.get()));
-        if (!monster || monster->IsDead())
+        Monster *monster = &monsterRef;
+        if (monster->IsDead())
             continue;
 
         for (auto &playerPair : room->_players)
@@ -358,14 +344,10 @@ void CombatManager::ExecuteAttackEvents(Room *room, const std::vector<AttackEven
 
 void CombatManager::ResolveItemCollisions(float dt, Room *room)
 {
-    auto objects = room->_objMgr.GetAllObjects();
-
-    for (auto &obj : objects)
+    // [Slab] ExpGems only, contiguous
+    for (ExpGem &gemRef : room->_objMgr.GetExpGemPool())
     {
-        if (obj->GetType() != Protocol::ObjectType::ITEM)
-            continue;
-
-        auto gem = ::System::RefPtr<ExpGem>(static_cast<ExpGem *>(obj.get()));
+        ExpGem *gem = &gemRef;
         if (gem->IsPickedUp())
             continue;
 
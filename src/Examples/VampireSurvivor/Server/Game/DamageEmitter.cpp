@@ -172,8 +172,8 @@ void DamageEmitter::Update(float dt, Room *room)
 
                 // Use GetMonstersInRange (Single Path)
                 auto victims = room->GetMonstersInRange(px, py, finalRadius);
-                std::vector<int32_t> hitTargetIds;
-                std::vector<int32_t> hitDamageValues;
+                std::pmr::vector<int32_t> hitTargetIds(&room->GetFrameArena());
+                std::pmr::vector<int32_t> hitDamageValues(&room->GetFrameArena());
 
                 const auto *tmpl = DataManager::Instance().GetSkillInfo(_skillId);
 
@@ -359,8 +359,8 @@ void DamageEmitter::Update(float dt, Room *room)
                 int32_t shotCount = 1 + additionalProjectiles;
                 if (levelData && levelData->maxTargets > 0)
                     shotCount = levelData->maxTargets;
-                std::vector<int32_t> hitIds;
-                std::vector<int32_t> hitDamages;
+                std::pmr::vector<int32_t> hitIds(&room->GetFrameArena());
+                std::pmr::vector<int32_t> hitDamages(&room->GetFrameArena());
 
                 std::shuffle(monsters.begin(), monsters.end(), std::mt19937(std::random_device()()));
 
@@ -429,9 +429,9 @@ void DamageEmitter::Update(float dt, Room *room)
                 float cosA = std::cos(-angle);
 
                 auto monsters = room->GetMonstersInRange(cx, cy, boxHeight);
-                std::vector<int32_t> hitIds;
-                std::vector<int32_t> hitDamages;
-                std::vector<bool> hitCrits;
+                std::pmr::vector<int32_t> hitIds(&room->GetFrameArena());
+                std::pmr::vector<int32_t> hitDamages(&room->GetFrameArena());
+                std::pmr::vector<bool> hitCrits(&room->GetFrameArena());
 
                 int32_t maxTargets = _maxTargetsPerTick + additionalProjectiles;
                 if (levelData && levelData->maxTargets > 0)
@@ -527,9 +527,9 @@ void DamageEmitter::Update(float dt, Room *room)
             Vector2 direction = owner->GetFacingDirection();
             auto monsters = room->GetMonstersInRange(px, py, finalRadius);
 
-            std::vector<int32_t> hitTargetIds;
-            std::vector<int32_t> hitDamageValues;
-            std::vector<bool> hitCriticals;
+            std::pmr::vector<int32_t> hitTargetIds(&room->GetFrameArena());
+            std::pmr::vector<int32_t> hitDamageValues(&room->GetFrameArena());
+            std::pmr::vector<bool> hitCriticals(&room->GetFrameArena());
 
             bool isCritical = false;
             float critMultiplier = 1.0f;
@@ -619,14 +619,14 @@ void DamageEmitter::Update(float dt, Room *room)
         }
         else if (_emitterType == "Aura")
         {
-            std::vector<::System::RefPtr<Monster>> victims = room->GetMonstersInRange(px, py, finalRadius);
+            auto victims = room->GetMonstersInRange(px, py, finalRadius);
 
             int32_t finalMaxTargets = _maxTargetsPerTick + additionalProjectiles;
             if (levelData && levelData->maxTargets > 0)
                 finalMaxTargets = levelData->maxTargets;
-            std::vector<int32_t> hitTargetIds;
-            std::vector<int32_t> hitDamageValues;
-            std::vector<bool> hitCrits;
+            std::pmr::vector<int32_t> hitTargetIds(&room->GetFrameArena());
+            std::pmr::vector<int32_t> hitDamageValues(&room->GetFrameArena());
+            std::pmr::vector<bool> hitCrits(&room->GetFrameArena());
 
             bool isCritical = false;
             float critMultiplier = 1.0f;
@@ -689,7 +689,7 @@ void DamageEmitter::Update(float dt, Room *room)
         else
         {
             // AoE Pulse Damage (default fallback)
-            std::vector<::System::RefPtr<Monster>> victims = room->GetMonstersInRange(px, py, finalRadius);
+            auto victims = room->GetMonstersInRange(px, py, finalRadius);
 
             if (_targetRule == "Nearest")
             {
@@ -709,9 +709,9 @@ void DamageEmitter::Update(float dt, Room *room)
             int32_t finalMaxTargets = _maxTargetsPerTick;
             if (levelData && levelData->maxTargets > 0)
                 finalMaxTargets = levelData->maxTargets;
-            std::vector<int32_t> hitTargetIds;
-            std::vector<int32_t> hitDamageValues;
-            std::vector<bool> hitCrits;
+            std::pmr::vector<int32_t> hitTargetIds(&room->GetFrameArena());
+            std::pmr::vector<int32_t> hitDamageValues(&room->GetFrameArena());
+            std::pmr::vector<bool> hitCrits(&room->GetFrameArena());
 
             // 크리티컬 체크
             bool isCritical = false;
@@ -53,9 +53,9 @@ void ZoneEmitter::Update(
                 float cx = targetMonster->GetX();
                 float cy = targetMonster->GetY();
 
-                std::vector<int32_t> hitTargetIds;
-                std::vector<int32_t> hitDamageValues;
-                std::vector<bool> hitCrits;
+                std::pmr::vector<int32_t> hitTargetIds(&room->GetFrameArena());
+                std::pmr::vector<int32_t> hitDamageValues(&room->GetFrameArena());
+                std::pmr::vector<bool> hitCrits(&room->GetFrameArena());
 
                 for (auto &sMonster : splashTargets)
                 {
@@ -1,10 +1,13 @@
 #pragma once
+#include "Entity/ExpGem.h"
 #include "Entity/GameObject.h"
 #include "Entity/Monster.h"
 #include "Entity/Player.h"
 #include "Entity/Projectile.h"
 #include "System/Memory/RefPtr.h"
+#include "System/Memory/SlabPool.h"
 #include <memory>
+#include <memory_resource>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -56,6 +59,11 @@ public:
     void Clear()
     {
         std::lock_guard<std::mutex> lock(_mutex);
+        // Teardown may run outside the room strand (e.g. ~Room): the caller becomes the owner
+        for (auto &pair : _objects)
+        {
+            pair.second->TransferOwnership();
+        }
         _objects.clear();
         _aliveMonsterCount = 0;
     }
@@ -88,12 +96,60 @@ public:
         return vec;
     }
 
+    // Same snapshot in caller-provided scratch memory (Room frame arena -> no heap allocation per tick)
+    std::pmr::vector<::System::RefPtr<GameObject>> GetAllObjects(std::pmr::memory_resource *resource)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::pmr::vector<::System::RefPtr<GameObject>> vec(resource);
+        vec.reserve(_objects.size());
+        for (auto &pair : _objects)
+        {
+            vec.push_back(pair.second);
+        }
+        return vec;
+    }
+
+    // Borrowed view: no refcount traffic. Only valid while no object is removed (read-only passes such as
+    // network sync / debug broadcast). Use the RefPtr snapshot when the loop may despawn objects.
+    std::pmr::vector<GameObject *> GetAllObjectsView(std::pmr::memory_resource *resource)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::pmr::vector<GameObject *> vec(resource);
+        vec.reserve(_objects.size());
+        for (auto &pair : _objects)
+        {
+            vec.push_back(pair.second.get());
+        }
+        return vec;
+    }
+
     int32_t GetAliveMonsterCount() const
     {
         return _aliveMonsterCount;
     }
 
+    // [Slab] Per-type contiguous storage of this room's entities (strand-confined, no locking).
+    // Range-for walks live objects chunk by chunk: for (Monster &m : objMgr.GetMonsterPool()).
+    // Includes objects already removed from the map but still referenced this tick -> check IsDead/IsExpired.
+    ::System::SlabPool<Monster> &GetMonsterPool()
+    {
+        return _monsterPool;
+    }
+    ::System::SlabPool<Projectile> &GetProjectilePool()
+    {
+        return _projectilePool;
+    }
+    ::System::SlabPool<ExpGem> &GetExpGemPool()
+    {
+        return _expGemPool;
+    }
+
 private:
+    // Declared before _objects: the map's references are dropped first, then the slabs are freed
+    ::System::SlabPool<Monster> _monsterPool;
+    ::System::SlabPool<Projectile> _projectilePool;
+    ::System::SlabPool<ExpGem> _expGemPool;
+
     std::atomic<int32_t> _nextId{1000}; // Reserve 0-999 for Players or special
     std::unordered_map<int32_t, ::System::RefPtr<GameObject>> _objects;
     mutable std::mutex _mutex; // Protects access to map and sequencesterCount = 0;
@@ -1,11 +1,15 @@
 #pragma once
 #include "Entity/Player.h"
 #include <atomic>
+#include <memory_resource>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "System/Dispatcher/MessagePool.h"
 #include "System/ITimer.h"
+#include "System/Memory/FrameArena.h"
 
 #include "Game/Effect/EffectManager.h"
 #include "Game/GameConfig.h"
@@ -55,9 +59,13 @@ public:
     void Enter(const ::System::RefPtr<Player> &player);
     void Leave(uint64_t sessionId);
     void OnPlayerReady(uint64_t sessionId);
-    void BroadcastPacket(const System::IPacket &pkt, uint64_t excludeSessionId = 0);
+    // Optional: dropped while MessagePool is over its soft memory limit
+    void BroadcastPacket(
+        const System::IPacket &pkt, uint64_t excludeSessionId = 0,
+        System::AllocPriority priority = System::AllocPriority::Normal
+    );
     void BroadcastSpawn(const std::vector<::System::RefPtr<GameObject>> &objects);
-    void BroadcastDespawn(const std::vector<int32_t> &objectIds, const std::vector<int32_t> &pickerIds = {});
+    void BroadcastDespawn(std::span<const int32_t> objectIds, std::span<const int32_t> pickerIds = {});
     void SendToPlayer(uint64_t sessionId, const System::IPacket &pkt);
 
     // Game Loop
@@ -82,7 +90,14 @@ public:
     bool IsPlaying() const;
 
     ::System::RefPtr<Player> GetNearestPlayer(float x, float y);
-    std::vector<::System::RefPtr<Monster>> GetMonstersInRange(float x, float y, float radius);
+    // Result lives in the frame arena: valid until the next tick starts (do not store it)
+    std::pmr::vector<::System::RefPtr<Monster>> GetMonstersInRange(float x, float y, float radius);
+
+    // [Frame Arena] Per-tick scratch memory, reset at the start of every ExecuteUpdate
+    ::System::FrameArena &GetFrameArena()
+    {
+        return _frameArena;
+    }
 
     std::shared_ptr<System::IStrand> GetStrand() const
     {
@@ -166,7 +181,8 @@ private:
     void ExecuteStop();
     void InternalClear();
 
-    void UpdatePhysics(float deltaTime, const std::vector<::System::RefPtr<GameObject>> &objects);
+    void UpdatePhysics(float deltaTime);
+    void MoveObject(GameObject &obj, float deltaTime, float radius);
     void SyncNetwork();
     void BroadcastDebugState();
     void BroadcastDebugClear();
@@ -185,6 +201,9 @@ private:
 
     ObjectManager _objMgr;
     std::vector<::System::RefPtr<GameObject>> _queryBuffer;
+    std::vector<::System::RefPtr<GameObject>> _rangeQueryBuffer; // GetMonstersInRange grid scratch (reused)
+    ::System::FrameArena _frameArena;
+    std::vector<uint64_t> _broadcastTargets; // BroadcastPacket recipient scratch (reused)
 
     SpatialGrid _grid{GameConfig::NEAR_GRID_CELL_SIZE};
     WaveManager _waveMgr;
@@ -1,6 +1,8 @@
 #include "Game/RoomManager.h"
 #include "Core/GameEvents.h"
 #include "Core/UserDB.h"
+#include "System/Dispatcher/IDispatcher.h"
+#include "System/Dispatcher/MessagePool.h"
 #include "System/IFramework.h"
 #include "System/ISession.h"
 #include "System/ITimer.h"
@@ -187,17 +189,17 @@ void RoomManager::BroadcastPacketToLobby(const System::IPacket &pkt)
     if (!_framework || !_framework->GetDispatcher())
         return;
 
-    auto dispatcher = _framework->GetDispatcher();
-    for (uint64_t sessionId : _lobbySessions)
-    {
-        dispatcher->WithSession(
-            sessionId,
-            [&pkt](System::SessionContext &ctx)
-            {
-                ctx.Send(pkt);
-            }
-        );
-    }
+    if (_lobbySessions.empty())
+        return;
+
+    // Serialize once, fan out with a single dispatcher message
+    uint16_t size = pkt.GetTotalSize();
+    auto *msg = System::MessagePool::AllocatePacket(size);
+    if (msg == nullptr)
+        return;
+
+    pkt.SerializeTo(msg->Payload());
+    _framework->GetDispatcher()->SendToSessions(_lobbySessions, System::PacketPtr(msg));
 }
 
 // --- EventBus Handlers ---
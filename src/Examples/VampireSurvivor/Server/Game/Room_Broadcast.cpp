@@ -19,6 +19,10 @@ void Room::BroadcastDebugState()
     if (!_framework)
         return;
 
+    // [Budget] Visualizer state is optional: skip it while MessagePool is over its soft limit
+    if (System::MessagePool::ShouldShedOptional())
+        return;
+
     auto network = std::dynamic_pointer_cast<System::NetworkImpl>(_framework->GetNetwork());
     if (!network)
         return;
@@ -50,7 +54,7 @@ void Room::BroadcastDebugState()
     // Monsters & Projectiles
     std::vector<System::Json> monsters;
     std::vector<System::Json> projectiles;
-    const auto &objects = _objMgr.GetAllObjects();
+    auto objects = _objMgr.GetAllObjectsView(&_frameArena);
     for (const auto &obj : objects)
     {
         if (obj->IsDead())
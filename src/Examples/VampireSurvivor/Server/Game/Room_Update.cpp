@@ -1,3 +1,4 @@
+#include "Entity/ExpGem.h"
 #include "Entity/Monster.h"
 #include "Entity/Player.h"
 #include "Entity/Projectile.h"
@@ -17,6 +18,9 @@ namespace SimpleGame {
 
 void Room::ExecuteUpdate(float deltaTime)
 {
+    // [Frame Arena] Scratch containers of the previous tick are gone from here on
+    _frameArena.Reset();
+
     // [Fix] 정지 중이거나 플레이어가 없으면 무거운 연산 즉시 중단
 
     if (!_gameStarted || _isGameOver || _isStopping.load() || _players.empty())
@@ -27,7 +31,6 @@ void Room::ExecuteUpdate(float deltaTime)
 
     _totalRunTime += deltaTime;
     _serverTick++;
-    auto objects = _objMgr.GetAllObjects();
 
     // [1] Wave Update (Monster Spawn)
     _waveMgr.Update(deltaTime, this);
@@ -37,7 +40,7 @@ void Room::ExecuteUpdate(float deltaTime)
 
     // [3] Grid Rebuild (Reflect Spawns immediately so AI can see neighbors)
     // [Fix] Rebuild MUST happen before AI Update
-    auto currentObjects = _objMgr.GetAllObjects();
+    auto currentObjects = _objMgr.GetAllObjects(&_frameArena);
     _grid.Rebuild(currentObjects);
 
     // [New] 매 틱마다 1x1 점유 맵 초기화
@@ -55,7 +58,7 @@ void Room::ExecuteUpdate(float deltaTime)
 
     // [4] Physics / Movement (Projectiles & Monsters)
     // Note: AI sets DesiredVelocity, Physics applies it and moves position
-    UpdatePhysics(deltaTime, currentObjects);
+    UpdatePhysics(deltaTime);
 
     // [5] Combat / Collision / Cleanup
     if (_combatMgr)
@@ -163,66 +166,72 @@ bool CheckCollision(const std::shared_ptr<GameObject> &a, const std::shared_ptr<
     return distSq < (radSum * radSum);
 }
 
-void Room::UpdatePhysics(float deltaTime, const std::vector<::System::RefPtr<GameObject>> &objects)
+void Room::UpdatePhysics(float deltaTime)
 {
-    for (auto &obj : objects)
+    // [Slab] 타입별 연속 메모리 순회 (스냅샷/타입 분기 없음)
+    for (const auto &[sid, player] : _players)
     {
-        if (obj->IsDead())
+        // DB 로딩 중인 플레이어는 아직 월드(ObjectManager)에 없음
+        if (_objMgr.GetObject(player->GetId()) != player)
             continue;
+        MoveObject(*player, deltaTime, 15.0f);
+    }
+    for (Monster &monster : _objMgr.GetMonsterPool())
+    {
+        MoveObject(monster, deltaTime, monster.GetRadius());
+    }
+    // Projectile (투사체는 타일에 막히도록 기획될 수 있음) / ExpGem
+    for (Projectile &proj : _objMgr.GetProjectilePool())
+    {
+        MoveObject(proj, deltaTime, 5.0f);
+    }
+    for (ExpGem &gem : _objMgr.GetExpGemPool())
+    {
+        MoveObject(gem, deltaTime, 5.0f);
+    }
+}
 
-        float vx = obj->GetVX();
-        float vy = obj->GetVY();
-        float moveX = vx * deltaTime;
-        float moveY = vy * deltaTime;
+void Room::MoveObject(GameObject &obj, float deltaTime, float radius)
+{
+    if (obj.IsDead())
+        return;
 
-        // 투사체가 아니면서 움직임이 없는 경우 스킵
-        if (moveX == 0.0f && moveY == 0.0f)
-            continue;
+    float vx = obj.GetVX();
+    float vy = obj.GetVY();
+    float moveX = vx * deltaTime;
+    float moveY = vy * deltaTime;
 
-        // 충돌 검사 (TileMap)
-        if (_tileMap != nullptr)
-        {
-            float radius = 15.0f; // 기본 반지름 (충분히 크거나 몬스터 반경으로 사용)
-            if (obj->GetType() == Protocol::ObjectType::MONSTER)
-            {
-                auto monster = (Monster *)obj.get();
-                if (monster)
-                    radius = monster->GetRadius();
-            }
-            else if (obj->GetType() == Protocol::ObjectType::PLAYER)
-            {
-                radius = 15.0f;
-            }
-            else
-            {
-                radius = 5.0f; // Projectile (투사체는 타일에 막히도록 기획될 수 있음)
-            }
+    // 투사체가 아니면서 움직임이 없는 경우 스킵
+    if (moveX == 0.0f && moveY == 0.0f)
+        return;
 
-            auto sweep = _tileMap->SweepTest(obj->GetX(), obj->GetY(), moveX, moveY, radius);
-            if (sweep.hit)
-            {
-                // 충돌 시점까지 이동한 거리
-                float remainingX = moveX * (1.0f - sweep.time);
-                float remainingY = moveY * (1.0f - sweep.time);
+    // 충돌 검사 (TileMap)
+    if (_tileMap != nullptr)
+    {
+        auto sweep = _tileMap->SweepTest(obj.GetX(), obj.GetY(), moveX, moveY, radius);
+        if (sweep.hit)
+        {
+            // 충돌 시점까지 이동한 거리
+            float remainingX = moveX * (1.0f - sweep.time);
+            float remainingY = moveY * (1.0f - sweep.time);
 
-                // 벽의 법선 벡터를 이용해 속도 성분 제거 (Sliding)
-                _tileMap->Slide(remainingX, remainingY, sweep.normalX, sweep.normalY);
+            // 벽의 법선 벡터를 이용해 속도 성분 제거 (Sliding)
+            _tileMap->Slide(remainingX, remainingY, sweep.normalX, sweep.normalY);
 
-                // 슬라이딩 후 최종 위치 적용
-                obj->SetPos(sweep.hitX + remainingX, sweep.hitY + remainingY);
+            // 슬라이딩 후 최종 위치 적용
+            obj.SetPos(sweep.hitX + remainingX, sweep.hitY + remainingY);
 
-                // 만약 투사체였다면 벽에 맞았을 때 소멸 처리 등 기획에 따라 여기서 처리 가능
-            }
-            else
-            {
-                obj->SetPos(obj->GetX() + moveX, obj->GetY() + moveY);
-            }
+            // 만약 투사체였다면 벽에 맞았을 때 소멸 처리 등 기획에 따라 여기서 처리 가능
         }
         else
         {
-            obj->SetPos(obj->GetX() + moveX, obj->GetY() + moveY);
+            obj.SetPos(obj.GetX() + moveX, obj.GetY() + moveY);
         }
     }
+    else
+    {
+        obj.SetPos(obj.GetX() + moveX, obj.GetY() + moveY);
+    }
 }
 
 // [Networking]
@@ -250,7 +259,7 @@ void Room::SendToPlayer(uint64_t sessionId, const System::IPacket &pkt)
     }
 }
 
-void Room::BroadcastPacket(const System::IPacket &pkt, uint64_t excludeSessionId)
+void Room::BroadcastPacket(const System::IPacket &pkt, uint64_t excludeSessionId, System::AllocPriority priority)
 {
     if (!_dispatcher)
         return;
@@ -258,26 +267,23 @@ void Room::BroadcastPacket(const System::IPacket &pkt, uint64_t excludeSessionId
     // Session::SendPacket과 동일한 방식
     // CrashReproductionTests 검증: ByteSizeLong()은 정확하므로 safeSize 불필요
     uint16_t size = pkt.GetTotalSize();
-    auto *msg = System::MessagePool::AllocatePacket(size);
+    auto *msg = System::MessagePool::AllocatePacket(size, priority);
     if (msg == nullptr)
         return;
 
     pkt.SerializeTo(msg->Payload());
     System::PacketPtr serialized(msg);
 
+    // [Optimization] One dispatcher message for the whole room instead of one WithSession per player
+    _broadcastTargets.clear();
     for (const auto &[sid, player] : _players)
     {
         if (sid == excludeSessionId)
             continue;
-
-        _dispatcher->WithSession(
-            sid,
-            [packet = serialized](System::SessionContext &ctx) mutable
-            {
-                ctx.Send(std::move(packet));
-            }
-        );
+        _broadcastTargets.push_back(sid);
     }
+
+    _dispatcher->SendToSessions(_broadcastTargets, std::move(serialized));
 }
 
 void Room::BroadcastSpawn(const std::vector<::System::RefPtr<GameObject>> &objects)
@@ -319,7 +325,7 @@ void Room::BroadcastSpawn(const std::vector<::System::RefPtr<GameObject>> &objec
     BroadcastPacket(S_SpawnObjectPacket(msg));
 }
 
-void Room::BroadcastDespawn(const std::vector<int32_t> &objectIds, const std::vector<int32_t> &pickerIds)
+void Room::BroadcastDespawn(std::span<const int32_t> objectIds, std::span<const int32_t> pickerIds)
 {
     if (objectIds.empty())
         return;
@@ -345,7 +351,8 @@ void Room::SyncNetwork()
 {
     // [Networking] S_MoveObjectBatchPacket을 통한 전역 위치 동기화
     // 과부하 방지를 위해 틱마다 브로드캐스트 (내삽은 클라이언트 담당)
-    auto objects = _objMgr.GetAllObjects();
+    // Read-only pass -> borrowed view (no AddRef/Release per object)
+    auto objects = _objMgr.GetAllObjectsView(&_frameArena);
     if (objects.empty())
         return;
 
@@ -442,18 +449,17 @@ void Room::SyncNetwork()
     return nearest;
 }
 
-std::vector<::System::RefPtr<Monster>> Room::GetMonstersInRange(float x, float y, float radius)
+std::pmr::vector<::System::RefPtr<Monster>> Room::GetMonstersInRange(float x, float y, float radius)
 {
-    std::vector<::System::RefPtr<GameObject>> queryResults;
-
     // Fix: Use _grid logic correctly.
     // ObjectManager doesn't have QueryRange. SpatialGrid does.
-    _grid.Query(x, y, radius, queryResults, _objMgr);
+    // Query() clears the buffer first; callers never nest GetMonstersInRange inside the query itself.
+    _grid.Query(x, y, radius, _rangeQueryBuffer, _objMgr);
 
-    std::vector<::System::RefPtr<Monster>> monsters;
-    monsters.reserve(queryResults.size());
+    std::pmr::vector<::System::RefPtr<Monster>> monsters(&_frameArena);
+    monsters.reserve(_rangeQueryBuffer.size());
 
-    for (auto &obj : queryResults)
+    for (auto &obj : _rangeQueryBuffer)
     {
         if (obj->GetType() == Protocol::ObjectType::MONSTER)
         {
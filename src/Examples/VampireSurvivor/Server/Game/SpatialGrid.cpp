@@ -40,7 +40,7 @@ void SpatialGrid::Query(
     }
 }
 
-void SpatialGrid::Rebuild(const std::vector<::System::RefPtr<GameObject>> &objects)
+void SpatialGrid::Rebuild(std::span<const ::System::RefPtr<GameObject>> objects)
 {
     // 1. 기존 데이터 초기화 (메모리 재할당 방지를 위해 clear만 수행)
     for (auto &cell : _cells)
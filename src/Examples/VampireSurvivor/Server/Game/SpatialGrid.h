@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <span>
 #include <vector>
 
 namespace SimpleGame {
@@ -31,7 +32,7 @@ public:
     }
 
     // [Optimization] 모든 객체를 격자에 일괄 재배치 (O(N))
-    void Rebuild(const std::vector<::System::RefPtr<GameObject>> &objects);
+    void Rebuild(std::span<const ::System::RefPtr<GameObject>> objects);
 
     // 좌표를 격자 인덱스로 변환 (Wrap-around 방식 지원)
     inline int GetIndex(float x, float y) const
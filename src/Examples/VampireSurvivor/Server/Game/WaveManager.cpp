@@ -140,7 +140,7 @@ std::vector<WaveManager::PlayerCluster> WaveManager::BuildClusters(Room *room) c
     // Since we don't have direct access to Room::_players map, we use ObjectManager or need Room to expose it.
     // Get nearby players to pick a spawn position relative to them
     std::vector<::System::RefPtr<GameObject>> allPlayers;
-    auto objects = _objMgr.GetAllObjects();
+    auto objects = _objMgr.GetAllObjects(&room->GetFrameArena());
     for (auto &obj : objects)
     {
         if (obj->GetType() == Protocol::ObjectType::PLAYER)
@@ -58,17 +58,24 @@ public:
         _sessions[id] = session;
     }
 
-    void WithSession(uint64_t sessionId, std::function<void(SessionContext &)> callback) override
+    void WithSession(uint64_t sessionId, SessionTask callback) override
     {
         calls.push_back({sessionId});
         // Note: Cannot call the lambda because SessionContext has a private constructor.
         // We just track that the attempt was made.
     }
 
+    void SendToSessions(std::span<const uint64_t> sessionIds, PacketPtr packet) override
+    {
+        // Tracked per recipient, same as WithSession
+        for (uint64_t sessionId : sessionIds)
+            calls.push_back({sessionId});
+    }
+
     void RegisterTimerHandler(ITimerHandler *handler) override
     {
     }
-    void Push(std::function<void()> task) override
+    void Push(DispatchTask task) override
     {
         task();
     }
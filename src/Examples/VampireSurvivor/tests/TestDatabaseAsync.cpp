@@ -16,7 +16,7 @@ namespace System {
 class TestDispatcher : public IDispatcher
 {
 public:
-    void Push(std::function<void()> task) override
+    void Push(DispatchTask task) override
     {
         std::lock_guard<std::mutex> lock(_mutex);
         _tasks.push_back(std::move(task));
@@ -29,7 +29,7 @@ public:
 
     bool Process() override
     {
-        std::vector<std::function<void()>> currentTasks;
+        std::vector<DispatchTask> currentTasks;
         {
             std::lock_guard<std::mutex> lock(_mutex);
             currentTasks.swap(_tasks);
@@ -74,7 +74,7 @@ public:
     }
 
 private:
-    std::vector<std::function<void()>> _tasks;
+    std::vector<DispatchTask> _tasks;
     std::mutex _mutex;
     std::condition_variable _cv;
 };
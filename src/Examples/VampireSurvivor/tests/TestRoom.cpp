@@ -1,3 +1,6 @@
+#include "Core/DataManager.h"
+#include "Entity/Monster.h"
+#include "Entity/MonsterFactory.h"
 #include "Entity/Player.h"
 #include "Game/ObjectManager.h"
 #include "Game/Room.h"
@@ -7,9 +10,41 @@
 #include <cstring>
 #include <gtest/gtest.h>
 #include <memory>
+#include <memory_resource>
 
 namespace SimpleGame {
 
+namespace {
+// [Allocation Counter] Upstream for FrameArena / pmr default resource that counts every allocation
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    size_t GetAllocCount() const
+    {
+        return _allocs;
+    }
+
+private:
+    void *do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++_allocs;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *ptr, size_t bytes, size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    size_t _allocs = 0;
+};
+} // namespace
+
 // Mock Session to use with Player
 class MockSession : public System::ISession
 {
@@ -317,4 +352,93 @@ TEST(SendPacketTest, BroadcastPacketToRoomWithPlayers)
     room->Leave(202);
 }
 
+// =============================================================================
+// Frame Arena Tests
+// =============================================================================
+
+/**
+ * @brief 워밍업 이후 틱 스크래치 컨테이너(GetAllObjects / GetMonstersInRange / despawn·hit 목록)는
+ *        Room 의 FrameArena 만 사용하고 힙을 건드리지 않는다.
+ */
+TEST(RoomFrameArenaTest, SteadyStateTickScratchDoesNotAllocate)
+{
+    MonsterInfo tmpl;
+    tmpl.id = 77;
+    tmpl.hp = 100000;
+    tmpl.speed = 0.0f;
+    tmpl.radius = 0.5f;
+    tmpl.damageOnContact = 0;
+    tmpl.attackCooldown = 1.0f;
+    tmpl.aiType = MonsterAIType::CHASER;
+    DataManager::Instance().AddMonsterInfo(tmpl);
+
+    auto mockFramework = std::make_shared<System::MockFramework>();
+    auto room = std::make_shared<Room>(
+        997,
+        1,
+        mockFramework,
+        mockFramework->GetDispatcher(),
+        mockFramework->GetTimer(),
+        mockFramework->CreateStrand(),
+        nullptr
+    );
+
+    MockSession session(301);
+    auto player = ::System::RefPtr<Player>(new Player(301, session.GetId()));
+    player->Initialize(301, session.GetId(), 100, 5.0f);
+    player->SetReady(true);
+    room->Enter(player);
+    room->StartGame();
+
+    for (int i = 0; i < 64; ++i)
+    {
+        auto monster = MonsterFactory::Instance().CreateMonster(
+            room->GetObjectManager(), 77, 40.0f + static_cast<float>(i % 8), 40.0f + static_cast<float>(i / 8)
+        );
+        room->GetObjectManager().AddObject(monster);
+    }
+
+    // Warm-up: arena chunks, grid cells and the range-query buffer reach their steady size
+    for (int i = 0; i < 10; ++i)
+        room->Update(0.02f);
+
+    System::FrameArena &arena = room->GetFrameArena();
+    const size_t chunks = arena.GetUpstreamAllocCount();
+    EXPECT_GT(arena.GetHighWater(), 0u);
+
+    for (int i = 0; i < 50; ++i)
+        room->Update(0.02f);
+    EXPECT_EQ(arena.GetUpstreamAllocCount(), chunks);
+
+    // Per-call scratch: no upstream allocation once warm (Reset() = tick boundary).
+    // The caller-side arena and the pmr default resource both count through one upstream,
+    // so a container that falls back to the default resource shows up as well.
+    CountingResource counting;
+    System::FrameArena scratch(System::FrameArena::DEFAULT_CHUNK_SIZE, &counting);
+    scratch.Reset();
+    arena.Reset();
+    room->GetMonstersInRange(43.0f, 43.0f, 10.0f);
+    room->GetObjectManager().GetAllObjects(&scratch);
+    const size_t roomChunks = arena.GetUpstreamAllocCount();
+    const size_t warmAllocs = counting.GetAllocCount();
+
+    std::pmr::memory_resource *previous = std::pmr::set_default_resource(&counting);
+    size_t found = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        arena.Reset();
+        scratch.Reset();
+        auto monsters = room->GetMonstersInRange(43.0f, 43.0f, 10.0f);
+        auto objects = room->GetObjectManager().GetAllObjects(&scratch);
+        found += monsters.size() + objects.size();
+    }
+    std::pmr::set_default_resource(previous);
+
+    EXPECT_EQ(counting.GetAllocCount(), warmAllocs);
+    EXPECT_EQ(arena.GetUpstreamAllocCount(), roomChunks);
+    EXPECT_GT(found, 0u);
+
+    room->Leave(301);
+}
+
 } // namespace SimpleGame
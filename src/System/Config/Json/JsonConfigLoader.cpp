@@ -53,6 +53,35 @@ bool JsonConfigLoader::Load(const std::string &filePath)
             else
                 _config.dbWorkerCount = 2; // Default
 
+            _config.dispatcherShardCount =
+                server.value("dispatcher_shards", server.value("dispatcherShardCount", 1));
+            _config.dispatcherWaitPolicy =
+                server.value("dispatcher_wait", server.value("dispatcherWaitPolicy", "cv"));
+            _config.messagePoolHugePages =
+                server.value("msgpool_huge_pages", server.value("messagePoolHugePages", "none"));
+            _config.messagePoolSoftLimitMb =
+                server.value("msgpool_soft_limit_mb", server.value("messagePoolSoftLimitMb", 0));
+            _config.messagePoolHardLimitMb =
+                server.value("msgpool_hard_limit_mb", server.value("messagePoolHardLimitMb", 0));
+            _config.ioBackend = server.value("io_backend", server.value("ioBackend", "epoll"));
+            _config.ioUringRegisteredBlocks =
+                server.value("io_uring_registered_blocks", server.value("ioUringRegisteredBlocks", 1024));
+            _config.udpSocketShards = server.value("udp_socket_shards", server.value("udpSocketShards", 1));
+            _config.udpBatchSize = server.value("udp_batch_size", server.value("udpBatchSize", 0));
+            _config.udpGso = server.value("udp_gso", server.value("udpGso", false));
+
+            _config.ioThreadCpus = server.value("io_cpus", server.value("ioThreadCpus", ""));
+            _config.logicThreadCpus = server.value("logic_cpus", server.value("logicThreadCpus", ""));
+            _config.taskThreadCpus = server.value("task_cpus", server.value("taskThreadCpus", ""));
+            _config.dbThreadCpus = server.value("db_cpus", server.value("dbThreadCpus", ""));
+            _config.udpThreadCpus = server.value("udp_cpus", server.value("udpThreadCpus", ""));
+            _config.numaLocalPools = server.value("numa_local_pools", server.value("numaLocalPools", false));
+            _config.parkIdleReads = server.value("park_idle_reads", server.value("parkIdleReads", false));
+            _config.zeroCopyGatewayRecv =
+                server.value("zero_copy_gateway_recv", server.value("zeroCopyGatewayRecv", false));
+            _config.zeroCopyBackendRecv =
+                server.value("zero_copy_backend_recv", server.value("zeroCopyBackendRecv", false));
+
             _config.dbAddress = server.value("db_info", server.value("dbAddress", ""));
             _config.dbType = server.value("db_type", server.value("dbType", "sqlite"));
             _config.dbUser = server.value("db_user", server.value("dbUser", ""));
@@ -6,10 +6,12 @@
 #include "System/PacketView.h"
 #include "System/Session/SessionContext.h"
 #include "System/Session/SessionFactory.h"
+#include <algorithm>
 
 namespace System {
 
-DispatcherImpl::DispatcherImpl(std::shared_ptr<IPacketHandler> packetHandler) : _packetHandler(std::move(packetHandler))
+DispatcherImpl::DispatcherImpl(std::shared_ptr<IPacketHandler> packetHandler, WaitPolicy waitPolicy)
+    : _packetHandler(std::move(packetHandler)), _waitStrategy(waitPolicy)
 {
 }
 
@@ -19,145 +21,172 @@ DispatcherImpl::~DispatcherImpl()
 
 void DispatcherImpl::Post(IMessage *message)
 {
-    _messageQueue.enqueue(message);
+    QueueOf(LaneOf(message->type)).enqueue(message);
 
-    // [Optimization] Smart Notify
-    // Only notify if there are threads actually waiting in Wait()
-    if (_waitingCount.load(std::memory_order_relaxed) > 0)
-    {
-        _cv.notify_one();
-    }
+    // [Optimization] Smart Notify (policy decides whether anyone needs waking)
+    _waitStrategy.Notify();
 }
 
 bool DispatcherImpl::Process()
 {
-    // [Phase 1] Process Messages
-    static const size_t BATCH_SIZE = 64;
-    IMessage *msgs[BATCH_SIZE];
-
-    size_t count = _messageQueue.try_dequeue_bulk(msgs, BATCH_SIZE);
-
     // [Thread Safety] Record the thread ID that actually processes the logic
     if (_ownerThreadId.load(std::memory_order_relaxed) == std::thread::id())
     {
         _ownerThreadId.store(std::this_thread::get_id(), std::memory_order_relaxed);
     }
 
-    if (count > 0)
+    // [Phase 1] Process Messages (Weighted: High lane is drained before every Normal slice)
+    // A flood of gameplay packets delays a Timer Tick by at most NORMAL_SLICE messages.
+    size_t count = 0;
+    for (size_t slice = 0; slice < NORMAL_SLICES; ++slice)
     {
-        for (size_t i = 0; i < count; ++i)
-        {
-            IMessage *msg = msgs[i];
+        count += DrainLane(DispatchLane::High, BATCH_SIZE);
+
+        size_t normal = DrainLane(DispatchLane::Normal, NORMAL_SLICE);
+        count += normal;
+        if (normal < NORMAL_SLICE)
+            break;
+    }
+
+    // [Phase 2] Process Lifecycle (Deferred Destruction)
+    ProcessPendingDestroys();
+
+    return count > 0;
+}
+
+size_t DispatcherImpl::DrainLane(DispatchLane lane, size_t maxCount)
+{
+    IMessage *msgs[BATCH_SIZE];
+    size_t count = QueueOf(lane).try_dequeue_bulk(msgs, std::min(maxCount, BATCH_SIZE));
 
+    for (size_t i = 0; i < count; ++i)
+    {
+        DispatchMessage(msgs[i]);
+    }
+    return count;
+}
+
+void DispatcherImpl::DispatchMessage(IMessage *msg)
+{
 #ifdef ENABLE_DIAGNOSTICS
-            System::Debug::MemoryMetrics::Processed.fetch_add(1, std::memory_order_relaxed);
+    System::Debug::MemoryMetrics::Processed.fetch_add(1, std::memory_order_relaxed);
 #endif
 
-            switch (msg->type)
-            {
-            case MessageType::LOGIC_JOB:
-                // Ignored for now or handled elsewhere
-                break;
-
-            case MessageType::NETWORK_DATA:
-            case MessageType::PACKET:
-                HandlePacketMessage(msg);
-                break;
-
-            case MessageType::NETWORK_CONNECT:
-                if (msg->session != nullptr)
-                {
-                    _sessions[msg->sessionId] = msg->session;
-                }
-                break;
-
-            case MessageType::NETWORK_DISCONNECT:
-                if (msg->session != nullptr)
-                {
-                    _sessions.erase(msg->sessionId);
-                    if (_packetHandler != nullptr)
-                    {
-                        SessionContext ctx(msg->session);
-                        _packetHandler->OnSessionDisconnect(std::move(ctx));
-                    }
-                    _pendingDestroy.push_back(msg->session);
-                }
-                break;
-
-            case MessageType::LOGIC_TIMER_EXPIRED:
-                HandleTimerExpiredMessage(msg);
-                break;
-
-            case MessageType::LOGIC_TIMER_ADD:
-                HandleTimerAddMessage(msg);
-                break;
-
-            case MessageType::LOGIC_TIMER_CANCEL:
-                HandleTimerCancelMessage(msg);
-                break;
-
-            case MessageType::LOGIC_TIMER_TICK:
-                HandleTimerTickMessage(msg);
-                break;
-
-            case MessageType::LAMBDA_JOB:
-                HandleLambdaMessage(msg);
-                continue; // Skip MessagePool::Free and DecRef (handled in HandleLambdaMessage)
-
-            default:
-                LOG_INFO("Unhandled message type: {}", static_cast<uint32_t>(msg->type));
-                break;
-            }
+    switch (msg->type)
+    {
+    case MessageType::LOGIC_JOB:
+        // Ignored for now or handled elsewhere
+        break;
+
+    case MessageType::NETWORK_DATA:
+    case MessageType::PACKET:
+        HandlePacketMessage(msg);
+        break;
 
-            // [Lifetime] Release session reference (matches IncRef before Post)
-            if (msg->session != nullptr)
+    case MessageType::NETWORK_DATA_REF:
+        HandlePacketRefMessage(msg);
+        break;
+
+    case MessageType::NETWORK_CONNECT:
+        if (msg->session != nullptr)
+        {
+            _sessions.Add(msg->sessionId, msg->session);
+        }
+        break;
+
+    case MessageType::NETWORK_DISCONNECT:
+        if (msg->session != nullptr)
+        {
+            _sessions.Remove(msg->sessionId);
+            if (_packetHandler != nullptr)
             {
-                msg->session->DecRef();
+                SessionContext ctx(msg->session);
+                _packetHandler->OnSessionDisconnect(std::move(ctx));
             }
-
-            // Return to pool
-            MessagePool::Free(msg);
+            _pendingDestroy.push_back(msg->session);
         }
+        break;
+
+    case MessageType::LOGIC_TIMER_EXPIRED:
+        HandleTimerExpiredMessage(msg);
+        break;
+
+    case MessageType::LOGIC_TIMER_ADD:
+        HandleTimerAddMessage(msg);
+        break;
+
+    case MessageType::LOGIC_TIMER_CANCEL:
+        HandleTimerCancelMessage(msg);
+        break;
+
+    case MessageType::LOGIC_TIMER_TICK:
+        HandleTimerTickMessage(msg);
+        break;
+
+    case MessageType::LAMBDA_JOB:
+        HandleLambdaMessage(msg);
+        break;
+
+    case MessageType::SESSION_JOB:
+        HandleSessionLambdaMessage(msg);
+        break;
+
+    case MessageType::SESSION_MULTICAST:
+        HandleMulticastMessage(msg);
+        break;
+
+    default:
+        LOG_INFO("Unhandled message type: {}", static_cast<uint32_t>(msg->type));
+        break;
     }
 
-    // [Phase 2] Process Lifecycle (Deferred Destruction)
-    ProcessPendingDestroys();
+    // [Lifetime] Release session reference (matches IncRef before Post)
+    if (msg->session != nullptr)
+    {
+        // [Backpressure] Matches the in-flight increment in Session::PostInbound
+        if (msg->type == MessageType::NETWORK_DATA || msg->type == MessageType::NETWORK_DATA_REF)
+        {
+            msg->session->OnInboundProcessed();
+        }
+        msg->session->DecRef();
+    }
 
-    return count > 0;
+    // Return to pool
+    MessagePool::Free(msg);
 }
 
 void DispatcherImpl::Wait(int timeoutMs)
 {
-    // [Optimization] Track waiting thread count to avoid unnecessary notify_one calls
-    _waitingCount.fetch_add(1, std::memory_order_relaxed);
-
-    std::unique_lock<std::mutex> lock(_mutex);
-    _cv.wait_for(
-        lock,
-        std::chrono::milliseconds(timeoutMs),
+    _waitStrategy.Wait(
+        timeoutMs,
         [this]
         {
             return GetQueueSize() > 0;
         }
     );
-
-    _waitingCount.fetch_sub(1, std::memory_order_relaxed);
 }
 
 void DispatcherImpl::HandlePacketMessage(IMessage *msg)
 {
-    ISession *session = msg->session;
+    PacketMessage *content = static_cast<PacketMessage *>(msg);
+    DeliverFrame(msg->session, content->Payload(), content->length);
+}
+
+void DispatcherImpl::HandlePacketRefMessage(IMessage *msg)
+{
+    // Frame is read in place from the shared receive block (released with the message)
+    PacketRefMessage *ref = static_cast<PacketRefMessage *>(msg);
+    DeliverFrame(msg->session, ref->frame, ref->length);
+}
+
+void DispatcherImpl::DeliverFrame(ISession *session, const uint8_t *frame, uint16_t length)
+{
     if (session != nullptr && session->IsConnected())
     {
-        PacketMessage *content = static_cast<PacketMessage *>(msg);
-        if (content->length >= sizeof(System::PacketHeader))
+        if (length >= sizeof(System::PacketHeader))
         {
-            auto *header = reinterpret_cast<System::PacketHeader *>(content->Payload());
-            PacketView view(
-                header->id,
-                content->Payload() + sizeof(System::PacketHeader),
-                content->length - sizeof(System::PacketHeader)
-            );
+            auto *header = reinterpret_cast<const System::PacketHeader *>(frame);
+            PacketView view(header->id, frame + sizeof(System::PacketHeader), length - sizeof(System::PacketHeader));
 
             if (_packetHandler != nullptr)
             {
@@ -168,7 +197,7 @@ void DispatcherImpl::HandlePacketMessage(IMessage *msg)
         }
         else
         {
-            LOG_ERROR("Packet too small for header: {}", content->length);
+            LOG_ERROR("Packet too small for header: {}", length);
         }
     }
 }
@@ -216,14 +245,41 @@ void DispatcherImpl::HandleLambdaMessage(IMessage *msg)
     {
         lMsg->task();
     }
+    // Release: common path (MessagePool::Free handles both pooled and 'new'ed messages)
+}
 
-    if (msg->session != nullptr)
+void DispatcherImpl::HandleSessionLambdaMessage(IMessage *msg)
+{
+    auto *sMsg = static_cast<SessionLambdaMessage *>(msg);
+    ISession *session = _sessions.Find(sMsg->sessionId);
+    if (session != nullptr && session->IsConnected())
     {
-        msg->session->DecRef();
+        SessionContext ctx(session);
+        sMsg->task(ctx);
     }
+}
+
+void DispatcherImpl::HandleMulticastMessage(IMessage *msg)
+{
+    auto *mMsg = static_cast<MulticastMessage *>(msg);
+
+    // Take over the reference added by SendToSessions()
+    PacketPtr packet(mMsg->packet);
+    mMsg->packet = nullptr;
 
-    // LambdaMessage is not pooled, allocated with 'new' in Push()
-    delete lMsg;
+    FanOut(std::span<const uint64_t>(mMsg->sessionIds, mMsg->count), packet);
+}
+
+void DispatcherImpl::FanOut(std::span<const uint64_t> sessionIds, const PacketPtr &packet)
+{
+    for (uint64_t sessionId : sessionIds)
+    {
+        ISession *session = _sessions.Find(sessionId);
+        if (session != nullptr && session->IsConnected())
+        {
+            session->SendPacket(packet);
+        }
+    }
 }
 
 void DispatcherImpl::ProcessPendingDestroys()
@@ -267,17 +323,34 @@ void DispatcherImpl::ProcessPendingDestroys()
 // DispatcherImpl.h Implementations
 size_t DispatcherImpl::GetQueueSize() const
 {
-    return _messageQueue.size_approx();
+    return GetQueueSize(DispatchLane::High) + GetQueueSize(DispatchLane::Normal);
 }
 
 bool DispatcherImpl::IsOverloaded() const
 {
-    return _messageQueue.size_approx() > DispatcherImpl::HIGH_WATER;
+    return IsOverloaded(DispatchLane::High) || IsOverloaded(DispatchLane::Normal);
 }
 
 bool DispatcherImpl::IsRecovered() const
 {
-    return _messageQueue.size_approx() < DispatcherImpl::LOW_WATER;
+    return IsRecovered(DispatchLane::High) && IsRecovered(DispatchLane::Normal);
+}
+
+size_t DispatcherImpl::GetQueueSize(DispatchLane lane) const
+{
+    return QueueOf(lane).size_approx();
+}
+
+bool DispatcherImpl::IsOverloaded(DispatchLane lane) const
+{
+    size_t highWater = (lane == DispatchLane::High) ? CONTROL_HIGH_WATER : HIGH_WATER;
+    return GetQueueSize(lane) > highWater;
+}
+
+bool DispatcherImpl::IsRecovered(DispatchLane lane) const
+{
+    size_t lowWater = (lane == DispatchLane::High) ? CONTROL_LOW_WATER : LOW_WATER;
+    return GetQueueSize(lane) < lowWater;
 }
 
 void DispatcherImpl::RegisterTimerHandler(ITimerHandler *handler)
@@ -285,33 +358,55 @@ void DispatcherImpl::RegisterTimerHandler(ITimerHandler *handler)
     _timerHandler = handler;
 }
 
-void DispatcherImpl::WithSession(uint64_t sessionId, std::function<void(SessionContext &)> callback)
+void DispatcherImpl::WithSession(uint64_t sessionId, SessionTask callback)
 {
     // [Optimization/Safety] If we are already in the Dispatcher thread, execute IMMEDIATELY.
     // This protects local references (like IPacket&) from being captured into an async lambda.
     if (IsInDispatcherThread())
     {
-        auto it = _sessions.find(sessionId);
-        if (it != _sessions.end() && it->second->IsConnected())
+        ISession *session = _sessions.Find(sessionId);
+        if (session != nullptr && session->IsConnected())
         {
-            SessionContext ctx(it->second);
+            SessionContext ctx(session);
             callback(ctx);
         }
         return;
     }
 
-    // [SessionContext Refactoring] Use Push to ensure callback runs in Dispatcher's logic context (serial)
-    Push(
-        [this, sessionId, callback = std::move(callback)]()
-        {
-            auto it = _sessions.find(sessionId);
-            if (it != _sessions.end() && it->second->IsConnected())
-            {
-                SessionContext ctx(it->second);
-                callback(ctx);
-            }
-        }
-    );
+    // [SessionContext Refactoring] Queue so the callback runs in Dispatcher's logic context (serial)
+    // [Optimization] Dedicated message: no wrapping lambda, callback stored inline in a pooled block
+    SessionLambdaMessage *msg = MessagePool::AllocateSessionLambda();
+    msg->sessionId = sessionId;
+    msg->task = std::move(callback);
+    Post(msg);
+}
+
+void DispatcherImpl::SendToSessions(std::span<const uint64_t> sessionIds, PacketPtr packet)
+{
+    if (sessionIds.empty() || !packet)
+        return;
+
+    // Same rule as WithSession(): no queue hop when already on the logic thread
+    if (IsInDispatcherThread())
+    {
+        FanOut(sessionIds, packet);
+        return;
+    }
+
+    // Recipient list is copied inline into the message; split only if it exceeds one Large block
+    while (!sessionIds.empty())
+    {
+        size_t count = std::min(sessionIds.size(), MessagePool::MAX_MULTICAST_RECIPIENTS);
+        MulticastMessage *msg = MessagePool::AllocateMulticast(static_cast<uint16_t>(count));
+        if (msg == nullptr)
+            return;
+
+        std::copy_n(sessionIds.begin(), count, msg->sessionIds);
+        msg->packet = PacketPtr(packet).Release(); // One reference per message
+        Post(msg);
+
+        sessionIds = sessionIds.subspan(count);
+    }
 }
 
 bool DispatcherImpl::IsInDispatcherThread() const
@@ -319,13 +414,14 @@ bool DispatcherImpl::IsInDispatcherThread() const
     return std::this_thread::get_id() == _ownerThreadId.load(std::memory_order_relaxed);
 }
 
-void DispatcherImpl::Push(std::function<void()> task)
+void DispatcherImpl::Push(DispatchTask task)
 {
     // [Optimization Decision]
     // 벤치마크 결과(Legacy: 48ms vs 4KB Pooling: 181ms), 소형 객체인 LambdaMessage를
     // 거대한 4KB 풀에 넣는 것은 심각한 캐시 미스와 내부 단편화를 유발하여 성능이 오히려 하락함.
-    // 따라서 Windows LFH(Low Fragmentation Heap)에 최적화된 시스템 할당자를 사용하도록 롤백함.
-    LambdaMessage *msg = new LambdaMessage();
+    // -> LambdaMessage 전용 크기의 Slab 블록 + Thread-Local Freelist 로 전환 (MessagePool Task Level).
+    //    glibc malloc 환경에서도 LFH 에 의존하지 않고 할당이 사라진다. (TestTaskAllocBenchmark 참고)
+    LambdaMessage *msg = MessagePool::AllocateLambda();
     msg->task = std::move(task);
     Post(msg);
 }
@@ -333,7 +429,7 @@ void DispatcherImpl::Push(std::function<void()> task)
 void DispatcherImpl::Shutdown()
 {
     // Wake up any threads waiting in Wait()
-    _cv.notify_all();
+    _waitStrategy.NotifyAll();
 }
 
 } // namespace System
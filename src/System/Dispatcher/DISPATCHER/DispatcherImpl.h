@@ -1,13 +1,12 @@
 #pragma once
 
+#include "System/Dispatcher/DISPATCHER/SessionTable.h"
+#include "System/Dispatcher/DISPATCHER/WaitStrategy.h"
 #include "System/Dispatcher/IDispatcher.h"
 #include "System/Dispatcher/IPacketHandler.h"
 #include <atomic>
 #include <concurrentqueue/moodycamel/concurrentqueue.h>
-#include <condition_variable>
 #include <memory>
-#include <mutex>
-#include <unordered_map>
 #include <vector>
 
 namespace System {
@@ -17,10 +16,22 @@ class ISession;
 class DispatcherImpl : public IDispatcher
 {
 public:
+    // Normal Lane (Packets / Jobs) watermarks
     static constexpr size_t HIGH_WATER = 5000;
     static constexpr size_t LOW_WATER = 3000;
 
-    DispatcherImpl(std::shared_ptr<IPacketHandler> packetHandler);
+    // High Lane (Timer) watermarks
+    static constexpr size_t CONTROL_HIGH_WATER = 1000;
+    static constexpr size_t CONTROL_LOW_WATER = 500;
+
+    // [Weighted Drain] Per Process(): NORMAL_SLICES x (High lane up to BATCH_SIZE, Normal lane up to NORMAL_SLICE)
+    static constexpr size_t BATCH_SIZE = 64;
+    static constexpr size_t NORMAL_SLICE = 16;
+    static constexpr size_t NORMAL_SLICES = 4;
+
+    DispatcherImpl(
+        std::shared_ptr<IPacketHandler> packetHandler, WaitPolicy waitPolicy = WaitPolicy::ConditionVariable
+    );
     virtual ~DispatcherImpl() override;
 
     void Post(IMessage *message) override;
@@ -33,44 +44,73 @@ public:
     bool IsOverloaded() const override;
     bool IsRecovered() const override;
 
+    // Per-lane depth / overload state
+    size_t GetQueueSize(DispatchLane lane) const;
+    bool IsOverloaded(DispatchLane lane) const;
+    bool IsRecovered(DispatchLane lane) const;
+
     void RegisterTimerHandler(ITimerHandler *handler) override;
 
     // Session-safe access
-    void WithSession(uint64_t sessionId, std::function<void(SessionContext &)> callback) override;
+    void WithSession(uint64_t sessionId, SessionTask callback) override;
+
+    // Batched Send (one message fanned out on the logic thread)
+    void SendToSessions(std::span<const uint64_t> sessionIds, PacketPtr packet) override;
 
     // Generic Task Submission
-    void Push(std::function<void()> task) override;
+    void Push(DispatchTask task) override;
 
     // Graceful Shutdown
     void Shutdown() override;
 
+    // Idle Wait Diagnostics (spin/park time, wakeups)
+    WaitStats GetWaitStats() const
+    {
+        return _waitStrategy.GetStats();
+    }
+
 private:
     void ProcessPendingDestroys();
+    size_t DrainLane(DispatchLane lane, size_t maxCount);
+    void DispatchMessage(IMessage *msg);
 
     // Message Handlers
     void HandlePacketMessage(IMessage *msg);
+    void HandlePacketRefMessage(IMessage *msg);
+    void DeliverFrame(ISession *session, const uint8_t *frame, uint16_t length);
 
     void HandleTimerExpiredMessage(IMessage *msg);
     void HandleTimerAddMessage(IMessage *msg);
     void HandleTimerCancelMessage(IMessage *msg);
     void HandleTimerTickMessage(IMessage *msg);
     static void HandleLambdaMessage(IMessage *msg);
+    void HandleSessionLambdaMessage(IMessage *msg);
+    void HandleMulticastMessage(IMessage *msg);
+    void FanOut(std::span<const uint64_t> sessionIds, const PacketPtr &packet);
+
+    moodycamel::ConcurrentQueue<IMessage *> &QueueOf(DispatchLane lane)
+    {
+        return _lanes[static_cast<size_t>(lane)];
+    }
+    const moodycamel::ConcurrentQueue<IMessage *> &QueueOf(DispatchLane lane) const
+    {
+        return _lanes[static_cast<size_t>(lane)];
+    }
+
+    // [Priority Lanes] Index by DispatchLane
+    moodycamel::ConcurrentQueue<IMessage *> _lanes[static_cast<size_t>(DispatchLane::Count)];
 
-    moodycamel::ConcurrentQueue<IMessage *> _messageQueue;
-
-    std::mutex _mutex;
-    std::condition_variable _cv;
     std::shared_ptr<IPacketHandler> _packetHandler;
 
-    // [Session Registry] Maps sessionId to ISession* for safe access in WithSession
-    std::unordered_map<uint64_t, ISession *> _sessions;
+    // [Session Registry] sessionId(SessionHandle) -> ISession*, slot array + version check
+    SessionTable _sessions;
     std::vector<ISession *> _pendingDestroy;
 
     // System Handlers
     ITimerHandler *_timerHandler = nullptr;
 
-    // [Optimization] Smart Notify using wait count
-    std::atomic<int32_t> _waitingCount{0};
+    // [Optimization] Pluggable idle wait (CV Smart Notify / Spin / Spin-then-Park)
+    WaitStrategy _waitStrategy;
 
     // [Thread Safety] Logic owner thread tracking
     std::atomic<std::thread::id> _ownerThreadId;
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "System/Memory/GenerationalID.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace System {
+
+class ISession;
+
+/**
+ * @brief Dispatcher 로직 스레드 전용 Session Registry (sessionId -> ISession*)
+ *
+ * SessionHandle 의 Slot 을 배열 인덱스로 사용한다.
+ * 조회 = Bounds Check + 저장된 전체 ID(Version 포함) 비교 -> Hash 계산/노드 추적 없음.
+ * Disconnect 이후 도착한 Stale ID 는 Version 불일치로 바로 걸러진다.
+ *
+ * Slot 이 너무 크거나(임의 ID) 다른 ID 가 이미 차지한 Slot 은 Overflow Map 으로 보낸다.
+ * SessionFactory 가 발급한 ID 만 쓰는 정상 경로에서는 Overflow 가 비어 있다.
+ */
+class SessionTable
+{
+public:
+    static constexpr uint32_t MAX_DENSE_SLOTS = 1u << 20;
+
+    void Add(uint64_t sessionId, ISession *session)
+    {
+        uint32_t slot = SessionHandle::GetSlot(sessionId);
+        if (slot == 0 || slot >= MAX_DENSE_SLOTS)
+        {
+            AddOverflow(sessionId, session);
+            return;
+        }
+
+        if (slot >= _slots.size())
+        {
+            _slots.resize(static_cast<size_t>(slot) + 1);
+        }
+
+        Entry &entry = _slots[slot];
+        if (entry.session != nullptr && entry.sessionId != sessionId)
+        {
+            AddOverflow(sessionId, session);
+            return;
+        }
+
+        if (entry.session == nullptr)
+            ++_count;
+        entry.sessionId = sessionId;
+        entry.session = session;
+    }
+
+    void Remove(uint64_t sessionId)
+    {
+        uint32_t slot = SessionHandle::GetSlot(sessionId);
+        if (slot < _slots.size() && _slots[slot].session != nullptr && _slots[slot].sessionId == sessionId)
+        {
+            _slots[slot] = Entry{};
+            --_count;
+            return;
+        }
+
+        if (!_overflow.empty() && _overflow.erase(sessionId) > 0)
+        {
+            --_count;
+        }
+    }
+
+    ISession *Find(uint64_t sessionId) const
+    {
+        uint32_t slot = SessionHandle::GetSlot(sessionId);
+        if (slot < _slots.size() && _slots[slot].sessionId == sessionId)
+        {
+            return _slots[slot].session;
+        }
+
+        if (_overflow.empty())
+            return nullptr;
+
+        auto it = _overflow.find(sessionId);
+        return it != _overflow.end() ? it->second : nullptr;
+    }
+
+    size_t Size() const
+    {
+        return _count;
+    }
+
+private:
+    void AddOverflow(uint64_t sessionId, ISession *session)
+    {
+        if (_overflow.insert_or_assign(sessionId, session).second)
+            ++_count;
+    }
+
+    struct Entry
+    {
+        uint64_t sessionId = 0;
+        ISession *session = nullptr;
+    };
+
+    std::vector<Entry> _slots; // index = slot (0 unused)
+    std::unordered_map<uint64_t, ISession *> _overflow;
+    size_t _count = 0;
+};
+
+} // namespace System
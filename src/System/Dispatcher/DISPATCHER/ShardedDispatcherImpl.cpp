@@ -0,0 +1,230 @@
+#include "System/Dispatcher/DISPATCHER/ShardedDispatcherImpl.h"
+#include "System/Dispatcher/IMessage.h"
+#include "System/ILog.h"
+#include "System/Thread/CpuTopology.h"
+
+namespace System {
+
+ShardedDispatcherImpl::ShardedDispatcherImpl(
+    std::shared_ptr<IPacketHandler> packetHandler, size_t shardCount, WaitPolicy waitPolicy
+)
+{
+    if (shardCount == 0)
+        shardCount = 1;
+
+    _shards.reserve(shardCount);
+    for (size_t i = 0; i < shardCount; ++i)
+    {
+        _shards.push_back(std::make_unique<DispatcherImpl>(packetHandler, waitPolicy));
+    }
+
+    // Shard 0 is driven by the caller of Process()/Wait() (Framework main loop).
+    _shardThreads.reserve(shardCount - 1);
+    for (size_t i = 1; i < shardCount; ++i)
+    {
+        _shardThreads.emplace_back(
+            [this, i](std::stop_token stopToken)
+            {
+                RunShard(stopToken, i);
+            }
+        );
+    }
+
+    LOG_INFO("ShardedDispatcher Initialized with {} shards. (Wait: {})", shardCount, ToString(waitPolicy));
+}
+
+ShardedDispatcherImpl::~ShardedDispatcherImpl()
+{
+    Shutdown();
+
+    // [Lifetime] Join shard threads before the shards themselves are destroyed
+    _shardThreads.clear();
+}
+
+void ShardedDispatcherImpl::PinShardThreads(const std::vector<int> &cpus)
+{
+    if (cpus.empty())
+        return;
+
+    for (size_t i = 0; i < _shardThreads.size(); ++i)
+    {
+        size_t shard = i + 1;
+        int cpu = cpus[shard % cpus.size()];
+        if (CpuTopology::PinThread(_shardThreads[i].native_handle(), {cpu}))
+            LOG_INFO("[Affinity] Dispatcher Shard #{} -> CPU {} (Node {})", shard, cpu, CpuTopology::GetNodeOfCpu(cpu));
+        else
+            LOG_WARN("[Affinity] Dispatcher Shard #{} -> CPU {} failed", shard, cpu);
+    }
+}
+
+void ShardedDispatcherImpl::RunShard(std::stop_token stopToken, size_t index)
+{
+    DispatcherImpl &shard = *_shards[index];
+    while (!stopToken.stop_requested())
+    {
+        if (!shard.Process())
+        {
+            shard.Wait(10);
+        }
+    }
+}
+
+void ShardedDispatcherImpl::Post(IMessage *message)
+{
+    // [Affinity] Session messages stay on one shard so per-session ordering holds.
+    // Session-less messages (Timer, Lambda Job) go to Shard 0.
+    if (message->session != nullptr)
+    {
+        ShardFor(message->sessionId).Post(message);
+        return;
+    }
+
+    _shards[0]->Post(message);
+}
+
+bool ShardedDispatcherImpl::Process()
+{
+    return _shards[0]->Process();
+}
+
+void ShardedDispatcherImpl::Wait(int timeoutMs)
+{
+    _shards[0]->Wait(timeoutMs);
+}
+
+size_t ShardedDispatcherImpl::GetQueueSize() const
+{
+    size_t total = 0;
+    for (const auto &shard : _shards)
+    {
+        total += shard->GetQueueSize();
+    }
+    return total;
+}
+
+bool ShardedDispatcherImpl::IsOverloaded() const
+{
+    // 하나의 샤드라도 과부하면 과부하로 판단 (Hot Shard 보호)
+    for (const auto &shard : _shards)
+    {
+        if (shard->IsOverloaded())
+            return true;
+    }
+    return false;
+}
+
+bool ShardedDispatcherImpl::IsRecovered() const
+{
+    for (const auto &shard : _shards)
+    {
+        if (!shard->IsRecovered())
+            return false;
+    }
+    return true;
+}
+
+size_t ShardedDispatcherImpl::GetQueueSize(DispatchLane lane) const
+{
+    size_t total = 0;
+    for (const auto &shard : _shards)
+    {
+        total += shard->GetQueueSize(lane);
+    }
+    return total;
+}
+
+bool ShardedDispatcherImpl::IsOverloaded(DispatchLane lane) const
+{
+    for (const auto &shard : _shards)
+    {
+        if (shard->IsOverloaded(lane))
+            return true;
+    }
+    return false;
+}
+
+bool ShardedDispatcherImpl::IsRecovered(DispatchLane lane) const
+{
+    for (const auto &shard : _shards)
+    {
+        if (!shard->IsRecovered(lane))
+            return false;
+    }
+    return true;
+}
+
+void ShardedDispatcherImpl::RegisterTimerHandler(ITimerHandler *handler)
+{
+    // Timer messages carry no session and are always routed to Shard 0
+    _shards[0]->RegisterTimerHandler(handler);
+}
+
+void ShardedDispatcherImpl::WithSession(uint64_t sessionId, SessionTask callback)
+{
+    // The owning shard executes immediately if we are already on its thread,
+    // otherwise it enqueues the callback onto its own queue.
+    ShardFor(sessionId).WithSession(sessionId, std::move(callback));
+}
+
+void ShardedDispatcherImpl::SendToSessions(std::span<const uint64_t> sessionIds, PacketPtr packet)
+{
+    if (_shards.size() == 1)
+    {
+        _shards[0]->SendToSessions(sessionIds, std::move(packet));
+        return;
+    }
+
+    // [Affinity] Group recipients by owning shard (thread-local scratch, no per-call allocation)
+    thread_local std::vector<std::vector<uint64_t>> t_buckets;
+    if (t_buckets.size() < _shards.size())
+        t_buckets.resize(_shards.size());
+
+    for (uint64_t sessionId : sessionIds)
+    {
+        t_buckets[sessionId % _shards.size()].push_back(sessionId);
+    }
+
+    for (size_t i = 0; i < _shards.size(); ++i)
+    {
+        if (!t_buckets[i].empty())
+        {
+            _shards[i]->SendToSessions(t_buckets[i], packet);
+            t_buckets[i].clear();
+        }
+    }
+}
+
+void ShardedDispatcherImpl::Push(DispatchTask task)
+{
+    _shards[0]->Push(std::move(task));
+}
+
+WaitStats ShardedDispatcherImpl::GetWaitStats() const
+{
+    WaitStats total;
+    for (const auto &shard : _shards)
+    {
+        WaitStats s = shard->GetWaitStats();
+        total.spinNs += s.spinNs;
+        total.parkNs += s.parkNs;
+        total.waits += s.waits;
+        total.wakeups += s.wakeups;
+        total.parks += s.parks;
+    }
+    return total;
+}
+
+void ShardedDispatcherImpl::Shutdown()
+{
+    for (auto &t : _shardThreads)
+    {
+        t.request_stop();
+    }
+
+    for (auto &shard : _shards)
+    {
+        shard->Shutdown();
+    }
+}
+
+} // namespace System
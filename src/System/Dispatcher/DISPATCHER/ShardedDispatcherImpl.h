@@ -0,0 +1,88 @@
+#pragma once
+
+#include "System/Dispatcher/DISPATCHER/DispatcherImpl.h"
+#include "System/Dispatcher/IDispatcher.h"
+#include "System/Dispatcher/IPacketHandler.h"
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace System {
+
+/**
+ * @brief N-Shard Dispatcher (Session Affinity Routing)
+ *
+ * 단일 로직 스레드가 전체 패킷 처리량의 상한이 되는 문제를 해결하기 위해
+ * DispatcherImpl을 N개의 샤드로 분할한다.
+ *
+ * - 각 샤드는 자신만의 Queue / _sessions / Owner Thread 를 가진다.
+ * - 세션 메시지는 (sessionId % N) 샤드로 라우팅되므로 세션 단위 순서가 보장된다.
+ * - 세션이 없는 메시지(Timer, Push된 Job)는 Shard 0 으로 간다.
+ * - Shard 0 은 Framework 메인 루프(Process/Wait)가 구동하고,
+ *   Shard 1..N-1 은 내부 전용 스레드가 구동한다.
+ *
+ * [Warning] N > 1 이면 IPacketHandler 가 여러 스레드에서 동시에 호출된다.
+ * 핸들러가 공유하는 게임 상태는 Strand 등으로 직렬화되어 있어야 한다.
+ */
+class ShardedDispatcherImpl : public IDispatcher
+{
+public:
+    ShardedDispatcherImpl(
+        std::shared_ptr<IPacketHandler> packetHandler, size_t shardCount,
+        WaitPolicy waitPolicy = WaitPolicy::ConditionVariable
+    );
+    virtual ~ShardedDispatcherImpl() override;
+
+    void Post(IMessage *message) override;
+
+    // Drives Shard 0 (Called by Framework Main Loop)
+    bool Process() override;
+    void Wait(int timeoutMs) override;
+
+    size_t GetQueueSize() const override;
+    bool IsOverloaded() const override;
+    bool IsRecovered() const override;
+
+    // Per-lane depth / overload state (over all shards)
+    size_t GetQueueSize(DispatchLane lane) const;
+    bool IsOverloaded(DispatchLane lane) const;
+    bool IsRecovered(DispatchLane lane) const;
+
+    void RegisterTimerHandler(ITimerHandler *handler) override;
+
+    // Session-safe access (Routed to the owning shard)
+    void WithSession(uint64_t sessionId, SessionTask callback) override;
+
+    // Batched Send (Recipients grouped per owning shard, one message per shard)
+    void SendToSessions(std::span<const uint64_t> sessionIds, PacketPtr packet) override;
+
+    // Generic Task Submission (Shard 0)
+    void Push(DispatchTask task) override;
+
+    // Graceful Shutdown
+    void Shutdown() override;
+
+    size_t GetShardCount() const
+    {
+        return _shards.size();
+    }
+
+    // Pin shard thread #i (1..N-1) to cpus[i % size]. Shard 0 belongs to the caller's thread.
+    void PinShardThreads(const std::vector<int> &cpus);
+
+    // Idle Wait Diagnostics (summed over all shards)
+    WaitStats GetWaitStats() const;
+
+private:
+    DispatcherImpl &ShardFor(uint64_t sessionId) const
+    {
+        return *_shards[sessionId % _shards.size()];
+    }
+
+    void RunShard(std::stop_token stopToken, size_t index);
+
+    std::vector<std::unique_ptr<DispatcherImpl>> _shards;
+    std::vector<std::jthread> _shardThreads;
+};
+
+} // namespace System
@@ -0,0 +1,152 @@
+#include "System/Dispatcher/DISPATCHER/WaitStrategy.h"
+#include <algorithm>
+#include <climits>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace System {
+
+WaitPolicy ParseWaitPolicy(std::string_view name)
+{
+    if (name == "spin")
+        return WaitPolicy::BusySpin;
+    if (name == "spin_yield")
+        return WaitPolicy::SpinYield;
+    if (name == "spin_park")
+        return WaitPolicy::SpinPark;
+    return WaitPolicy::ConditionVariable;
+}
+
+const char *ToString(WaitPolicy policy)
+{
+    switch (policy)
+    {
+    case WaitPolicy::BusySpin:
+        return "spin";
+    case WaitPolicy::SpinYield:
+        return "spin_yield";
+    case WaitPolicy::SpinPark:
+        return "spin_park";
+    case WaitPolicy::ConditionVariable:
+    default:
+        return "cv";
+    }
+}
+
+WaitStrategy::WaitStrategy(WaitPolicy policy, uint32_t spinCount) : _policy(policy), _spinCount(spinCount)
+{
+}
+
+void WaitStrategy::Notify()
+{
+    switch (_policy)
+    {
+    case WaitPolicy::BusySpin:
+    case WaitPolicy::SpinYield:
+        // Consumer never sleeps in the kernel -> nothing to wake
+        break;
+
+    case WaitPolicy::SpinPark:
+        // Enqueue 와 _waitingCount 읽기 사이의 Store-Load 재배치 방지 (Park() 의 seq_cst 와 짝)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_waitingCount.load(std::memory_order_relaxed) > 0)
+        {
+            WakeEpoch(false);
+        }
+        break;
+
+    case WaitPolicy::ConditionVariable:
+    default:
+        // [Optimization] Smart Notify
+        // Only notify if there are threads actually waiting in Wait()
+        if (_waitingCount.load(std::memory_order_relaxed) > 0)
+        {
+            _cv.notify_one();
+        }
+        break;
+    }
+}
+
+void WaitStrategy::NotifyAll()
+{
+    WakeEpoch(true);
+    _cv.notify_all();
+}
+
+WaitStats WaitStrategy::GetStats() const
+{
+    WaitStats stats;
+    stats.spinNs = _spinNs.load(std::memory_order_relaxed);
+    stats.parkNs = _parkNs.load(std::memory_order_relaxed);
+    stats.waits = _waits.load(std::memory_order_relaxed);
+    stats.wakeups = _wakeups.load(std::memory_order_relaxed);
+    stats.parks = _parks.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void WaitStrategy::CpuRelax()
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+void WaitStrategy::ParkOnEpoch(uint32_t expected, Clock::time_point deadline)
+{
+    while (_epoch.load(std::memory_order_acquire) == expected)
+    {
+        auto now = Clock::now();
+        if (now >= deadline)
+            return;
+
+        auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now);
+
+#if defined(_WIN32)
+        DWORD ms = static_cast<DWORD>((remaining.count() + 999999) / 1000000);
+        WaitOnAddress(&_epoch, &expected, sizeof(expected), ms);
+#elif defined(__linux__)
+        timespec ts;
+        ts.tv_sec = static_cast<time_t>(remaining.count() / 1000000000);
+        ts.tv_nsec = static_cast<long>(remaining.count() % 1000000000);
+        syscall(SYS_futex, reinterpret_cast<uint32_t *>(&_epoch), FUTEX_WAIT_PRIVATE, expected, &ts, nullptr, 0);
+#else
+        // No address-wait primitive: fall back to the condition variable with a short timeout
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait_for(lock, std::min(remaining, std::chrono::nanoseconds(std::chrono::milliseconds(1))));
+#endif
+    }
+}
+
+void WaitStrategy::WakeEpoch(bool all)
+{
+    _epoch.fetch_add(1, std::memory_order_release);
+
+#if defined(_WIN32)
+    if (all)
+        WakeByAddressAll(&_epoch);
+    else
+        WakeByAddressSingle(&_epoch);
+#elif defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(&_epoch), FUTEX_WAKE_PRIVATE, all ? INT_MAX : 1, nullptr, nullptr, 0);
+#else
+    if (all)
+        _cv.notify_all();
+    else
+        _cv.notify_one();
+#endif
+}
+
+} // namespace System
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <thread>
+
+namespace System {
+
+/**
+ * @brief Logic Loop 의 Idle 대기 방식
+ *
+ * - ConditionVariable: 기존 방식 (mutex + cv.wait_for, Smart Notify)
+ * - BusySpin:          타임아웃까지 계속 스핀 (최저 지연, 코어 1개 점유)
+ * - SpinYield:         일정 횟수 스핀 후 yield 반복
+ * - SpinPark:          일정 횟수 스핀 후 futex(WaitOnAddress) 로 파킹
+ */
+enum class WaitPolicy : uint8_t
+{
+    ConditionVariable = 0,
+    BusySpin,
+    SpinYield,
+    SpinPark,
+};
+
+// Config 문자열 ("cv", "spin", "spin_yield", "spin_park") -> WaitPolicy (알 수 없으면 ConditionVariable)
+WaitPolicy ParseWaitPolicy(std::string_view name);
+const char *ToString(WaitPolicy policy);
+
+// 누적 통계 (Wait 호출 스레드가 기록, 어느 스레드에서든 읽기 가능)
+struct WaitStats
+{
+    uint64_t spinNs = 0;   // 스핀/yield 로 소비한 시간
+    uint64_t parkNs = 0;   // 커널(cv/futex)에서 잠든 시간
+    uint64_t waits = 0;    // Wait() 호출 수
+    uint64_t wakeups = 0;  // 작업이 생겨서 깨어난 횟수 (타임아웃 제외)
+    uint64_t parks = 0;    // 실제로 커널 대기에 들어간 횟수
+};
+
+/**
+ * @brief DispatcherImpl 의 Wait()/Post() 알림 로직
+ *
+ * Wait() 는 Consumer(로직 스레드) 하나에서만 호출된다고 가정한다.
+ * Notify() 는 Post() 직후 임의의 Producer 스레드에서 호출된다.
+ */
+class WaitStrategy
+{
+public:
+    static constexpr uint32_t DEFAULT_SPIN_COUNT = 4000;
+
+    explicit WaitStrategy(WaitPolicy policy = WaitPolicy::ConditionVariable, uint32_t spinCount = DEFAULT_SPIN_COUNT);
+
+    // hasWork() 가 true 가 되거나 timeoutMs 가 지나면 반환
+    template <typename Pred> void Wait(int timeoutMs, Pred hasWork);
+
+    // Producer: 메시지 Enqueue 후 호출
+    void Notify();
+    // Shutdown: 대기 중인 모든 스레드를 깨움
+    void NotifyAll();
+
+    WaitPolicy GetPolicy() const
+    {
+        return _policy;
+    }
+    WaitStats GetStats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    template <typename Pred> bool Spin(Clock::time_point deadline, Pred &hasWork, bool untilDeadline);
+    template <typename Pred> bool Park(Clock::time_point deadline, Pred &hasWork);
+
+    void ParkOnEpoch(uint32_t expected, Clock::time_point deadline);
+    void WakeEpoch(bool all);
+    static void CpuRelax();
+
+    void Record(std::atomic<uint64_t> &counter, uint64_t value)
+    {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    const WaitPolicy _policy;
+    const uint32_t _spinCount;
+
+    // [ConditionVariable / SpinPark] Smart Notify: 대기 중인 스레드가 있을 때만 깨움
+    std::atomic<int32_t> _waitingCount{0};
+    std::mutex _mutex;
+    std::condition_variable _cv;
+
+    // [SpinPark] futex word (Notify 마다 증가)
+    std::atomic<uint32_t> _epoch{0};
+
+    std::atomic<uint64_t> _spinNs{0};
+    std::atomic<uint64_t> _parkNs{0};
+    std::atomic<uint64_t> _waits{0};
+    std::atomic<uint64_t> _wakeups{0};
+    std::atomic<uint64_t> _parks{0};
+};
+
+template <typename Pred> void WaitStrategy::Wait(int timeoutMs, Pred hasWork)
+{
+    Record(_waits, 1);
+    const auto deadline = Clock::now() + std::chrono::milliseconds(timeoutMs);
+
+    bool woke = false;
+    switch (_policy)
+    {
+    case WaitPolicy::BusySpin:
+    case WaitPolicy::SpinYield:
+        woke = Spin(deadline, hasWork, true);
+        break;
+
+    case WaitPolicy::SpinPark:
+        woke = Spin(deadline, hasWork, false) || Park(deadline, hasWork);
+        break;
+
+    case WaitPolicy::ConditionVariable:
+    default:
+        woke = Park(deadline, hasWork);
+        break;
+    }
+
+    if (woke)
+        Record(_wakeups, 1);
+}
+
+template <typename Pred> bool WaitStrategy::Spin(Clock::time_point deadline, Pred &hasWork, bool untilDeadline)
+{
+    const auto start = Clock::now();
+    bool found = false;
+
+    for (uint32_t i = 0;; ++i)
+    {
+        if (hasWork())
+        {
+            found = true;
+            break;
+        }
+
+        if (!untilDeadline && i >= _spinCount)
+            break;
+
+        // Clock 호출 비용을 줄이기 위해 64회마다 데드라인 확인
+        if ((i & 63) == 63 && Clock::now() >= deadline)
+            break;
+
+        if (_policy == WaitPolicy::SpinYield && i >= _spinCount)
+            std::this_thread::yield();
+        else
+            CpuRelax();
+    }
+
+    Record(_spinNs, std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    return found;
+}
+
+template <typename Pred> bool WaitStrategy::Park(Clock::time_point deadline, Pred &hasWork)
+{
+    const auto start = Clock::now();
+    bool found = false;
+
+    if (_policy == WaitPolicy::SpinPark)
+    {
+        // [EventCount] epoch 를 먼저 읽고 작업을 재확인한 뒤 파킹 -> Notify 유실 방지
+        uint32_t epoch = _epoch.load(std::memory_order_acquire);
+        _waitingCount.fetch_add(1, std::memory_order_seq_cst);
+        found = hasWork();
+        if (!found)
+        {
+            Record(_parks, 1);
+            ParkOnEpoch(epoch, deadline);
+            found = hasWork();
+        }
+        _waitingCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        // [Optimization] Track waiting thread count to avoid unnecessary notify_one calls
+        _waitingCount.fetch_add(1, std::memory_order_relaxed);
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            Record(_parks, 1);
+            found = _cv.wait_until(lock, deadline, hasWork);
+        }
+        _waitingCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    Record(_parkNs, std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    return found;
+}
+
+} // namespace System
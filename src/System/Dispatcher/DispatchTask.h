@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace System {
+
+class SessionContext;
+
+/**
+ * @brief Move-only callable with inline (SBO) storage.
+ *
+ * std::function 은 캡처가 16바이트(libstdc++) / 비-trivially-copyable 이면 무조건 힙 할당을 한다.
+ * PacketPtr + sessionId 정도의 흔한 캡처는 Capacity 안에 그대로 저장되어 힙을 타지 않는다.
+ * Capacity 를 넘는 캡처만 힙으로 폴백한다 (기존 std::function 과 동일한 비용).
+ *
+ * - Move-only: 복사 불가 (PacketPtr 등 move-only 캡처 허용)
+ * - 빈 상태에서 호출 금지 (operator bool 로 확인)
+ */
+template <typename Signature, size_t Capacity = 64> class InlineFunction;
+
+template <typename R, typename... Args, size_t Capacity> class InlineFunction<R(Args...), Capacity>
+{
+public:
+    static constexpr size_t INLINE_CAPACITY = Capacity;
+
+    InlineFunction() noexcept = default;
+    InlineFunction(std::nullptr_t) noexcept
+    {
+    }
+
+    template <
+        typename F,
+        typename = std::enable_if_t<
+            !std::is_same_v<std::decay_t<F>, InlineFunction> && std::is_invocable_r_v<R, std::decay_t<F> &, Args...>>>
+    InlineFunction(F &&f)
+    {
+        using Fn = std::decay_t<F>;
+        if constexpr (IsStoredInline<Fn>())
+        {
+            ::new (static_cast<void *>(_storage)) Fn(std::forward<F>(f));
+            _ops = &InlineOps<Fn>::Table;
+        }
+        else
+        {
+            // [Fallback] Oversized capture -> Heap (same cost as std::function)
+            *reinterpret_cast<Fn **>(_storage) = new Fn(std::forward<F>(f));
+            _ops = &HeapOps<Fn>::Table;
+        }
+    }
+
+    InlineFunction(InlineFunction &&other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    InlineFunction &operator=(InlineFunction &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    InlineFunction &operator=(std::nullptr_t) noexcept
+    {
+        Reset();
+        return *this;
+    }
+
+    InlineFunction(const InlineFunction &) = delete;
+    InlineFunction &operator=(const InlineFunction &) = delete;
+
+    ~InlineFunction()
+    {
+        Reset();
+    }
+
+    R operator()(Args... args) const
+    {
+        return _ops->invoke(const_cast<unsigned char *>(_storage), std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return _ops != nullptr;
+    }
+
+    // true if the callable lives in the inline buffer (no heap allocation)
+    bool IsInline() const noexcept
+    {
+        return _ops != nullptr && _ops->isInline;
+    }
+
+    void Reset() noexcept
+    {
+        if (_ops != nullptr)
+        {
+            _ops->destroy(_storage);
+            _ops = nullptr;
+        }
+    }
+
+    template <typename Fn> static constexpr bool IsStoredInline()
+    {
+        return sizeof(Fn) <= Capacity && alignof(Fn) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible_v<Fn>;
+    }
+
+private:
+    struct Ops
+    {
+        R (*invoke)(void *storage, Args &&...args);
+        void (*move)(void *dst, void *src) noexcept;
+        void (*destroy)(void *storage) noexcept;
+        bool isInline;
+    };
+
+    template <typename Fn> struct InlineOps
+    {
+        static R Invoke(void *storage, Args &&...args)
+        {
+            return (*static_cast<Fn *>(storage))(std::forward<Args>(args)...);
+        }
+        static void Move(void *dst, void *src) noexcept
+        {
+            Fn *from = static_cast<Fn *>(src);
+            ::new (dst) Fn(std::move(*from));
+            from->~Fn();
+        }
+        static void Destroy(void *storage) noexcept
+        {
+            static_cast<Fn *>(storage)->~Fn();
+        }
+        static constexpr Ops Table{&Invoke, &Move, &Destroy, true};
+    };
+
+    template <typename Fn> struct HeapOps
+    {
+        static R Invoke(void *storage, Args &&...args)
+        {
+            return (**static_cast<Fn **>(storage))(std::forward<Args>(args)...);
+        }
+        static void Move(void *dst, void *src) noexcept
+        {
+            *static_cast<Fn **>(dst) = *static_cast<Fn **>(src);
+        }
+        static void Destroy(void *storage) noexcept
+        {
+            delete *static_cast<Fn **>(storage);
+        }
+        static constexpr Ops Table{&Invoke, &Move, &Destroy, false};
+    };
+
+    void MoveFrom(InlineFunction &other) noexcept
+    {
+        if (other._ops != nullptr)
+        {
+            other._ops->move(_storage, other._storage);
+            _ops = other._ops;
+            other._ops = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char _storage[Capacity];
+    const Ops *_ops = nullptr;
+};
+
+// [Dispatcher] Push() 용 작업 / WithSession() 용 콜백
+using DispatchTask = InlineFunction<void()>;
+using SessionTask = InlineFunction<void(SessionContext &)>;
+
+} // namespace System
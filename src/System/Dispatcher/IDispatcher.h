@@ -1,7 +1,9 @@
 #pragma once
 
+#include "System/Dispatcher/DispatchTask.h"
 #include "System/Dispatcher/IMessage.h"
-#include <functional>
+#include "System/Packet/PacketPtr.h"
+#include <span>
 
 namespace System {
 struct ITimerHandler;
@@ -20,14 +22,18 @@ public:
     virtual bool IsRecovered() const = 0;
 
     // Session-safe access
-    virtual void WithSession(uint64_t sessionId, std::function<void(SessionContext &)> callback) = 0;
+    // [Optimization] SessionTask/DispatchTask are move-only inline callables (no heap for small captures)
+    virtual void WithSession(uint64_t sessionId, SessionTask callback) = 0;
+
+    // Batched Send: one queue operation for all recipients, packet shared by refcount
+    virtual void SendToSessions(std::span<const uint64_t> sessionIds, PacketPtr packet) = 0;
 
     // System Handlers
     // System Handlers
     virtual void RegisterTimerHandler(ITimerHandler *handler) = 0;
 
     // Generic Task Submission
-    virtual void Push(std::function<void()> task) = 0;
+    virtual void Push(DispatchTask task) = 0;
 
     // Graceful Shutdown
     virtual void Shutdown() = 0;
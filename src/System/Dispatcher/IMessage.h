@@ -1,7 +1,8 @@
 #pragma once
 
+#include "System/Dispatcher/DispatchTask.h"
+#include <atomic>
 #include <cstdint>
-#include <functional> // Added
 #include <memory>
 
 namespace System {
@@ -23,10 +24,41 @@ enum class MessageType {
     LOGIC_TIMER_CANCEL,
     LOGIC_TIMER_TICK,
 
+    SESSION_JOB, // WithSession() callback queued from a foreign thread
+
     // User defined messages start here or after reserved range
-    PACKET = 10
+    PACKET = 10,
+
+    // System messages added after the 0~9 reserved range filled up
+    SESSION_MULTICAST = 100, // SendToSessions(): one packet fanned out to many sessions
+    NETWORK_DATA_REF,        // Inbound frame still in the shared receive block (zero-copy, PacketRefMessage)
+};
+
+// Dispatcher priority lane (High: timer, Normal: session lifecycle/packets/jobs)
+enum class DispatchLane {
+    High = 0,
+    Normal,
+    Count
 };
 
+// [Ordering] FIFO holds only within a lane. Everything addressed to one session (CONNECT, NETWORK_DATA,
+// SESSION_JOB, SESSION_MULTICAST, DISCONNECT) shares the Normal lane so it is handled in posting order:
+// a High CONNECT posted between the High drain and the Normal slice would run after its own DISCONNECT
+// and leave a stale id in the session table.
+inline DispatchLane LaneOf(MessageType type)
+{
+    switch (type)
+    {
+    case MessageType::LOGIC_TIMER_EXPIRED:
+    case MessageType::LOGIC_TIMER_ADD:
+    case MessageType::LOGIC_TIMER_CANCEL:
+    case MessageType::LOGIC_TIMER_TICK:
+        return DispatchLane::High;
+    default:
+        return DispatchLane::Normal;
+    }
+}
+
 // [New Architecture: Single Allocation Polymorphism]
 struct IMessage
 {
@@ -51,6 +83,9 @@ struct IMessage
     uint64_t sessionId;
     ISession *session = nullptr; // Changed from Session* to support GatewaySession/BackendSession
     bool isPooled = true;        // [Hybrid Strategy] Added to distinguish pool allocation
+    uint8_t sizeLevel = 0;       // [MessagePool] Size class of the pooled block (set on allocation)
+    uint8_t homeNode = 0;        // [MessagePool] NUMA pool node the block was carved on
+    uint32_t allocThread = 0;    // [MessagePool] Allocating thread tag (cross-thread free statistics)
 };
 
 struct EventMessage : public IMessage
@@ -68,9 +103,20 @@ struct LambdaMessage : public IMessage
     LambdaMessage()
     {
         type = MessageType::LAMBDA_JOB;
-        isPooled = false; // [Hybrid Strategy] Small objects are system allocated
+        isPooled = false; // MessagePool::AllocateLambda() marks pooled instances
     }
-    std::function<void()> task;
+    DispatchTask task;
+};
+
+// Deferred WithSession() callback (session is resolved on the dispatcher thread)
+struct SessionLambdaMessage : public IMessage
+{
+    SessionLambdaMessage()
+    {
+        type = MessageType::SESSION_JOB;
+        isPooled = false;
+    }
+    SessionTask task;
 };
 
 struct PacketMessage : public IMessage
@@ -79,6 +125,7 @@ struct PacketMessage : public IMessage
     {
         type = MessageType::PACKET;
     }
+    uint32_t heapSize = 0; // [MessagePool] Allocation size of a heap-fallback packet (HEAP_LEVEL only)
     uint16_t length;
     uint8_t data[1]; // Flexible Array Member
 
@@ -114,4 +161,39 @@ struct PacketMessage : public IMessage
         return sizeof(PacketMessage) + bodySize;
     }
 };
+
+// Zero-copy inbound frame: points into a refcounted RecvBuffer block instead of carrying a copy.
+// The block reference is dropped when the message is freed (destructor in MessagePool.cpp).
+struct PacketRefMessage : public IMessage
+{
+    PacketRefMessage()
+    {
+        type = MessageType::NETWORK_DATA_REF;
+    }
+    ~PacketRefMessage() override;
+
+    uint8_t *block = nullptr;       // RecvBuffer::RetainBlock() reference
+    const uint8_t *frame = nullptr; // PacketHeader + body, inside block
+    uint16_t length = 0;
+};
+
+// One shared packet + recipient list (IDispatcher::SendToSessions)
+// Replaces N WithSession() closures with a single queue operation.
+struct MulticastMessage : public IMessage
+{
+    MulticastMessage()
+    {
+        type = MessageType::SESSION_MULTICAST;
+    }
+    ~MulticastMessage() override; // Releases packet if the message is freed before fan-out
+
+    PacketMessage *packet = nullptr; // Holds one reference; the dispatcher takes it over and nulls this at fan-out
+    uint16_t count = 0;
+    uint64_t sessionIds[1]; // Flexible Array Member
+
+    static size_t CalculateAllocSize(uint16_t recipientCount)
+    {
+        return sizeof(MulticastMessage) + (recipientCount > 0 ? recipientCount - 1 : 0) * sizeof(uint64_t);
+    }
+};
 } // namespace System
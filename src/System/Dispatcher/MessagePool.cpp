@@ -1,146 +1,376 @@
 #include "System/Dispatcher/MessagePool.h"
 #include "System/Dispatcher/SystemMessages.h"
 #include "System/Metrics/IMetrics.h"
+#include "System/Network/RecvBuffer.h"
 #include "System/Pch.h"
+#include <bit>
+#include <cstdlib>
 #include <new> // for placement new
 #include <vector>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 namespace System {
 
 std::atomic<int> MessagePool::_poolSize = 0;
-moodycamel::ConcurrentQueue<void *> *MessagePool::_smallPool = new moodycamel::ConcurrentQueue<void *>();
-moodycamel::ConcurrentQueue<void *> *MessagePool::_mediumPool = new moodycamel::ConcurrentQueue<void *>();
-moodycamel::ConcurrentQueue<void *> *MessagePool::_largePool = new moodycamel::ConcurrentQueue<void *>();
+moodycamel::ConcurrentQueue<MessagePool::Magazine *>
+    *MessagePool::_fullDepot[MessagePool::NODE_COUNT][MessagePool::LEVEL_COUNT] = {};
+moodycamel::ConcurrentQueue<MessagePool::Magazine *> *MessagePool::_emptyDepot[MessagePool::LEVEL_COUNT] = {};
+
+// Depot queues are created once and never destroyed (thread caches return magazines at thread exit)
+const bool MessagePool::_depotsReady = []()
+{
+    for (size_t i = 0; i < LEVEL_COUNT; ++i)
+    {
+        for (size_t node = 0; node < NODE_COUNT; ++node)
+            _fullDepot[node][i] = new moodycamel::ConcurrentQueue<Magazine *>();
+        _emptyDepot[i] = new moodycamel::ConcurrentQueue<Magazine *>();
+    }
+    return true;
+}();
+
+// [Slab] Per-level bump cursor (carving happens once per CARVE_BATCH blocks -> plain mutex)
+struct SlabCursor
+{
+    std::mutex mutex;
+    uint8_t *cursor = nullptr;
+    size_t remaining = 0; // blocks left in the current slab
+};
+
+static SlabCursor s_slabCursors[MessagePool::NODE_COUNT][MessagePool::LEVEL_COUNT];
+static std::atomic<size_t> s_slabBytes{0};
+static std::atomic<HugePageMode> s_hugePageMode{HugePageMode::None};
+
+// [Budget] Byte accounting (updated on magazine exchange / heap alloc only, never per pooled alloc)
+static std::atomic<size_t> s_depotBytes{0};
+static std::atomic<size_t> s_depotBlocks[MessagePool::NODE_COUNT][MessagePool::LEVEL_COUNT] = {};
+static std::atomic<size_t> s_heapBytes{0};
+static std::atomic<size_t> s_softLimitBytes{0};
+static std::atomic<size_t> s_hardLimitBytes{0};
+
+// Pool miss: blocks moved from the slab into the thread magazine at once
+static constexpr size_t CARVE_BATCH = 64;
+
+HugePageMode ParseHugePageMode(std::string_view name)
+{
+    if (name == "thp")
+        return HugePageMode::Transparent;
+    if (name == "hugetlb")
+        return HugePageMode::HugeTlb;
+    return HugePageMode::None;
+}
 
 int MessagePool::GetPoolSize()
 {
     return _poolSize.load();
 }
 
+// [Metrics] Handles resolved once (GetCounter() is a locked map lookup)
+static const char *LEVEL_NAMES[MessagePool::LEVEL_COUNT] = {
+    "64b", "128b", "256b", "512b", "1kb", "2kb", "4kb", "8kb", "16kb", "task",
+};
+
+struct PoolCounters
+{
+    std::vector<CounterHandle> alloc; // AllocatePacket body size distribution (per packet class)
+    std::vector<CounterHandle> hit;   // Per-level depot statistics
+    std::vector<CounterHandle> miss;
+    std::vector<CounterHandle> crossThreadFree;
+    CounterHandle allocOver16kb{"msgpool_alloc_over16kb"};
+    CounterHandle allocHeap{"msgpool_alloc_heap"};
+    CounterHandle heapBytes{"msgpool_heap_bytes"};
+    CounterHandle shedOptional{"msgpool_budget_shed_optional"}; // Soft limit: optional allocations dropped
+    CounterHandle budgetReject{"msgpool_budget_reject"};        // Hard limit: normal allocations refused
+
+    PoolCounters()
+    {
+        for (size_t i = 0; i < MessagePool::LEVEL_COUNT; ++i)
+        {
+            if (i < MessagePool::PACKET_CLASS_COUNT)
+                alloc.emplace_back(std::string("msgpool_alloc_") + LEVEL_NAMES[i]);
+            hit.emplace_back(std::string("msgpool_depot_hit_") + LEVEL_NAMES[i]);
+            miss.emplace_back(std::string("msgpool_depot_miss_") + LEVEL_NAMES[i]);
+            crossThreadFree.emplace_back(std::string("msgpool_cross_thread_free_") + LEVEL_NAMES[i]);
+        }
+    }
+};
+
+static PoolCounters &GetPoolCounters()
+{
+    static PoolCounters counters;
+    return counters;
+}
+
+static std::atomic<uint32_t> s_nextThreadTag{1};
+
 struct L1Cache
 {
-    std::vector<void *> smallBuffer;
-    std::vector<void *> mediumBuffer;
-    std::vector<void *> largeBuffer;
+    // [Magazine] loaded: alloc/free 대상, previous: 한 번 더 버퍼링 (alloc/free 가 경계에서 진동할 때 Depot 왕복 방지)
+    MessagePool::Magazine *loaded[MessagePool::LEVEL_COUNT] = {};
+    MessagePool::Magazine *previous[MessagePool::LEVEL_COUNT] = {};
+
+    // [NUMA] 다른 노드에서 잘라낸 블록의 해제분 -> 꽉 차면 그 노드의 Depot 으로 반납
+    MessagePool::Magazine *remote[MessagePool::NODE_COUNT][MessagePool::LEVEL_COUNT] = {};
+
+    // 다른 스레드가 할당한 블록을 해제한 횟수 (Depot 교환 시 Counter 로 반영 -> Free 마다 공유 atomic 을 건드리지 않음)
+    uint64_t crossThreadFrees[MessagePool::LEVEL_COUNT] = {};
 
-    L1Cache()
+    uint32_t threadTag = s_nextThreadTag.fetch_add(1, std::memory_order_relaxed);
+
+    // Pool node fixed at the thread's first allocation (pin the thread before it touches the pool)
+    size_t node = CpuTopology::GetCurrentPoolNode();
+
+    void FlushStats(size_t level)
+    {
+        if (crossThreadFrees[level] > 0)
+        {
+            GetPoolCounters().crossThreadFree[level].Increment(crossThreadFrees[level]);
+            crossThreadFrees[level] = 0;
+        }
+    }
+
+    static void Return(size_t home, size_t level, MessagePool::Magazine *mag)
     {
-        smallBuffer.reserve(MessagePool::L1_CACHE_SIZE);
-        mediumBuffer.reserve(MessagePool::L1_CACHE_SIZE);
-        largeBuffer.reserve(MessagePool::L1_CACHE_SIZE);
+        if (mag == nullptr)
+            return;
+        if (mag->count > 0)
+            MessagePool::DepositToDepot(home, level, mag);
+        else
+            MessagePool::_emptyDepot[level]->enqueue(mag);
+    }
+
+    // Thread exit: return cached blocks to the depot instead of leaking them
+    ~L1Cache()
+    {
+        for (size_t level = 0; level < MessagePool::LEVEL_COUNT; ++level)
+        {
+            FlushStats(level);
+            for (MessagePool::Magazine *mag : {loaded[level], previous[level]})
+            {
+                Return(node, level, mag);
+            }
+            for (size_t home = 0; home < MessagePool::NODE_COUNT; ++home)
+            {
+                Return(home, level, remote[home][level]);
+            }
+        }
     }
 };
 
 static thread_local L1Cache t_l1;
 
-PacketMessage *MessagePool::AllocatePacket(uint16_t bodySize)
+template <typename T> T *MessagePool::Construct(void *block, size_t sizeLevel)
 {
-    // [Metrics] Record sizing distribution
-    if (bodySize <= 64)
-        GetMetrics().GetCounter("msgpool_alloc_64b")->Increment();
-    else if (bodySize <= 128)
-        GetMetrics().GetCounter("msgpool_alloc_128b")->Increment();
-    else if (bodySize <= 256)
-        GetMetrics().GetCounter("msgpool_alloc_256b")->Increment();
-    else if (bodySize <= 512)
-        GetMetrics().GetCounter("msgpool_alloc_512b")->Increment();
-    else if (bodySize <= 1024)
-        GetMetrics().GetCounter("msgpool_alloc_1kb")->Increment();
-    else if (bodySize <= 2048)
-        GetMetrics().GetCounter("msgpool_alloc_2kb")->Increment();
-    else if (bodySize <= 4096)
-        GetMetrics().GetCounter("msgpool_alloc_4kb")->Increment();
-    else if (bodySize <= 8192)
-        GetMetrics().GetCounter("msgpool_alloc_8kb")->Increment();
-    else if (bodySize <= 16384)
-        GetMetrics().GetCounter("msgpool_alloc_16kb")->Increment();
-    else
-        GetMetrics().GetCounter("msgpool_alloc_over16kb")->Increment();
-
-    size_t sizeLevel = 0; // 0: Small, 1: Medium, 2: Large
-    if (bodySize <= SMALL_BODY_SIZE)
-        sizeLevel = 0;
-    else if (bodySize <= MEDIUM_BODY_SIZE)
-        sizeLevel = 1;
-    else if (bodySize <= LARGE_BODY_SIZE)
-        sizeLevel = 2;
-    else
+    T *msg = new (block) T();
+    msg->isPooled = true;
+    msg->sizeLevel = static_cast<uint8_t>(sizeLevel);
+    msg->allocThread = t_l1.threadTag;
+    msg->homeNode = static_cast<uint8_t>(t_l1.node);
+    return msg;
+}
+
+size_t MessagePool::ClassOfBody(size_t bodySize)
+{
+    if (bodySize <= ClassBodySize(0))
+        return 0;
+    size_t level = static_cast<size_t>(std::bit_width(bodySize - 1)) - MIN_BODY_SHIFT;
+    return level < PACKET_CLASS_COUNT ? level : PACKET_CLASS_COUNT;
+}
+
+size_t MessagePool::ClassOfAllocSize(size_t allocSize)
+{
+    for (size_t level = 0; level < PACKET_CLASS_COUNT; ++level)
     {
-        // OS Heap Fallback for extremely large packets
-        GetMetrics().GetCounter("msgpool_alloc_heap")->Increment();
-        GetMetrics().GetCounter("msgpool_heap_bytes")->Increment(bodySize);
+        if (ClassBlockSize(level) >= allocSize)
+            return level;
+    }
+    return PACKET_CLASS_COUNT;
+}
+
+PacketMessage *MessagePool::AllocatePacket(uint16_t bodySize, AllocPriority priority)
+{
+    PoolCounters &counters = GetPoolCounters();
+
+    // [Budget] Soft limit: optional traffic is shed before it takes any memory
+    if (priority == AllocPriority::Optional && IsOverSoftLimit())
+    {
+        counters.shedOptional.Increment();
+        return nullptr;
+    }
 
+    const bool enforceBudget = priority != AllocPriority::Critical;
+    size_t sizeLevel = ClassOfBody(bodySize);
+
+    if (sizeLevel == PACKET_CLASS_COUNT)
+    {
+        // [Budget] Hard limit: no heap fallback (caller applies backpressure instead)
+        if (enforceBudget && IsOverHardLimit())
+        {
+            counters.budgetReject.Increment();
+            return nullptr;
+        }
+
+        // OS Heap Fallback for extremely large packets
+        counters.allocOver16kb.Increment();
+        counters.allocHeap.Increment();
         size_t allocSize = PacketMessage::CalculateAllocSize(bodySize);
+        counters.heapBytes.Increment(allocSize); // Same quantity as s_heapBytes (header + body)
+
         void *block = ::operator new(allocSize);
         PacketMessage *msg = new (block) PacketMessage();
         msg->type = MessageType::PACKET;
         msg->length = bodySize;
         msg->isPooled = false;
+        msg->sizeLevel = HEAP_LEVEL;
+        msg->heapSize = static_cast<uint32_t>(allocSize);
+
+        s_heapBytes.fetch_add(allocSize, std::memory_order_relaxed);
+        PublishBudget();
         return msg;
     }
 
-    void *block = PopBlock(sizeLevel);
+    // [Metrics] Record sizing distribution
+    counters.alloc[sizeLevel].Increment();
+
+    void *block = PopBlock(sizeLevel, enforceBudget);
     if (!block)
+    {
+        counters.budgetReject.Increment();
         return nullptr;
+    }
 
-    PacketMessage *msg = new (block) PacketMessage();
+    PacketMessage *msg = Construct<PacketMessage>(block, sizeLevel);
     msg->type = MessageType::PACKET;
     msg->length = bodySize;
-    msg->isPooled = true;
 
     return msg;
 }
 
 EventMessage *MessagePool::AllocateEvent()
 {
-    // Event messages are typically small, so use the small pool (sizeLevel 0)
-    void *block = PopBlock(0);
+    static const size_t sizeLevel = ClassOfAllocSize(sizeof(EventMessage));
+    void *block = PopBlock(sizeLevel);
     if (!block)
         return nullptr;
-    EventMessage *msg = new (block) EventMessage();
+    EventMessage *msg = Construct<EventMessage>(block, sizeLevel);
     return msg;
 }
 
+LambdaMessage *MessagePool::AllocateLambda()
+{
+    void *block = PopBlock(TASK_LEVEL);
+    return Construct<LambdaMessage>(block, TASK_LEVEL);
+}
+
+SessionLambdaMessage *MessagePool::AllocateSessionLambda()
+{
+    void *block = PopBlock(TASK_LEVEL);
+    return Construct<SessionLambdaMessage>(block, TASK_LEVEL);
+}
+
+PacketRefMessage *MessagePool::AllocatePacketRef(AllocPriority priority)
+{
+    static_assert(sizeof(PacketRefMessage) <= BLOCK_SIZE_TASK, "PacketRefMessage must fit a task block");
+
+    if (priority == AllocPriority::Optional && IsOverSoftLimit())
+    {
+        GetPoolCounters().shedOptional.Increment();
+        return nullptr;
+    }
+
+    void *block = PopBlock(TASK_LEVEL, priority != AllocPriority::Critical);
+    if (!block)
+    {
+        GetPoolCounters().budgetReject.Increment();
+        return nullptr;
+    }
+    return Construct<PacketRefMessage>(block, TASK_LEVEL);
+}
+
+PacketRefMessage::~PacketRefMessage()
+{
+    if (block)
+        RecvBuffer::ReleaseBlock(block);
+}
+
+MulticastMessage::~MulticastMessage()
+{
+    if (packet)
+    {
+        MessagePool::Free(packet);
+        packet = nullptr;
+    }
+}
+
+MulticastMessage *MessagePool::AllocateMulticast(uint16_t recipientCount)
+{
+    if (recipientCount == 0 || recipientCount > MAX_MULTICAST_RECIPIENTS)
+        return nullptr;
+
+    size_t sizeLevel = MulticastSizeLevel(recipientCount);
+    void *block = PopBlock(sizeLevel);
+    if (!block)
+        return nullptr;
+
+    MulticastMessage *msg = Construct<MulticastMessage>(block, sizeLevel);
+    msg->count = recipientCount;
+    return msg;
+}
+
+size_t MessagePool::MulticastSizeLevel(uint16_t recipientCount)
+{
+    return ClassOfAllocSize(MulticastMessage::CalculateAllocSize(recipientCount));
+}
+
+// Timer messages are small fixed-size structs -> smallest class that fits
+template <typename T> static size_t TimerLevel()
+{
+    static const size_t sizeLevel = MessagePool::ClassOfAllocSize(sizeof(T));
+    return sizeLevel;
+}
+
 TimerExpiredMessage *MessagePool::AllocateTimerExpired()
 {
-    // Timer messages are typically small, so use the small pool (sizeLevel 0)
-    void *block = PopBlock(0);
+    size_t sizeLevel = TimerLevel<TimerExpiredMessage>();
+    void *block = PopBlock(sizeLevel);
     if (!block)
         return nullptr;
-    TimerExpiredMessage *msg = new (block) TimerExpiredMessage();
+    TimerExpiredMessage *msg = Construct<TimerExpiredMessage>(block, sizeLevel);
     msg->type = MessageType::LOGIC_TIMER_EXPIRED;
     return msg;
 }
 
 TimerAddMessage *MessagePool::AllocateTimerAdd()
 {
-    // Timer messages are typically small, so use the small pool (sizeLevel 0)
-    void *block = PopBlock(0);
+    size_t sizeLevel = TimerLevel<TimerAddMessage>();
+    void *block = PopBlock(sizeLevel);
     if (!block)
         return nullptr;
-    TimerAddMessage *msg = new (block) TimerAddMessage();
+    TimerAddMessage *msg = Construct<TimerAddMessage>(block, sizeLevel);
     msg->type = MessageType::LOGIC_TIMER_ADD;
     return msg;
 }
 
 TimerCancelMessage *MessagePool::AllocateTimerCancel()
 {
-    // Timer messages are typically small, so use the small pool (sizeLevel 0)
-    void *block = PopBlock(0);
+    size_t sizeLevel = TimerLevel<TimerCancelMessage>();
+    void *block = PopBlock(sizeLevel);
     if (!block)
         return nullptr;
-    TimerCancelMessage *msg = new (block) TimerCancelMessage();
+    TimerCancelMessage *msg = Construct<TimerCancelMessage>(block, sizeLevel);
     msg->type = MessageType::LOGIC_TIMER_CANCEL;
     return msg;
 }
 
 TimerTickMessage *MessagePool::AllocateTimerTick()
 {
-    // Timer messages are typically small, so use the small pool (sizeLevel 0)
-    void *block = PopBlock(0);
+    size_t sizeLevel = TimerLevel<TimerTickMessage>();
+    void *block = PopBlock(sizeLevel);
     if (!block)
         return nullptr;
-    TimerTickMessage *msg = new (block) TimerTickMessage();
+    TimerTickMessage *msg = Construct<TimerTickMessage>(block, sizeLevel);
     msg->type = MessageType::LOGIC_TIMER_TICK;
     return msg;
 }
@@ -154,24 +384,24 @@ void MessagePool::Free(IMessage *msg)
     {
         if (!msg->isPooled)
         {
+            if (msg->sizeLevel == HEAP_LEVEL)
+            {
+                s_heapBytes.fetch_sub(static_cast<PacketMessage *>(msg)->heapSize, std::memory_order_relaxed);
+                PublishBudget();
+            }
             delete msg;
             return;
         }
 
-        size_t sizeLevel = 0; // Default to Small (Timers, Events)
-        if (msg->type == MessageType::PACKET)
+        size_t sizeLevel = msg->sizeLevel;
+        if (msg->allocThread != t_l1.threadTag)
         {
-            auto pkt = static_cast<PacketMessage *>(msg);
-            if (pkt->length <= SMALL_BODY_SIZE)
-                sizeLevel = 0;
-            else if (pkt->length <= MEDIUM_BODY_SIZE)
-                sizeLevel = 1;
-            else
-                sizeLevel = 2;
+            ++t_l1.crossThreadFrees[sizeLevel];
         }
 
+        size_t homeNode = msg->homeNode;
         msg->~IMessage();
-        PushBlock(static_cast<void *>(msg), sizeLevel);
+        PushBlock(static_cast<void *>(msg), sizeLevel, homeNode);
     }
 }
 
@@ -179,142 +409,337 @@ void MessagePool::FreeRaw(void *block)
 {
     if (block)
     {
-        // Default to Medium for raw blocks (historical compatibility)
-        PushBlock(block, 1);
+        // Default to the 4KB class for raw blocks (historical compatibility)
+        PushBlock(block, ClassOfBody(MEDIUM_BODY_SIZE), 0);
     }
 }
 
-void *MessagePool::PopBlock(size_t sizeLevel)
+size_t MessagePool::BlockSizeOf(size_t sizeLevel)
 {
-    std::vector<void *> *cache = nullptr;
-    moodycamel::ConcurrentQueue<void *> *targetPool = nullptr;
-    size_t blockSize = 0;
+    return sizeLevel == TASK_LEVEL ? BLOCK_SIZE_TASK : ClassBlockSize(sizeLevel);
+}
 
-    if (sizeLevel == 0)
-    {
-        cache = &t_l1.smallBuffer;
-        targetPool = _smallPool;
-        blockSize = BLOCK_SIZE_SMALL;
-    }
-    else if (sizeLevel == 1)
+MessagePool::Magazine *MessagePool::AcquireEmptyMagazine(size_t sizeLevel)
+{
+    Magazine *mag = nullptr;
+    if (_emptyDepot[sizeLevel]->try_dequeue(mag))
+        return mag;
+    return new Magazine();
+}
+
+void MessagePool::DepositToDepot(size_t node, size_t sizeLevel, Magazine *magazine)
+{
+    _poolSize.fetch_add((int)magazine->count, std::memory_order_relaxed);
+    s_depotBytes.fetch_add(magazine->count * BlockSizeOf(sizeLevel), std::memory_order_relaxed);
+    s_depotBlocks[node][sizeLevel].fetch_add(magazine->count, std::memory_order_relaxed);
+    _fullDepot[node][sizeLevel]->enqueue(magazine);
+}
+
+void MessagePool::WithdrawFromDepot(size_t node, size_t sizeLevel, Magazine *magazine)
+{
+    _poolSize.fetch_sub((int)magazine->count, std::memory_order_relaxed);
+    s_depotBytes.fetch_sub(magazine->count * BlockSizeOf(sizeLevel), std::memory_order_relaxed);
+    s_depotBlocks[node][sizeLevel].fetch_sub(magazine->count, std::memory_order_relaxed);
+}
+
+void *MessagePool::PopBlock(size_t sizeLevel, bool enforceBudget)
+{
+    Magazine *&loaded = t_l1.loaded[sizeLevel];
+    Magazine *&previous = t_l1.previous[sizeLevel];
+
+    // 1. Fast path: thread-local magazine
+    if (loaded != nullptr && loaded->count > 0)
+        return loaded->blocks[--loaded->count];
+
+    if (previous != nullptr && previous->count > 0)
     {
-        cache = &t_l1.mediumBuffer;
-        targetPool = _mediumPool;
-        blockSize = BLOCK_SIZE_MEDIUM;
+        std::swap(loaded, previous);
+        return loaded->blocks[--loaded->count];
     }
-    else
+
+    // 2. Both empty: exchange one empty magazine for a full one from the depot
+    Magazine *full = nullptr;
+    if (_fullDepot[t_l1.node][sizeLevel]->try_dequeue(full))
     {
-        cache = &t_l1.largeBuffer;
-        targetPool = _largePool;
-        blockSize = BLOCK_SIZE_LARGE;
+        GetPoolCounters().hit[sizeLevel].Increment();
+        t_l1.FlushStats(sizeLevel);
+        WithdrawFromDepot(t_l1.node, sizeLevel, full);
+        PublishBudget();
+
+        if (loaded != nullptr)
+        {
+            if (previous == nullptr)
+                previous = loaded;
+            else
+                _emptyDepot[sizeLevel]->enqueue(loaded);
+        }
+        loaded = full;
+        return loaded->blocks[--loaded->count];
     }
 
-    if (!cache->empty())
+    // 3. Depot miss: carve a batch from the level's slab (refused over the hard limit)
+    if (enforceBudget && IsOverHardLimit())
+        return nullptr;
+
+    GetPoolCounters().miss[sizeLevel].Increment();
+
+    if (loaded == nullptr)
+        loaded = AcquireEmptyMagazine(sizeLevel);
+    CarveSlab(t_l1.node, sizeLevel, loaded, CARVE_BATCH);
+    PublishBudget();
+    return loaded->blocks[--loaded->count];
+}
+
+size_t MessagePool::CarveSlab(size_t node, size_t sizeLevel, Magazine *magazine, size_t maxBlocks)
+{
+    const size_t blockSize = BlockSizeOf(sizeLevel);
+    SlabCursor &slab = s_slabCursors[node][sizeLevel];
+
+    std::lock_guard<std::mutex> lock(slab.mutex);
+    size_t carved = 0;
+    while (carved < maxBlocks && magazine->count < MAGAZINE_SIZE)
     {
-        void *ptr = cache->back();
-        cache->pop_back();
-        return ptr;
+        if (slab.remaining == 0)
+        {
+            slab.cursor = static_cast<uint8_t *>(AllocateSlab(node));
+            slab.remaining = SLAB_SIZE / blockSize;
+        }
+        magazine->blocks[magazine->count++] = slab.cursor;
+        slab.cursor += blockSize;
+        --slab.remaining;
+        ++carved;
     }
+    return carved;
+}
 
-    void *bulkBuffer[BULK_TRANSFER_COUNT];
-    size_t count = targetPool->try_dequeue_bulk(bulkBuffer, BULK_TRANSFER_COUNT);
+void *MessagePool::AllocateSlab(size_t node)
+{
+    s_slabBytes.fetch_add(SLAB_SIZE, std::memory_order_relaxed);
+
+    void *slab = nullptr;
 
-    if (count > 0)
+#if defined(__linux__)
+    HugePageMode mode = s_hugePageMode.load(std::memory_order_relaxed);
+    if (mode == HugePageMode::HugeTlb)
+    {
+        void *ptr = mmap(nullptr, SLAB_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED)
+            slab = ptr;
+        // hugetlbfs 페이지가 예약되지 않은 경우 -> THP 로 폴백
+    }
+    if (slab == nullptr && mode != HugePageMode::None)
     {
-        _poolSize.fetch_sub((int)count, std::memory_order_relaxed);
-        if (count > 1)
+        void *ptr = std::aligned_alloc(SLAB_SIZE, SLAB_SIZE);
+        if (ptr != nullptr)
         {
-            cache->insert(cache->end(), bulkBuffer + 1, bulkBuffer + count);
+            madvise(ptr, SLAB_SIZE, MADV_HUGEPAGE);
+            slab = ptr;
         }
-        return bulkBuffer[0];
     }
+#endif
+    // Windows Large Page 는 SeLockMemoryPrivilege 가 필요하므로 일반 할당을 사용
+    if (slab == nullptr)
+        slab = ::operator new(SLAB_SIZE);
+
+    // [NUMA] Pages are placed on the owning node (no-op on single-node hosts)
+    if (CpuTopology::GetPoolNodeCount() > 1)
+        CpuTopology::BindMemoryToNode(slab, SLAB_SIZE, static_cast<int>(node));
+    return slab;
+}
+
+void MessagePool::SetHugePageMode(HugePageMode mode)
+{
+    s_hugePageMode.store(mode, std::memory_order_relaxed);
+}
+
+HugePageMode MessagePool::GetHugePageMode()
+{
+    return s_hugePageMode.load(std::memory_order_relaxed);
+}
+
+size_t MessagePool::GetSlabBytes()
+{
+    return s_slabBytes.load(std::memory_order_relaxed);
+}
+
+void MessagePool::SetMemoryBudget(size_t softLimitBytes, size_t hardLimitBytes)
+{
+    if (hardLimitBytes != 0 && (softLimitBytes == 0 || softLimitBytes > hardLimitBytes))
+        softLimitBytes = hardLimitBytes;
+
+    s_softLimitBytes.store(softLimitBytes, std::memory_order_relaxed);
+    s_hardLimitBytes.store(hardLimitBytes, std::memory_order_relaxed);
+    PublishBudget();
+}
+
+size_t MessagePool::GetInUseBytes()
+{
+    size_t reserved = s_slabBytes.load(std::memory_order_relaxed) + s_heapBytes.load(std::memory_order_relaxed);
+    size_t parked = s_depotBytes.load(std::memory_order_relaxed);
+    // Relaxed counters may be observed out of order -> clamp instead of wrapping
+    return reserved > parked ? reserved - parked : 0;
+}
+
+size_t MessagePool::GetHeapBytes()
+{
+    return s_heapBytes.load(std::memory_order_relaxed);
+}
 
-    return ::operator new(blockSize);
+bool MessagePool::IsOverSoftLimit()
+{
+    size_t limit = s_softLimitBytes.load(std::memory_order_relaxed);
+    return limit != 0 && GetInUseBytes() >= limit;
+}
+
+bool MessagePool::IsOverHardLimit()
+{
+    size_t limit = s_hardLimitBytes.load(std::memory_order_relaxed);
+    return limit != 0 && GetInUseBytes() >= limit;
+}
+
+bool MessagePool::ShouldShedOptional()
+{
+    if (!IsOverSoftLimit())
+        return false;
+    GetPoolCounters().shedOptional.Increment();
+    return true;
 }
 
-void MessagePool::PushBlock(void *block, size_t sizeLevel)
+void MessagePool::PublishBudget()
 {
-    std::vector<void *> *cache = nullptr;
-    moodycamel::ConcurrentQueue<void *> *targetPool = nullptr;
+    // Slow path only (depot exchange, slab carve, heap alloc/free)
+    static std::shared_ptr<Gauge> inUse = GetMetrics().GetGauge("msgpool_in_use_bytes");
+    static std::shared_ptr<Gauge> heap = GetMetrics().GetGauge("msgpool_heap_live_bytes");
+    static std::shared_ptr<Gauge> state = GetMetrics().GetGauge("msgpool_budget_state"); // 0 ok, 1 soft, 2 hard
+
+    inUse->Set(static_cast<int64_t>(GetInUseBytes()));
+    heap->Set(static_cast<int64_t>(GetHeapBytes()));
+    state->Set(IsOverHardLimit() ? 2 : (IsOverSoftLimit() ? 1 : 0));
+}
+
+void MessagePool::PushRemoteBlock(void *block, size_t sizeLevel, size_t node)
+{
+    Magazine *&remote = t_l1.remote[node][sizeLevel];
+    if (remote == nullptr)
+        remote = AcquireEmptyMagazine(sizeLevel);
 
-    if (sizeLevel == 0)
+    remote->blocks[remote->count++] = block;
+    if (remote->count == MAGAZINE_SIZE)
     {
-        cache = &t_l1.smallBuffer;
-        targetPool = _smallPool;
+        DepositToDepot(node, sizeLevel, remote);
+        remote = nullptr;
+        PublishBudget();
     }
-    else if (sizeLevel == 1)
+}
+
+void MessagePool::PushBlock(void *block, size_t sizeLevel, size_t node)
+{
+    // [NUMA] Blocks from another node's slab go home instead of into this thread's cache
+    if (node != t_l1.node)
     {
-        cache = &t_l1.mediumBuffer;
-        targetPool = _mediumPool;
+        PushRemoteBlock(block, sizeLevel, node);
+        return;
     }
-    else
+
+    Magazine *&loaded = t_l1.loaded[sizeLevel];
+    Magazine *&previous = t_l1.previous[sizeLevel];
+
+    if (loaded == nullptr)
+        loaded = AcquireEmptyMagazine(sizeLevel);
+
+    // 1. Fast path: room in the loaded magazine
+    if (loaded->count < MAGAZINE_SIZE)
     {
-        cache = &t_l1.largeBuffer;
-        targetPool = _largePool;
+        loaded->blocks[loaded->count++] = block;
+        return;
     }
 
-    if (cache->size() < L1_CACHE_SIZE)
+    // 2. Loaded is full: swap with previous if it has room
+    if (previous == nullptr)
+        previous = AcquireEmptyMagazine(sizeLevel);
+
+    if (previous->count < MAGAZINE_SIZE)
     {
-        cache->push_back(block);
+        std::swap(loaded, previous);
+        loaded->blocks[loaded->count++] = block;
+        return;
     }
-    else
-    {
-        void *bulkBuffer[BULK_TRANSFER_COUNT];
-        for (size_t i = 0; i < BULK_TRANSFER_COUNT; ++i)
-        {
-            bulkBuffer[i] = cache->back();
-            cache->pop_back();
-        }
 
-        targetPool->enqueue_bulk(bulkBuffer, BULK_TRANSFER_COUNT);
-        _poolSize.fetch_add((int)BULK_TRANSFER_COUNT, std::memory_order_relaxed);
+    // 3. Both full: hand one full magazine to the depot, continue on an empty one
+    t_l1.FlushStats(sizeLevel);
+    DepositToDepot(t_l1.node, sizeLevel, previous);
+    PublishBudget();
 
-        cache->push_back(block);
-    }
+    previous = loaded;
+    loaded = AcquireEmptyMagazine(sizeLevel);
+    loaded->blocks[loaded->count++] = block;
 }
 
 void MessagePool::Prepare(size_t smallCount, size_t mediumCount, size_t largeCount)
 {
-    auto prepareLevel = [](moodycamel::ConcurrentQueue<void *> *pool, size_t count, size_t blockSize)
+    // Legacy tiers are split evenly over the classes they used to cover
+    const size_t smallFirst = 0;
+    const size_t mediumFirst = ClassOfBody(SMALL_BODY_SIZE) + 1;
+    const size_t largeFirst = ClassOfBody(MEDIUM_BODY_SIZE) + 1;
+
+    ClassBudget budget{};
+    auto spread = [&budget](size_t first, size_t last, size_t count)
+    {
+        size_t classes = last - first;
+        for (size_t level = first; level < last; ++level)
+            budget[level] = (count + classes - 1) / classes;
+    };
+    spread(smallFirst, mediumFirst, smallCount);
+    spread(mediumFirst, largeFirst, mediumCount);
+    spread(largeFirst, PACKET_CLASS_COUNT, largeCount);
+
+    Prepare(budget);
+}
+
+void MessagePool::Prepare(const ClassBudget &budget)
+{
+    const size_t nodeCount = CpuTopology::GetPoolNodeCount();
+    for (size_t node = 0; node < nodeCount; ++node)
     {
-        void *bulkBuffer[BULK_TRANSFER_COUNT];
-        size_t current = 0;
-        for (size_t i = 0; i < count; ++i)
+        for (size_t level = 0; level < PACKET_CLASS_COUNT; ++level)
         {
-            bulkBuffer[current++] = ::operator new(blockSize);
-            if (current == BULK_TRANSFER_COUNT)
+            // Top up: free blocks already in the depot (and this thread's magazines) count toward the budget,
+            // so repeated Prepare/Clear cycles reuse the carved slabs instead of carving new ones
+            size_t target = (budget[level] + nodeCount - 1) / nodeCount;
+            size_t available = s_depotBlocks[node][level].load(std::memory_order_relaxed);
+            if (node == t_l1.node)
             {
-                pool->enqueue_bulk(bulkBuffer, current);
-                _poolSize.fetch_add((int)current, std::memory_order_relaxed);
-                current = 0;
+                if (t_l1.loaded[level] != nullptr)
+                    available += t_l1.loaded[level]->count;
+                if (t_l1.previous[level] != nullptr)
+                    available += t_l1.previous[level]->count;
             }
-        }
-        if (current > 0)
-        {
-            pool->enqueue_bulk(bulkBuffer, current);
-            _poolSize.fetch_add((int)current, std::memory_order_relaxed);
-        }
-    };
 
-    prepareLevel(_smallPool, smallCount, BLOCK_SIZE_SMALL);
-    prepareLevel(_mediumPool, mediumCount, BLOCK_SIZE_MEDIUM);
-    prepareLevel(_largePool, largeCount, BLOCK_SIZE_LARGE);
+            size_t count = target > available ? target - available : 0;
+            while (count > 0)
+            {
+                Magazine *mag = AcquireEmptyMagazine(level);
+                count -= CarveSlab(node, level, mag, count);
+                DepositToDepot(node, level, mag);
+            }
+        }
+    }
+    PublishBudget();
 }
 
 void MessagePool::Clear()
 {
-    auto clearPool = [](moodycamel::ConcurrentQueue<void *> *pool)
+    // Blocks are carved from slabs and other threads' magazines may still point into them,
+    // so slab memory stays owned by the pool for the process lifetime (the next Prepare reuses it).
+    // Only spare (empty) magazine headers are released here.
+    for (size_t level = 0; level < LEVEL_COUNT; ++level)
     {
-        void *ptr = nullptr;
-        while (pool->try_dequeue(ptr))
+        Magazine *mag = nullptr;
+        while (_emptyDepot[level]->try_dequeue(mag))
         {
-            ::operator delete(ptr);
+            delete mag;
         }
-    };
-
-    clearPool(_smallPool);
-    clearPool(_mediumPool);
-    clearPool(_largePool);
+    }
 }
 
 } // namespace System
@@ -1,8 +1,12 @@
 #pragma once
 
 #include "System/Dispatcher/IMessage.h"
+#include "System/Thread/CpuTopology.h"
+#include <array>
 #include <atomic>
 #include <concurrentqueue/moodycamel/concurrentqueue.h>
+#include <mutex>
+#include <string_view>
 #include <vector>
 
 namespace System {
@@ -13,28 +17,98 @@ struct TimerCancelMessage;
 struct TimerTickMessage;
 struct EventMessage;
 
+/**
+ * @brief Slab 백킹 메모리 종류
+ * - None:        ::operator new (기본)
+ * - Transparent: 2MB 정렬 할당 + madvise(MADV_HUGEPAGE) (Linux THP)
+ * - HugeTlb:     mmap(MAP_HUGETLB) (사전 예약된 hugetlbfs 페이지 필요, 실패 시 Transparent 로 폴백)
+ */
+enum class HugePageMode : uint8_t
+{
+    None = 0,
+    Transparent,
+    HugeTlb,
+};
+
+// Config 문자열 ("none", "thp", "hugetlb") -> HugePageMode (알 수 없으면 None)
+HugePageMode ParseHugePageMode(std::string_view name);
+
+/**
+ * @brief AllocatePacket 우선순위 (Memory Budget 초과 시 처리 방식)
+ * - Critical: Budget 무시 (Server 간 통신, 제어 메시지)
+ * - Normal:   Hard Limit 초과 시 Pool 확장/Heap 폴백 거부 (nullptr)
+ * - Optional: Soft Limit 초과 시 즉시 거부 (디버그/부가 브로드캐스트)
+ */
+enum class AllocPriority : uint8_t
+{
+    Critical = 0,
+    Normal,
+    Optional,
+};
+
 class MessagePool
 {
 public:
     static std::atomic<int> _poolSize;
     static int GetPoolSize();
 
-    // Pool Level Constants
+    // [Size Classes] Body 64B ~ 16KB, power-of-two ladder
+    // 40B 이동 입력 패킷이 1KB 블록을 차지하지 않도록 소형 클래스를 세분화한다.
+    static constexpr size_t MIN_BODY_SHIFT = 6;      // 64B
+    static constexpr size_t PACKET_CLASS_COUNT = 9;  // 64B, 128B, ..., 16KB
+    static constexpr size_t TASK_LEVEL = PACKET_CLASS_COUNT;
+    static constexpr size_t LEVEL_COUNT = PACKET_CLASS_COUNT + 1; // Packet classes + Task
+
+    // Legacy tier boundaries (Prepare(small, medium, large) mapping)
     static const size_t SMALL_BODY_SIZE = 1024;  // 1KB
-    static const size_t MEDIUM_BODY_SIZE = 4096; // 4KB (기존 최대)
+    static const size_t MEDIUM_BODY_SIZE = 4096; // 4KB
     static const size_t LARGE_BODY_SIZE = 16384; // 16KB (KCP 재조립 등 대용량 대응)
 
-    // Allocation Block Sizes (sizeof(PacketMessage) + BodySize)
-    static const size_t BLOCK_SIZE_SMALL = sizeof(PacketMessage) + SMALL_BODY_SIZE;
-    static const size_t BLOCK_SIZE_MEDIUM = sizeof(PacketMessage) + MEDIUM_BODY_SIZE;
+    static constexpr size_t ClassBodySize(size_t level)
+    {
+        return size_t(1) << (MIN_BODY_SHIFT + level);
+    }
+
+    // Block stride per class (sizeof(PacketMessage) + body, cache-line aligned)
+    static constexpr size_t ClassBlockSize(size_t level)
+    {
+        return (sizeof(PacketMessage) + ClassBodySize(level) + 63) & ~size_t(63);
+    }
+
     static const size_t BLOCK_SIZE_LARGE = sizeof(PacketMessage) + LARGE_BODY_SIZE;
 
-    static const size_t L1_CACHE_SIZE = 1000;
-    static const size_t BULK_TRANSFER_COUNT = 500;
+    // [Task Level] LambdaMessage / SessionLambdaMessage 전용 소형 블록 (Push/WithSession)
+    static const size_t BLOCK_SIZE_TASK = ((sizeof(LambdaMessage) > sizeof(SessionLambdaMessage)
+                                               ? sizeof(LambdaMessage)
+                                               : sizeof(SessionLambdaMessage)) +
+                                           63) &
+                                          ~size_t(63);
+
+    // [Slab] 모든 레벨의 블록은 SLAB_SIZE 단위로 잘라낸다 (2MB = x86-64 Huge Page 크기)
+    static constexpr size_t SLAB_SIZE = 2 * 1024 * 1024;
+
+    // [Multicast] Large 블록 하나에 담을 수 있는 최대 수신자 수 (초과 시 호출측에서 분할)
+    static const size_t MAX_MULTICAST_RECIPIENTS = (BLOCK_SIZE_LARGE - sizeof(MulticastMessage)) / sizeof(uint64_t) + 1;
+
+    // [Magazine] Thread cache = loaded + previous magazine per size level.
+    // Full/Empty magazines are exchanged with the global depot as a unit (one queue op per MAGAZINE_SIZE blocks).
+    static constexpr size_t MAGAZINE_SIZE = 256;
+
+    // [NUMA] Per-node slabs and depots (node 0 only unless CpuTopology pool locality is enabled).
+    // A block always returns to the depot of the node it was carved on (IMessage::homeNode).
+    static constexpr size_t NODE_COUNT = CpuTopology::MAX_POOL_NODES;
+
+    // Per-class prefill budget (block count, index = size class)
+    using ClassBudget = std::array<size_t, PACKET_CLASS_COUNT>;
 
     // Allocation
-    static PacketMessage *AllocatePacket(uint16_t bodySize);
+    static PacketMessage *AllocatePacket(uint16_t bodySize, AllocPriority priority = AllocPriority::Normal);
     static EventMessage *AllocateEvent();
+    static LambdaMessage *AllocateLambda();
+    static SessionLambdaMessage *AllocateSessionLambda();
+    static MulticastMessage *AllocateMulticast(uint16_t recipientCount);
+    // Zero-copy inbound frame (task-sized block, same budget rules as AllocatePacket)
+    static PacketRefMessage *AllocatePacketRef(AllocPriority priority = AllocPriority::Normal);
 
     static TimerExpiredMessage *AllocateTimerExpired();
     static TimerAddMessage *AllocateTimerAdd();
@@ -46,18 +120,68 @@ public:
     static void FreeRaw(void *block);
 
     // Management
+    // Prefill is split evenly over CpuTopology::GetPoolNodeCount() nodes.
+    // Prepare tops each class up to its budget: free blocks already pooled count, so calling it again carves nothing.
+    // Legacy: small -> 64B~1KB classes, medium -> 2KB~4KB, large -> 8KB~16KB (evenly split)
     static void Prepare(size_t smallCount, size_t mediumCount, size_t largeCount);
+    static void Prepare(const ClassBudget &budget);
     static void Clear();
 
+    // Must be called before the first slab is carved (Framework: before Prepare)
+    static void SetHugePageMode(HugePageMode mode);
+    static HugePageMode GetHugePageMode();
+
+    // Smallest class whose body fits bodySize (PACKET_CLASS_COUNT if larger than 16KB)
+    static size_t ClassOfBody(size_t bodySize);
+    // Smallest class whose block fits a whole message of allocSize bytes
+    static size_t ClassOfAllocSize(size_t allocSize);
+
+    // Bytes reserved from the OS for slabs (all levels)
+    static size_t GetSlabBytes();
+
+    // [Budget] Global byte budget for pooled + heap messages (0 = unlimited)
+    // In-use = slab bytes + live heap bytes - bytes parked in the depot.
+    // Blocks cached in thread magazines count as in use (bounded by 2 * MAGAZINE_SIZE per level per thread).
+    static void SetMemoryBudget(size_t softLimitBytes, size_t hardLimitBytes);
+    static size_t GetInUseBytes();
+    static size_t GetHeapBytes();
+    static bool IsOverSoftLimit();
+    static bool IsOverHardLimit();
+
+    // Soft limit check for optional work that does not go through AllocatePacket (counted as shed)
+    static bool ShouldShedOptional();
+
+    struct Magazine
+    {
+        size_t count = 0;
+        void *blocks[MAGAZINE_SIZE];
+    };
+
 private:
-    // Multi-Level Queues
-    static moodycamel::ConcurrentQueue<void *> *_smallPool;  // 1KB
-    static moodycamel::ConcurrentQueue<void *> *_mediumPool; // 4KB
-    static moodycamel::ConcurrentQueue<void *> *_largePool;  // 16KB
+    // [Depot] Per-node, per-level magazine queues (level = size class, TASK_LEVEL = Lambda/SessionLambda)
+    // Empty magazines are node-agnostic headers.
+    static moodycamel::ConcurrentQueue<Magazine *> *_fullDepot[NODE_COUNT][LEVEL_COUNT];
+    static moodycamel::ConcurrentQueue<Magazine *> *_emptyDepot[LEVEL_COUNT];
+    static const bool _depotsReady;
+
+    // Heap fallback marker (sizeLevel of non-pooled packets; PacketMessage::heapSize holds the allocation size)
+    static constexpr uint8_t HEAP_LEVEL = 0xFF;
 
     // Helper functions for specific levels
-    static void *PopBlock(size_t sizeLevel);
-    static void PushBlock(void *block, size_t sizeLevel);
+    static void *PopBlock(size_t sizeLevel, bool enforceBudget = false);
+    static void PushBlock(void *block, size_t sizeLevel, size_t node);
+    static void PushRemoteBlock(void *block, size_t sizeLevel, size_t node);
+    static size_t CarveSlab(size_t node, size_t sizeLevel, Magazine *magazine, size_t maxBlocks);
+    static void *AllocateSlab(size_t node);
+    static Magazine *AcquireEmptyMagazine(size_t sizeLevel);
+    static size_t MulticastSizeLevel(uint16_t recipientCount);
+    static size_t BlockSizeOf(size_t sizeLevel);
+    static void DepositToDepot(size_t node, size_t sizeLevel, Magazine *magazine);
+    static void WithdrawFromDepot(size_t node, size_t sizeLevel, Magazine *magazine);
+    static void PublishBudget();
+    template <typename T> static T *Construct(void *block, size_t sizeLevel);
+
+    friend struct L1Cache;
 };
 
-} // namespace System
\ No newline at end of file
+} // namespace System
@@ -5,6 +5,7 @@
 #include "System/Database/DatabaseRegistry.h"
 #include "System/Debug/CrashHandler.h"
 #include "System/Dispatcher/DISPATCHER/DispatcherImpl.h"
+#include "System/Dispatcher/DISPATCHER/ShardedDispatcherImpl.h"
 #include "System/Dispatcher/MessagePool.h"
 #include "System/IConfig.h"
 #include "System/IDatabase.h"
@@ -12,6 +13,7 @@
 #include "System/ITimer.h"
 #include "System/Metrics/IMetrics.h"
 #include "System/Network/AesEncryption.h"
+#include "System/Network/IoBackend.h"
 #include "System/Network/NetworkImpl.h"
 #include "System/Network/WebSocketNetworkImpl.h"
 #include "System/Network/XorEncryption.h"
@@ -19,6 +21,7 @@
 #include "System/Session/GatewaySession.h"
 #include "System/Session/SessionFactory.h"
 #include "System/Session/SessionPool.h"
+#include "System/Thread/CpuTopology.h"
 #include "System/Thread/Strand.h"
 #include "System/Thread/ThreadPool.h"
 #include "System/Timer/TimerImpl.h"
@@ -104,7 +107,14 @@ bool Framework::Init(std::shared_ptr<IConfig> config, std::shared_ptr<IPacketHan
 
     const auto &serverConfig = _config->GetConfig();
 
+    // 1.2 Topology / NUMA pool locality (must precede every pool warm-up below)
+    CpuTopology::SetPoolLocality(serverConfig.numaLocalPools);
+    CpuTopology::LogTopology();
+
     // 1.5 Server Role Setup
+    SessionFactory::SetParkIdleReads(serverConfig.parkIdleReads);
+    SessionFactory::SetZeroCopyRecv(ServerRole::Gateway, serverConfig.zeroCopyGatewayRecv);
+    SessionFactory::SetZeroCopyRecv(ServerRole::Backend, serverConfig.zeroCopyBackendRecv);
     if (serverConfig.serverRole == "backend")
     {
         SessionFactory::SetServerRole(ServerRole::Backend);
@@ -113,14 +123,19 @@ bool Framework::Init(std::shared_ptr<IConfig> config, std::shared_ptr<IPacketHan
     else
     {
         SessionFactory::SetServerRole(ServerRole::Gateway);
-        // [Production] Warm up for 10,000 CCU scenario
+        // [Production] Warm up for 10,000 CCU scenario (seed now, rest filled in background)
         GetSessionPool<GatewaySession>().WarmUp(10000);
     }
 
     // 2. Prepare Pools & Encryption (Hidden from User)
     // [Production] Pre-allocate enough messages to handle initial bursts
-    // Small: 20,000 (1KB), Medium: 5,000 (4KB), Large: 1,000 (16KB)
+    // Small: 20,000 (64B~1KB), Medium: 5,000 (2KB~4KB), Large: 1,000 (8KB~16KB)
+    System::MessagePool::SetHugePageMode(System::ParseHugePageMode(serverConfig.messagePoolHugePages));
     System::MessagePool::Prepare(20000, 5000, 1000);
+    System::MessagePool::SetMemoryBudget(
+        static_cast<size_t>(std::max(serverConfig.messagePoolSoftLimitMb, 0)) * 1024 * 1024,
+        static_cast<size_t>(std::max(serverConfig.messagePoolHardLimitMb, 0)) * 1024 * 1024
+    );
 
     // [Encryption] Configure Factory
     std::string encType = serverConfig.encryption;
@@ -177,11 +192,42 @@ bool Framework::Init(std::shared_ptr<IConfig> config, std::shared_ptr<IPacketHan
     LOG_INFO("Pools Ready.");
 
     // 3. Components
-    auto dispatcherImpl = std::make_shared<DispatcherImpl>(packetHandler);
-    _dispatcher = dispatcherImpl;
+    int shardCount = serverConfig.dispatcherShardCount;
+    WaitPolicy waitPolicy = ParseWaitPolicy(serverConfig.dispatcherWaitPolicy);
+    if (shardCount > 1)
+    {
+        // [Sharding] Session-affinity routed logic shards. Shard 0 runs on the main loop.
+        auto sharded =
+            std::make_shared<ShardedDispatcherImpl>(packetHandler, static_cast<size_t>(shardCount), waitPolicy);
+        sharded->PinShardThreads(ParseCpuList(serverConfig.logicThreadCpus));
+        _dispatcher = sharded;
+        LOG_INFO("Dispatcher: {} Shards (Session Affinity)", shardCount);
+    }
+    else
+    {
+        _dispatcher = std::make_shared<DispatcherImpl>(packetHandler, waitPolicy);
+    }
+    LOG_INFO("Dispatcher Wait Policy: {}", ToString(waitPolicy));
 
     _network = std::make_shared<NetworkImpl>();
     _network->SetDispatcher(_dispatcher.get()); // Inject Dispatcher (Raw Pointer)
+
+    IoBackend ioBackend = ResolveIoBackend(serverConfig.ioBackend);
+    if (ioBackend == IoBackend::IoUring && serverConfig.ioUringRegisteredBlocks > 0)
+    {
+        _network->RegisterRecvBlocks(static_cast<size_t>(serverConfig.ioUringRegisteredBlocks));
+    }
+    LOG_INFO("IO Backend: {}", ToString(ioBackend));
+    if (serverConfig.udpSocketShards > 1)
+    {
+        _network->SetUdpShards(
+            static_cast<size_t>(serverConfig.udpSocketShards), ParseCpuList(serverConfig.udpThreadCpus)
+        );
+    }
+    if (serverConfig.udpBatchSize > 1)
+    {
+        _network->SetUdpBatching(static_cast<size_t>(serverConfig.udpBatchSize), serverConfig.udpGso);
+    }
     _timer = std::make_shared<TimerImpl>(_network->GetIOContext(), _dispatcher.get());
 
     // 4. ThreadPool (Computations)
@@ -192,12 +238,14 @@ bool Framework::Init(std::shared_ptr<IConfig> config, std::shared_ptr<IPacketHan
         return false;
     }
     _threadPool = std::make_shared<ThreadPool>(taskThreads);
+    _threadPool->SetCpuAffinity(ParseCpuList(serverConfig.taskThreadCpus));
 
     // 4.5 DB ThreadPool
     int dbThreads = serverConfig.dbWorkerCount;
     if (dbThreads <= 0)
         dbThreads = 1;
     _dbThreadPool = std::make_shared<ThreadPool>(dbThreads, "DB Thread");
+    _dbThreadPool->SetCpuAffinity(ParseCpuList(serverConfig.dbThreadCpus));
 
     // 4.6 Init Database (Automation)
     // Database Initialization (Explicit)
@@ -272,13 +320,15 @@ void Framework::Run()
 
     // 1. Start IO Threads (Network)
     int ioThreadCount = _config->GetConfig().workerThreadCount;
+    std::vector<int> ioCpus = ParseCpuList(_config->GetConfig().ioThreadCpus);
     LOG_INFO("Starting {} IO Threads...", ioThreadCount);
     _ioThreads.reserve(ioThreadCount);
     for (int i = 0; i < ioThreadCount; ++i)
     {
         _ioThreads.emplace_back(
-            [this, i]()
+            [this, i, ioCpus]()
             {
+                CpuTopology::PinWorker(ioCpus, static_cast<size_t>(i), "IO Thread");
                 try
                 {
                     LOG_ERROR("[DEBUG] IO Thread #{} Started.", i);
@@ -301,6 +351,9 @@ void Framework::Run()
     if (_dbThreadPool)
         _dbThreadPool->Start();
 
+    // Main thread = Logic (Shard 0). Pinned last: threads created above would inherit its mask.
+    CpuTopology::PinWorker(ParseCpuList(_config->GetConfig().logicThreadCpus), 0, "Logic Thread");
+
     // 3. Main Thread Logic Loop
     auto lastLog = std::chrono::steady_clock::now();
     while (_running)
@@ -11,6 +11,27 @@ struct ServerConfig
     int workerThreadCount = 0;
     int taskWorkerCount = 0;
     int dbWorkerCount = 2; // Default for Async DB Workers
+    int dispatcherShardCount = 1; // Logic Dispatcher Shards (1 = Single Logic Thread)
+    std::string dispatcherWaitPolicy = "cv"; // Logic Loop Idle Wait (cv, spin, spin_yield, spin_park)
+    std::string messagePoolHugePages = "none"; // MessagePool Slab Backing (none, thp, hugetlb)
+    std::string ioBackend = "epoll";           // Network IO Backend (epoll, io_uring; must match the build)
+    int ioUringRegisteredBlocks = 1024;        // io_uring: RecvBuffer blocks registered as fixed buffers (64KB each)
+    int udpSocketShards = 1;                   // UDP: SO_REUSEPORT sockets, one io_context + thread each (1 = shared IO)
+    int udpBatchSize = 0;                      // UDP: datagrams per recvmmsg/sendmmsg (0 = one syscall per datagram)
+    bool udpGso = false;                       // UDP: UDP_SEGMENT for same-destination bursts (needs udpBatchSize)
+    int messagePoolSoftLimitMb = 0;            // MessagePool Budget: shed optional traffic above (0 = unlimited)
+    int messagePoolHardLimitMb = 0;            // MessagePool Budget: refuse growth + pause reads above (0 = unlimited)
+
+    // CPU Affinity (CPU list "0-3,8"; empty = OS scheduling). Workers are pinned round-robin, one CPU each.
+    std::string ioThreadCpus;
+    std::string logicThreadCpus; // Main loop = Shard 0, then dispatcher shard threads
+    std::string taskThreadCpus;
+    std::string dbThreadCpus;
+    std::string udpThreadCpus; // UDP socket shard threads (udpSocketShards > 1)
+    bool numaLocalPools = false;      // Per-NUMA-node MessagePool slabs/depots and SessionPool free lists
+    bool parkIdleReads = false;       // Idle TCP sessions park without a 64KB RecvBuffer (per-IO-thread scratch)
+    bool zeroCopyGatewayRecv = false; // Plain gateway frames go to the dispatcher in place (no per-packet copy)
+    bool zeroCopyBackendRecv = false; // Same for backend (server-to-server) sessions
     std::string dbAddress;
 
     // Database Config
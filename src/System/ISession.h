@@ -47,6 +47,11 @@ public:
     // [Lifetime] Reference counting for async message queue safety
     virtual void IncRef() = 0;
     virtual void DecRef() = 0;
+
+    // [Backpressure] Dispatcher finished one inbound NETWORK_DATA message of this session
+    virtual void OnInboundProcessed()
+    {
+    }
 };
 
 } // namespace System
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace System {
+
+/*
+    Frame Arena (per-tick monotonic scratch memory)
+
+    [Design]
+    - Bump allocation out of chunks obtained from the upstream resource.
+    - deallocate() is a no-op; Reset() rewinds to the first chunk at the start of a frame.
+    - Chunks are kept across Reset(): once the arena has seen a frame's peak usage,
+      later frames with the same shape never touch the upstream (no malloc in steady state).
+    - Requests larger than the chunk size get a dedicated chunk (also retained).
+
+    [Usage]
+        std::pmr::vector<int32_t> ids(&arena); // valid until the next Reset()
+
+    [Thread Safety]
+    - None. Owned by one logic context (e.g. a Room strand).
+*/
+class FrameArena : public std::pmr::memory_resource
+{
+public:
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+    explicit FrameArena(
+        size_t chunkSize = DEFAULT_CHUNK_SIZE, std::pmr::memory_resource *upstream = std::pmr::new_delete_resource()
+    )
+        : _chunkSize(chunkSize), _upstream(upstream)
+    {
+    }
+
+    ~FrameArena() override
+    {
+        for (const Chunk &chunk : _chunks)
+        {
+            _upstream->deallocate(chunk.data, chunk.size, alignof(std::max_align_t));
+        }
+    }
+
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    // Start of frame: every pointer handed out before this call becomes invalid
+    void Reset()
+    {
+        _highWater = std::max(_highWater, _used);
+        _current = 0;
+        _offset = 0;
+        _used = 0;
+    }
+
+    // Bytes handed out since the last Reset()
+    size_t GetUsedBytes() const
+    {
+        return _used;
+    }
+
+    // Peak GetUsedBytes() over all completed frames
+    size_t GetHighWater() const
+    {
+        return std::max(_highWater, _used);
+    }
+
+    size_t GetCapacity() const
+    {
+        size_t total = 0;
+        for (const Chunk &chunk : _chunks)
+            total += chunk.size;
+        return total;
+    }
+
+    // Number of chunks requested from the upstream (constant once the arena is warm)
+    size_t GetUpstreamAllocCount() const
+    {
+        return _upstreamAllocs;
+    }
+
+private:
+    struct Chunk
+    {
+        std::byte *data;
+        size_t size;
+    };
+
+    void *do_allocate(size_t bytes, size_t alignment) override
+    {
+        if (void *ptr = TryBump(bytes, alignment))
+            return ptr;
+
+        // Move on to the next retained chunk that fits (same order every frame -> stable)
+        while (_current + 1 < _chunks.size())
+        {
+            ++_current;
+            _offset = 0;
+            if (void *ptr = TryBump(bytes, alignment))
+                return ptr;
+        }
+
+        size_t size = std::max(_chunkSize, bytes + alignment);
+        auto *data = static_cast<std::byte *>(_upstream->allocate(size, alignof(std::max_align_t)));
+        ++_upstreamAllocs;
+        _chunks.push_back(Chunk{data, size});
+        _current = _chunks.size() - 1;
+        _offset = 0;
+        return TryBump(bytes, alignment);
+    }
+
+    void do_deallocate(void *, size_t, size_t) override
+    {
+        // Monotonic: memory comes back on Reset()
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    void *TryBump(size_t bytes, size_t alignment)
+    {
+        if (_current >= _chunks.size())
+            return nullptr;
+
+        const Chunk &chunk = _chunks[_current];
+        uintptr_t base = reinterpret_cast<uintptr_t>(chunk.data);
+        uintptr_t aligned = (base + _offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        size_t end = static_cast<size_t>(aligned - base) + bytes;
+        if (end > chunk.size)
+            return nullptr;
+
+        _used += end - _offset;
+        _offset = end;
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    size_t _chunkSize;
+    std::pmr::memory_resource *_upstream;
+    std::vector<Chunk> _chunks;
+    size_t _current = 0;
+    size_t _offset = 0;
+    size_t _used = 0;
+    size_t _highWater = 0;
+    size_t _upstreamAllocs = 0;
+};
+
+} // namespace System
@@ -58,6 +58,32 @@ struct GenerationalID
     }
 };
 
+/*
+    [SessionHandle]
+    GenerationalID 와 같은 방식의 64-bit Session ID.
+    - Top 32 bits: Version (Slot 이 재사용될 때마다 증가)
+    - Bottom 32 bits: Slot (1-based, 0 은 Invalid)
+
+    Session 수(수만 CCU)와 재접속 횟수가 16-bit 범위를 넘기 때문에
+    sessionId(uint64_t) 타입을 그대로 유지하면서 폭만 넓혔다.
+    첫 세대(Version 0)의 ID 는 Slot 번호와 같다.
+*/
+struct SessionHandle
+{
+    static constexpr uint64_t Make(uint32_t version, uint32_t slot) noexcept
+    {
+        return (static_cast<uint64_t>(version) << 32) | static_cast<uint64_t>(slot);
+    }
+    static constexpr uint32_t GetVersion(uint64_t sessionId) noexcept
+    {
+        return static_cast<uint32_t>(sessionId >> 32);
+    }
+    static constexpr uint32_t GetSlot(uint64_t sessionId) noexcept
+    {
+        return static_cast<uint32_t>(sessionId & 0xFFFFFFFFull);
+    }
+};
+
 } // namespace System
 
 namespace std {
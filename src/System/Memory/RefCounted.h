@@ -1,9 +1,20 @@
 #pragma once
+#include "System/Thread/StrandContext.h"
 #include <atomic>
+#include <cassert>
 #include <cstdint>
+#include <type_traits>
 
 namespace System {
 
+// Reference count policies for RefCounted<T, Policy>
+struct AtomicRefCount // Any thread may AddRef/Release (default)
+{
+};
+struct StrandLocalRefCount // One strand (or thread) at a time: plain load/store, no lock-prefixed RMW
+{
+};
+
 /**
  * @brief CRTP Base class for intrusive reference counting.
  *
@@ -13,10 +24,19 @@ namespace System {
  * 3. Release uses memory_order_acq_rel for visibility.
  * 4. Must NOT include LockFreeObjectPool.h or specific pool headers (Circular Dependency Prevention).
  *    Instead, derived classes must implement `void ReturnToPool() const`.
+ *
+ * [StrandLocalRefCount]
+ * - For objects only ever referenced from one serialized context (e.g. Room strand entities).
+ * - The count is still a std::atomic, but updated with relaxed load + store (plain mov, no `lock xadd`).
+ * - ShareAcrossThreads(): per-instance opt-out back to atomic RMW (e.g. Player, also held by RoomManager).
+ * - Debug builds (!NDEBUG) bind the object to StrandContext::OwnerToken() on 0 -> 1 and assert on
+ *   AddRef/Release from any other strand/thread. TransferOwnership() hands a live object over explicitly.
  */
-template <typename T> class RefCounted
+template <typename T, typename Policy = AtomicRefCount> class RefCounted
 {
 public:
+    static constexpr bool IS_STRAND_LOCAL = std::is_same_v<Policy, StrandLocalRefCount>;
+
     RefCounted() = default;
     virtual ~RefCounted() = default;
 
@@ -28,6 +48,17 @@ public:
 
     void AddRef() const
     {
+        if constexpr (IS_STRAND_LOCAL)
+        {
+            if (!m_local.shared)
+            {
+                uint32_t count = m_refCount.load(std::memory_order_relaxed);
+                CheckOwner(count == 0);
+                m_refCount.store(count + 1, std::memory_order_relaxed);
+                return;
+            }
+        }
+
         // Relaxed order because we only care about incrementing the counter atomically.
         // No memory synchronization is needed when just taking a reference.
         m_refCount.fetch_add(1, std::memory_order_relaxed);
@@ -35,6 +66,24 @@ public:
 
     void Release() const
     {
+        if constexpr (IS_STRAND_LOCAL)
+        {
+            if (!m_local.shared)
+            {
+                CheckOwner(false);
+                uint32_t count = m_refCount.load(std::memory_order_relaxed) - 1;
+                m_refCount.store(count, std::memory_order_relaxed);
+                if (count == 0)
+                {
+#ifndef NDEBUG
+                    m_local.owner.store(0, std::memory_order_relaxed); // Pooled -> next Pop() rebinds
+#endif
+                    const_cast<T *>(static_cast<const T *>(this))->ReturnToPool();
+                }
+                return;
+            }
+        }
+
         // acq_rel ensures that all memory operations before the last Release()
         // are visible before the object is returned to the pool (or deleted).
         if (m_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
@@ -51,8 +100,65 @@ public:
         return m_refCount.load(std::memory_order_relaxed);
     }
 
+    // [StrandLocal] This instance is referenced from several threads -> atomic counting.
+    // Call before the object is published (constructor); never while other references are live.
+    void ShareAcrossThreads()
+    {
+        if constexpr (IS_STRAND_LOCAL)
+            m_local.shared = true;
+    }
+
+    bool IsSharedAcrossThreads() const
+    {
+        if constexpr (IS_STRAND_LOCAL)
+            return m_local.shared;
+        else
+            return true;
+    }
+
+    // [StrandLocal] The calling context takes over a live object whose previous owner is done with it
+    // (e.g. Room teardown on a non-strand thread). Needs a happens-before edge from the old owner.
+    void TransferOwnership() const
+    {
+#ifndef NDEBUG
+        if constexpr (IS_STRAND_LOCAL)
+            m_local.owner.store(StrandContext::OwnerToken(), std::memory_order_relaxed);
+#endif
+    }
+
 protected:
     mutable std::atomic<uint32_t> m_refCount{0};
+
+private:
+    struct LocalState
+    {
+        bool shared = false;
+#ifndef NDEBUG
+        mutable std::atomic<uintptr_t> owner{0};
+#endif
+    };
+    struct NoState
+    {
+    };
+
+    void CheckOwner([[maybe_unused]] bool bind) const
+    {
+#ifndef NDEBUG
+        if constexpr (IS_STRAND_LOCAL)
+        {
+            const uintptr_t token = StrandContext::OwnerToken();
+            if (bind)
+            {
+                m_local.owner.store(token, std::memory_order_relaxed);
+                return;
+            }
+            [[maybe_unused]] const uintptr_t owner = m_local.owner.load(std::memory_order_relaxed);
+            assert(owner == token && "StrandLocalRefCount object touched outside its owning strand/thread");
+        }
+#endif
+    }
+
+    [[no_unique_address]] std::conditional_t<IS_STRAND_LOCAL, LocalState, NoState> m_local;
 };
 
 } // namespace System
@@ -0,0 +1,270 @@
+#pragma once
+
+#include "System/Memory/RefPtr.h"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace System {
+
+template <typename T, size_t CHUNK_OBJECTS> class SlabPool;
+
+/*
+    Slab Pool (typed, contiguous, owner-confined)
+
+    [Design]
+    - Objects of one type live side by side in fixed-size chunks (CHUNK_OBJECTS slots each).
+      Iterating the pool walks memory linearly instead of chasing map nodes / scattered heap blocks.
+    - Slots stay constructed after release (warm, like LockFreeObjectPool); Pop() calls Reset() on reuse.
+    - Free slots are reused LIFO, so the live set stays packed in the low slots.
+    - Pop() returns RefPtr<T>; the last Release() comes back through T::ReturnToPool() -> ReturnToSlab().
+
+    [Lifetime]
+    - If the pool dies while objects are still referenced, the storage is orphaned and freed by the
+      last returning object instead of leaving dangling slots.
+
+    [Thread Safety]
+    - None. One owner context (e.g. a Room strand / its ObjectManager).
+*/
+
+// Mixin for slab-allocated types: remembers the owning pool of the instance
+template <typename T> class SlabPooled
+{
+public:
+    bool IsSlabAllocated() const
+    {
+        return _slabHome != nullptr;
+    }
+
+protected:
+    // true -> returned to its slab; false -> not slab-allocated (caller frees it another way)
+    bool ReturnToSlab()
+    {
+        if (_slabHome == nullptr)
+            return false;
+        _slabHome->Return(static_cast<T *>(this));
+        return true;
+    }
+
+private:
+    template <typename, size_t> friend class SlabPool;
+
+    struct Home
+    {
+        virtual void Return(T *obj) = 0;
+
+    protected:
+        ~Home() = default;
+    };
+
+    Home *_slabHome = nullptr;
+    uint32_t _slabSlot = 0; // chunk * CHUNK_OBJECTS + slot
+};
+
+template <typename T, size_t CHUNK_OBJECTS = 256> class SlabPool
+{
+    using Home = typename SlabPooled<T>::Home;
+
+    struct Chunk
+    {
+        alignas(T) std::byte slots[CHUNK_OBJECTS][sizeof(T)];
+        bool live[CHUNK_OBJECTS] = {};
+        uint32_t constructed = 0;
+
+        T *At(size_t i)
+        {
+            return std::launder(reinterpret_cast<T *>(slots[i]));
+        }
+    };
+
+    struct Storage final : Home
+    {
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        std::vector<T *> freeSlots;
+        size_t liveCount = 0;
+        bool orphaned = false;
+
+        void Return(T *obj) override
+        {
+            const uint32_t slot = SlotOf(obj);
+            chunks[slot / CHUNK_OBJECTS]->live[slot % CHUNK_OBJECTS] = false;
+            --liveCount;
+
+            if (orphaned)
+            {
+                if (liveCount == 0)
+                    delete this;
+                return;
+            }
+            freeSlots.push_back(obj);
+        }
+
+        ~Storage()
+        {
+            for (auto &chunk : chunks)
+            {
+                for (uint32_t i = 0; i < chunk->constructed; ++i)
+                    chunk->At(i)->~T();
+            }
+        }
+    };
+
+public:
+    static constexpr size_t CHUNK_SIZE = CHUNK_OBJECTS;
+
+    // Dense iterator over live objects (chunk by chunk, skipping free slots)
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+        Iterator() = default;
+        Iterator(const Storage *storage, size_t chunk, size_t slot) : _storage(storage), _chunk(chunk), _slot(slot)
+        {
+            SkipFree();
+        }
+
+        T &operator*() const
+        {
+            return *_storage->chunks[_chunk]->At(_slot);
+        }
+        T *operator->() const
+        {
+            return _storage->chunks[_chunk]->At(_slot);
+        }
+
+        Iterator &operator++()
+        {
+            ++_slot;
+            SkipFree();
+            return *this;
+        }
+
+        // end() is a sentinel: chunks added mid-loop are still visited before reaching it
+        bool operator==(const Iterator &other) const
+        {
+            if (AtEnd() || other.AtEnd())
+                return AtEnd() == other.AtEnd();
+            return _chunk == other._chunk && _slot == other._slot;
+        }
+        bool operator!=(const Iterator &other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        bool AtEnd() const
+        {
+            return _storage == nullptr || _chunk >= _storage->chunks.size();
+        }
+
+        void SkipFree()
+        {
+            // Re-reads chunks on every step: objects spawned mid-loop (new chunk) are safe
+            while (!AtEnd())
+            {
+                const Chunk &chunk = *_storage->chunks[_chunk];
+                while (_slot < chunk.constructed && !chunk.live[_slot])
+                    ++_slot;
+                if (_slot < chunk.constructed)
+                    return;
+                ++_chunk;
+                _slot = 0;
+            }
+        }
+
+        const Storage *_storage = nullptr;
+        size_t _chunk = 0;
+        size_t _slot = 0;
+    };
+
+    SlabPool() : _storage(new Storage())
+    {
+    }
+
+    ~SlabPool()
+    {
+        if (_storage->liveCount == 0)
+            delete _storage;
+        else
+            _storage->orphaned = true; // Last Return() frees it
+    }
+
+    SlabPool(const SlabPool &) = delete;
+    SlabPool &operator=(const SlabPool &) = delete;
+
+    RefPtr<T> Pop()
+    {
+        T *obj = nullptr;
+        if (!_storage->freeSlots.empty())
+        {
+            obj = _storage->freeSlots.back();
+            _storage->freeSlots.pop_back();
+            obj->Reset();
+        }
+        else
+        {
+            obj = Construct();
+        }
+
+        const uint32_t slot = SlotOf(obj);
+        _storage->chunks[slot / CHUNK_OBJECTS]->live[slot % CHUNK_OBJECTS] = true;
+        ++_storage->liveCount;
+        return RefPtr<T>(obj);
+    }
+
+    Iterator begin() const
+    {
+        return Iterator(_storage, 0, 0);
+    }
+    Iterator end() const
+    {
+        return Iterator(_storage, SIZE_MAX, 0);
+    }
+
+    size_t GetLiveCount() const
+    {
+        return _storage->liveCount;
+    }
+    size_t GetChunkCount() const
+    {
+        return _storage->chunks.size();
+    }
+    size_t GetCapacity() const
+    {
+        return _storage->chunks.size() * CHUNK_OBJECTS;
+    }
+
+private:
+    T *Construct()
+    {
+        auto &chunks = _storage->chunks;
+        if (chunks.empty() || chunks.back()->constructed == CHUNK_OBJECTS)
+            chunks.push_back(std::make_unique<Chunk>());
+
+        Chunk &chunk = *chunks.back();
+        T *obj = new (chunk.slots[chunk.constructed]) T();
+        SlabPooled<T> &pooled = *obj;
+        pooled._slabHome = _storage;
+        pooled._slabSlot = static_cast<uint32_t>((chunks.size() - 1) * CHUNK_OBJECTS + chunk.constructed);
+        ++chunk.constructed;
+        return obj;
+    }
+
+    static uint32_t SlotOf(T *obj)
+    {
+        const SlabPooled<T> &pooled = *obj;
+        return pooled._slabSlot;
+    }
+
+    Storage *_storage;
+};
+
+} // namespace System
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -43,4 +45,48 @@ public:
 // Singleton Accessor (To replace GetMonitor)
 IMetrics &GetMetrics();
 
+namespace MetricShards {
+// 등록 가능한 Sharded Counter 수 (초과분은 단일 atomic Counter 로 폴백)
+static constexpr uint32_t MAX_COUNTERS = 256;
+static constexpr uint32_t INVALID_SLOT = UINT32_MAX;
+
+// 호출 스레드에 배정된 샤드 (MAX_COUNTERS 개의 슬롯)
+std::atomic<uint64_t> *Acquire();
+inline std::atomic<uint64_t> *ForThisThread()
+{
+    thread_local std::atomic<uint64_t> *shard = Acquire();
+    return shard;
+}
+} // namespace MetricShards
+
+/**
+ * @brief Hot path 용 Counter 핸들
+ *
+ * 이름 -> 슬롯 해석은 생성 시 1회 (보통 static 객체).
+ * Increment 는 스레드별 샤드 슬롯에 relaxed fetch_add 만 수행 -> mutex / map 조회 / shared_ptr 복사 없음.
+ * 값은 GetMetrics().GetCounter(name) 으로 조회한 Counter 와 동일하다.
+ */
+class CounterHandle
+{
+public:
+    explicit CounterHandle(const std::string &name);
+
+    void Increment(uint64_t value = 1) const
+    {
+        if (_slot != MetricShards::INVALID_SLOT)
+            MetricShards::ForThisThread()[_slot].fetch_add(value, std::memory_order_relaxed);
+        else
+            _counter->Increment(value);
+    }
+
+    uint64_t GetValue() const
+    {
+        return _counter->GetValue();
+    }
+
+private:
+    std::shared_ptr<Counter> _counter;
+    uint32_t _slot = MetricShards::INVALID_SLOT;
+};
+
 } // namespace System
@@ -4,6 +4,45 @@
 
 namespace System {
 
+namespace {
+
+static constexpr uint32_t MAX_SHARDS = 32;
+
+// 샤드 하나 = 한 스레드(또는 소수 스레드)가 쓰는 MAX_COUNTERS 개 슬롯, 캐시라인 정렬로 샤드 간 False Sharing 없음
+struct alignas(64) MetricShard
+{
+    std::atomic<uint64_t> slots[MetricShards::MAX_COUNTERS];
+};
+
+MetricShard s_shards[MAX_SHARDS];
+std::atomic<uint32_t> s_nextShard{0};
+
+} // namespace
+
+std::atomic<uint64_t> *MetricShards::Acquire()
+{
+    // Round-robin: 스레드 수가 MAX_SHARDS 를 넘으면 샤드를 공유 (atomic 이므로 정확성은 유지)
+    return s_shards[s_nextShard.fetch_add(1, std::memory_order_relaxed) % MAX_SHARDS].slots;
+}
+
+uint64_t ShardedCounterImpl::GetValue() const
+{
+    uint64_t sum = 0;
+    for (const MetricShard &shard : s_shards)
+    {
+        sum += shard.slots[_slot].load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+CounterHandle::CounterHandle(const std::string &name) : _counter(GetMetrics().GetCounter(name))
+{
+    if (auto *sharded = dynamic_cast<ShardedCounterImpl *>(_counter.get()))
+    {
+        _slot = sharded->GetSlot();
+    }
+}
+
 MetricsCollector::MetricsCollector()
 {
     _acceptCounter = GetCounter("server_accepts");
@@ -20,7 +59,10 @@ std::shared_ptr<Counter> MetricsCollector::GetCounter(const std::string &name)
     std::lock_guard<std::mutex> lock(_mutex);
     if (_registry.find(name) == _registry.end())
     {
-        _registry[name] = std::make_shared<CounterImpl>();
+        if (_nextShardSlot < MetricShards::MAX_COUNTERS)
+            _registry[name] = std::make_shared<ShardedCounterImpl>(_nextShardSlot++);
+        else
+            _registry[name] = std::make_shared<CounterImpl>();
     }
     // Dynamic cast check could be added here for safety
     return std::static_pointer_cast<Counter>(_registry[name]);
@@ -26,6 +26,29 @@ private:
     std::atomic<uint64_t> _value{0};
 };
 
+// [Sharded] Increment 는 스레드 샤드 슬롯에, GetValue 는 모든 샤드 합산
+class ShardedCounterImpl : public Counter
+{
+public:
+    explicit ShardedCounterImpl(uint32_t slot) : _slot(slot)
+    {
+    }
+
+    void Increment(uint64_t value = 1) override
+    {
+        MetricShards::ForThisThread()[_slot].fetch_add(value, std::memory_order_relaxed);
+    }
+    uint64_t GetValue() const override;
+
+    uint32_t GetSlot() const
+    {
+        return _slot;
+    }
+
+private:
+    const uint32_t _slot;
+};
+
 class GaugeImpl : public Gauge
 {
 public:
@@ -57,6 +80,7 @@ public:
 private:
     std::mutex _mutex;
     std::map<std::string, std::shared_ptr<IMetric>> _registry;
+    uint32_t _nextShardSlot = 0;
 
     // Cached Common Metrics for Performance
     std::shared_ptr<Counter> _acceptCounter;
@@ -0,0 +1,90 @@
+#include "System/Network/IoBackend.h"
+#include "System/ILog.h"
+#include <atomic>
+
+namespace System {
+
+namespace {
+std::atomic<RecvBlockRegistration *> s_activeRegistration{nullptr};
+} // namespace
+
+IoBackend ParseIoBackend(std::string_view name)
+{
+    if (name == "io_uring" || name == "iouring")
+        return IoBackend::IoUring;
+    return IoBackend::Epoll;
+}
+
+const char *ToString(IoBackend backend)
+{
+    switch (backend)
+    {
+    case IoBackend::IoUring:
+        return "io_uring";
+    case IoBackend::Epoll:
+    default:
+        return "epoll";
+    }
+}
+
+IoBackend GetCompiledIoBackend()
+{
+#if defined(BOOST_ASIO_HAS_IO_URING) && defined(BOOST_ASIO_DISABLE_EPOLL)
+    return IoBackend::IoUring;
+#else
+    return IoBackend::Epoll;
+#endif
+}
+
+IoBackend ResolveIoBackend(std::string_view requested)
+{
+    IoBackend wanted = ParseIoBackend(requested);
+    IoBackend compiled = GetCompiledIoBackend();
+    if (wanted != compiled)
+    {
+        LOG_WARN(
+            "IO Backend '{}' requested but this build uses '{}' (rebuild with -DENABLE_IO_URING={})",
+            ToString(wanted),
+            ToString(compiled),
+            wanted == IoBackend::IoUring ? "ON" : "OFF"
+        );
+    }
+    return compiled;
+}
+
+#if defined(BOOST_ASIO_HAS_IO_URING)
+static std::vector<boost::asio::mutable_buffer> ArenaBuffers(size_t blockCount)
+{
+    RecvBuffer::ReserveArena(blockCount);
+
+    std::vector<boost::asio::mutable_buffer> buffers;
+    uint8_t *base = RecvBuffer::GetArenaBase();
+    for (size_t i = 0; i < RecvBuffer::GetArenaBlockCount(); ++i)
+        buffers.emplace_back(base + i * RecvBuffer::DEFAULT_CAPACITY, RecvBuffer::DEFAULT_CAPACITY);
+    return buffers;
+}
+
+RecvBlockRegistration::RecvBlockRegistration(boost::asio::io_context &ioContext, size_t blockCount)
+    : _registration(boost::asio::register_buffers(ioContext, ArenaBuffers(blockCount)))
+{
+    s_activeRegistration.store(this, std::memory_order_release);
+    LOG_INFO("io_uring: {} RecvBuffer blocks registered as fixed buffers", RecvBuffer::GetArenaBlockCount());
+}
+#else
+RecvBlockRegistration::RecvBlockRegistration(boost::asio::io_context &, size_t)
+{
+}
+#endif
+
+RecvBlockRegistration::~RecvBlockRegistration()
+{
+    RecvBlockRegistration *self = this;
+    s_activeRegistration.compare_exchange_strong(self, nullptr, std::memory_order_acq_rel);
+}
+
+RecvBlockRegistration *RecvBlockRegistration::Active()
+{
+    return s_activeRegistration.load(std::memory_order_acquire);
+}
+
+} // namespace System
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "System/Network/RecvBuffer.h"
+#include <boost/asio.hpp>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace System {
+
+/**
+ * @brief IO 백엔드 (Boost.Asio Reactor)
+ *
+ * - Epoll:   기본 (Linux epoll / Windows IOCP)
+ * - IoUring: io_uring (CMake ENABLE_IO_URING -> BOOST_ASIO_HAS_IO_URING + BOOST_ASIO_DISABLE_EPOLL)
+ *
+ * Asio 의 Reactor 는 컴파일 타임에 결정되므로 Config 의 io_backend 는 "요청" 이다.
+ * 빌드된 백엔드와 다르면 경고를 남기고 빌드된 백엔드로 동작한다 (ResolveIoBackend).
+ */
+enum class IoBackend : uint8_t
+{
+    Epoll = 0,
+    IoUring,
+};
+
+// Config 문자열 ("epoll", "io_uring") -> IoBackend (알 수 없으면 Epoll)
+IoBackend ParseIoBackend(std::string_view name);
+const char *ToString(IoBackend backend);
+
+IoBackend GetCompiledIoBackend();
+// Requested backend if this build has it, otherwise the compiled one (logs the decision)
+IoBackend ResolveIoBackend(std::string_view requested);
+
+/**
+ * @brief RecvBuffer Block Arena 의 io_uring Fixed Buffer 등록
+ *
+ * 등록된 블록으로의 read 는 IORING_OP_READ_FIXED 로 나가 매번 페이지를 고정/해제하지 않는다.
+ * Arena 밖의 블록(힙 폴백)은 일반 read 로 처리된다.
+ * 소유자(NetworkImpl)가 io_context 보다 먼저 파괴해야 한다. Epoll 빌드에서는 아무 것도 하지 않는다.
+ */
+class RecvBlockRegistration
+{
+public:
+    // Reserves the RecvBuffer arena (blockCount blocks) and registers it. Throws boost::system::system_error.
+    RecvBlockRegistration(boost::asio::io_context &ioContext, size_t blockCount);
+    ~RecvBlockRegistration();
+
+    RecvBlockRegistration(const RecvBlockRegistration &) = delete;
+    RecvBlockRegistration &operator=(const RecvBlockRegistration &) = delete;
+
+    // Registration used by AsyncReadSome (nullptr = none)
+    static RecvBlockRegistration *Active();
+
+#if defined(BOOST_ASIO_HAS_IO_URING)
+    boost::asio::mutable_registered_buffer At(int32_t index)
+    {
+        return _registration[static_cast<size_t>(index)];
+    }
+
+private:
+    boost::asio::buffer_registration<std::vector<boost::asio::mutable_buffer>> _registration;
+#endif
+};
+
+// async_read_some into the free space of buffer (fixed buffer when the block is registered)
+template <typename Handler>
+void AsyncReadSome(boost::asio::ip::tcp::socket &socket, RecvBuffer &buffer, Handler &&handler)
+{
+#if defined(BOOST_ASIO_HAS_IO_URING)
+    if (RecvBlockRegistration *registration = RecvBlockRegistration::Active())
+    {
+        int32_t index = RecvBuffer::ArenaIndexOf(buffer.BlockBase());
+        if (index >= 0)
+        {
+            auto fixed = registration->At(index) + static_cast<size_t>(buffer.WritePos() - buffer.BlockBase());
+            socket.async_read_some(
+                boost::asio::buffer(fixed, static_cast<size_t>(buffer.FreeSize())), std::forward<Handler>(handler)
+            );
+            return;
+        }
+    }
+#endif
+    socket.async_read_some(boost::asio::buffer(buffer.WritePos(), buffer.FreeSize()), std::forward<Handler>(handler));
+}
+
+} // namespace System
@@ -1,5 +1,6 @@
 #include "System/Network/NetworkImpl.h"
 #include "System/ILog.h"
+#include "System/Network/IoBackend.h"
 #include "System/Network/UDPEndpointRegistry.h"
 #include "System/Network/UDPNetworkImpl.h"
 #include "System/Network/WebSocketNetworkImpl.h"
@@ -27,6 +28,37 @@ NetworkImpl::~NetworkImpl()
         delete _wsNetwork;
         _wsNetwork = nullptr;
     }
+    _recvRegistration.reset();
+}
+
+bool NetworkImpl::RegisterRecvBlocks(size_t blockCount)
+{
+    try
+    {
+        _recvRegistration = std::make_unique<RecvBlockRegistration>(_ioContext, blockCount);
+        return true;
+    } catch (const std::exception &e)
+    {
+        // RLIMIT_MEMLOCK / kernel limits: keep running with plain reads
+        LOG_WARN("io_uring fixed buffer registration failed ({}), using plain reads", e.what());
+        return false;
+    }
+}
+
+void NetworkImpl::SetUdpShards(size_t count, std::vector<int> cpus)
+{
+    if (_udpNetwork)
+    {
+        _udpNetwork->SetShardCount(count, std::move(cpus));
+    }
+}
+
+void NetworkImpl::SetUdpBatching(size_t batchSize, bool gso)
+{
+    if (_udpNetwork)
+    {
+        _udpNetwork->SetBatching(batchSize, gso);
+    }
 }
 
 bool NetworkImpl::Start(uint16_t port)
@@ -94,6 +126,12 @@ void NetworkImpl::Stop()
         _wsNetwork->Stop();
     }
 
+    // Joins the UDP shard threads (their io_contexts are not _ioContext)
+    if (_udpNetwork)
+    {
+        _udpNetwork->Stop();
+    }
+
     if (!_ioContext.stopped())
     {
         _ioContext.stop();
@@ -6,6 +6,7 @@
 namespace System {
 
 class IDispatcher;
+class RecvBlockRegistration;
 class UDPNetworkImpl;
 class WebSocketNetworkImpl;
 
@@ -29,6 +30,14 @@ public:
         _dispatcher = dispatcher;
     }
 
+    // [io_uring] Register blockCount RecvBuffer arena blocks as fixed buffers (false = plain reads)
+    bool RegisterRecvBlocks(size_t blockCount);
+
+    // [SO_REUSEPORT] UDP socket shards and their thread CPUs (before Start)
+    void SetUdpShards(size_t count, std::vector<int> cpus);
+    // [recvmmsg/sendmmsg] UDP batch size (0 = off) and UDP GSO (before Start)
+    void SetUdpBatching(size_t batchSize, bool gso);
+
     // WebSocket 접근자 (디버그/모니터링용)
     WebSocketNetworkImpl *GetWebSocket()
     {
@@ -40,6 +49,7 @@ private:
 
 private:
     boost::asio::io_context _ioContext;
+    std::unique_ptr<RecvBlockRegistration> _recvRegistration; // Released before _ioContext
     boost::asio::ip::tcp::acceptor _acceptor;
     UDPNetworkImpl *_udpNetwork = nullptr;
     WebSocketNetworkImpl *_wsNetwork = nullptr;
@@ -1,21 +1,186 @@
 #include "System/Network/RecvBuffer.h"
+#include <atomic>
+#include <cassert>
+#include <concurrentqueue/moodycamel/concurrentqueue.h>
 #include <cstring> // std::memmove
+#include <memory>
+#include <mutex> // std::call_once
+#include <new> // placement new (shared block header)
 
 namespace System {
 
+namespace {
+
+// Shared free list of DEFAULT_CAPACITY blocks (any IO thread may take/return)
+struct RecvBlockPool
+{
+    moodycamel::ConcurrentQueue<uint8_t *> blocks;
+    std::atomic<size_t> pooled{0};
+    std::atomic<size_t> attached{0};
+
+    uint8_t *Take()
+    {
+        attached.fetch_add(1, std::memory_order_relaxed);
+        uint8_t *block;
+        if (blocks.try_dequeue(block))
+        {
+            pooled.fetch_sub(1, std::memory_order_relaxed);
+            return block;
+        }
+        return new uint8_t[RecvBuffer::DEFAULT_CAPACITY];
+    }
+
+    void Give(uint8_t *block)
+    {
+        attached.fetch_sub(1, std::memory_order_relaxed);
+        // Soft cap: a racing Give may overshoot by a few blocks, which is harmless
+        // Arena blocks always go back to the queue (they are never freed)
+        if (RecvBuffer::ArenaIndexOf(block) < 0 &&
+            pooled.load(std::memory_order_relaxed) >= RecvBuffer::MAX_POOLED_BLOCKS)
+        {
+            delete[] block;
+            return;
+        }
+        pooled.fetch_add(1, std::memory_order_relaxed);
+        blocks.enqueue(block);
+    }
+};
+
+// [Block Arena] Published once by ReserveArena, read lock-free by ArenaIndexOf
+std::atomic<uint8_t *> s_arenaBase{nullptr};
+std::atomic<size_t> s_arenaBlocks{0};
+
+// Never destroyed: sessions owned by other statics (SessionPool) may still return blocks at exit
+RecvBlockPool &GetBlockPool()
+{
+    static RecvBlockPool *pool = new RecvBlockPool();
+    return *pool;
+}
+
+// [Shared Blocks] Lives in the first SHARED_HEADER bytes of a shared block
+struct SharedBlockHeader
+{
+    std::atomic<int32_t> refs{1}; // Owning RecvBuffer + one per outstanding PacketRefMessage
+};
+static_assert(sizeof(SharedBlockHeader) <= RecvBuffer::SHARED_HEADER);
+
+SharedBlockHeader *HeaderOf(uint8_t *block)
+{
+    return reinterpret_cast<SharedBlockHeader *>(block);
+}
+
+} // namespace
+
 RecvBuffer::RecvBuffer(int32_t bufferSize) : _capacity(bufferSize), _readPos(0), _writePos(0)
 {
-    _buffer.resize(_capacity);
+}
+
+RecvBuffer::~RecvBuffer()
+{
+    _readPos = _writePos = 0;
+    Detach();
+}
+
+void RecvBuffer::Attach()
+{
+    if (_buffer)
+        return;
+
+    if (_capacity == DEFAULT_CAPACITY)
+        _buffer = GetBlockPool().Take();
+    else
+        _buffer = new uint8_t[_capacity];
+
+    if (_shared)
+        new (_buffer) SharedBlockHeader();
+    _readPos = _writePos = DataBegin();
+}
+
+void RecvBuffer::Detach()
+{
+    if (!_buffer)
+        return;
+
+    assert(DataSize() == 0 && "RecvBuffer::Detach with pending data");
+
+    if (_shared)
+        ReleaseBlock(_buffer); // Frames still in flight keep the block alive
+    else if (_capacity == DEFAULT_CAPACITY)
+        GetBlockPool().Give(_buffer);
+    else
+        delete[] _buffer;
+
+    _buffer = nullptr;
+    _readPos = _writePos = 0;
+}
+
+void RecvBuffer::SetShared(bool shared)
+{
+    assert(_buffer == nullptr && "RecvBuffer::SetShared while attached");
+    assert((!shared || _capacity == DEFAULT_CAPACITY) && "Shared blocks come from the block pool");
+    _shared = shared;
+}
+
+uint8_t *RecvBuffer::RetainBlock()
+{
+    assert(_shared && _buffer);
+    HeaderOf(_buffer)->refs.fetch_add(1, std::memory_order_relaxed);
+    return _buffer;
+}
+
+void RecvBuffer::ReleaseBlock(uint8_t *block)
+{
+    if (HeaderOf(block)->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        GetBlockPool().Give(block);
+}
+
+bool RecvBuffer::IsReferenced() const
+{
+    return HeaderOf(_buffer)->refs.load(std::memory_order_acquire) > 1;
+}
+
+void RecvBuffer::Rotate()
+{
+    uint8_t *old = _buffer;
+    int32_t dataSize = DataSize();
+
+    _buffer = GetBlockPool().Take();
+    new (_buffer) SharedBlockHeader();
+    // [Boundary Copy] Only the partial frame that straddles the end of the old block
+    std::memcpy(_buffer + SHARED_HEADER, old + _readPos, dataSize);
+    _readPos = SHARED_HEADER;
+    _writePos = SHARED_HEADER + dataSize;
+
+    ReleaseBlock(old);
+}
+
+bool RecvBuffer::Append(const uint8_t *data, int32_t size)
+{
+    Attach();
+    Clean();
+    if (size > FreeSize())
+        return false;
+    std::memcpy(WritePos(), data, size);
+    _writePos += size;
+    return true;
 }
 
 void RecvBuffer::Clean()
 {
     int32_t dataSize = DataSize();
 
+    // [Shared Blocks] Frames handed out still point into this block: never rewind, only move on
+    if (_shared && IsReferenced())
+    {
+        if (FreeSize() < COMPACT_THRESHOLD)
+            Rotate();
+        return;
+    }
+
     if (dataSize == 0)
     {
         // [Fast Path] No data, just reset cursors
-        _readPos = _writePos = 0;
+        _readPos = _writePos = DataBegin();
         return;
     }
 
@@ -27,9 +192,9 @@ void RecvBuffer::Clean()
     {
         // [Slow Path] Move remaining data to front
         // std::memmove is safe for overlapping regions
-        std::memmove(_buffer.data(), _buffer.data() + _readPos, dataSize);
-        _readPos = 0;
-        _writePos = dataSize;
+        std::memmove(_buffer + DataBegin(), _buffer + _readPos, dataSize);
+        _readPos = DataBegin();
+        _writePos = DataBegin() + dataSize;
     }
 }
 
@@ -49,4 +214,71 @@ bool RecvBuffer::MoveWritePos(int32_t numOfBytes)
     return true;
 }
 
+uint8_t *RecvBuffer::GetThreadScratch()
+{
+    // Lazily allocated: only threads that actually complete parked reads pay for it
+    thread_local std::unique_ptr<uint8_t[]> scratch;
+    if (!scratch)
+        scratch = std::make_unique<uint8_t[]>(SCRATCH_CAPACITY);
+    return scratch.get();
+}
+
+bool RecvBuffer::ReserveArena(size_t blockCount)
+{
+    static std::once_flag once;
+    bool reserved = false;
+    std::call_once(
+        once,
+        [&]()
+        {
+            if (blockCount == 0)
+                return;
+            // Page aligned: fixed-buffer registration pins whole pages
+            auto *base = static_cast<uint8_t *>(::operator new(blockCount * DEFAULT_CAPACITY, std::align_val_t{4096}));
+            s_arenaBlocks.store(blockCount, std::memory_order_relaxed);
+            s_arenaBase.store(base, std::memory_order_release);
+
+            RecvBlockPool &pool = GetBlockPool();
+            for (size_t i = 0; i < blockCount; ++i)
+            {
+                pool.pooled.fetch_add(1, std::memory_order_relaxed);
+                pool.blocks.enqueue(base + i * DEFAULT_CAPACITY);
+            }
+            reserved = true;
+        }
+    );
+    return reserved;
+}
+
+uint8_t *RecvBuffer::GetArenaBase()
+{
+    return s_arenaBase.load(std::memory_order_acquire);
+}
+
+size_t RecvBuffer::GetArenaBlockCount()
+{
+    return GetArenaBase() != nullptr ? s_arenaBlocks.load(std::memory_order_relaxed) : 0;
+}
+
+int32_t RecvBuffer::ArenaIndexOf(const uint8_t *block)
+{
+    const uint8_t *base = s_arenaBase.load(std::memory_order_acquire);
+    if (base == nullptr || block < base)
+        return -1;
+    size_t offset = static_cast<size_t>(block - base);
+    if (offset >= s_arenaBlocks.load(std::memory_order_relaxed) * DEFAULT_CAPACITY)
+        return -1;
+    return static_cast<int32_t>(offset / DEFAULT_CAPACITY);
+}
+
+size_t RecvBuffer::GetAttachedBlockCount()
+{
+    return GetBlockPool().attached.load(std::memory_order_relaxed);
+}
+
+size_t RecvBuffer::GetPooledBlockCount()
+{
+    return GetBlockPool().pooled.load(std::memory_order_relaxed);
+}
+
 } // namespace System
@@ -1,7 +1,7 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
-#include <vector>
 
 namespace System {
 
@@ -13,11 +13,32 @@ namespace System {
     - Single IO thread access (no locks needed)
     - Tuned for typical MMORPG packet sizes (~100B - 4KB)
 
+    [Lazy Storage]
+    - 생성 시점에는 메모리를 잡지 않습니다. Attach() 가 첫 read 직전에 블록을 붙이고,
+      Detach()/Reset() 이 비어 있는 블록을 공용 블록 풀(lock-free)로 돌려줍니다.
+    - 세션 풀에 대기 중인 세션, 읽기를 멈춘(backpressure) 빈 세션은 버퍼를 들고 있지 않습니다.
+    - DEFAULT_CAPACITY 블록만 풀링되며, 그 외 크기는 new/delete 로 처리됩니다.
+
+    [Parked Reads] (SessionFactory::SetParkIdleReads)
+    - 유휴 세션은 블록 없이 readiness 만 기다리고, 도착한 데이터는 IO 스레드별 scratch(GetThreadScratch)로
+      읽어 그 자리에서 프레이밍합니다. 잘린(partial) 프레임이 남을 때만 Append() 로 블록을 빌립니다.
+
+    [Shared Blocks] (SetShared, 암호화 없는 세션의 Zero-Copy 프레이밍)
+    - 블록 앞 SHARED_HEADER 바이트에 참조 카운트를 두고, 프레임마다 RetainBlock() 으로 참조를 넘겨
+      복사 없이 PacketRefMessage 로 로직 스레드에 전달합니다.
+    - 참조가 남아 있는 동안에는 블록을 되감거나 압축하지 않고 뒤로만 씁니다.
+      여유 공간이 부족해지면 새 블록으로 넘어가며, 이때 경계에 걸친 미완성 프레임만 복사됩니다.
+
+    [Block Arena] (ReserveArena, io_uring 백엔드)
+    - DEFAULT_CAPACITY 블록을 연속된 Arena 로 미리 잡아 풀에 넣습니다. Arena 블록은 힙으로 돌아가지 않으며,
+      io_uring Fixed Buffer 로 등록해 두면 read 시 페이지 고정/해제 비용이 사라집니다 (IoBackend.h).
+
     [Thread Safety]
     - 이 클래스는 IO 스레드(Completion 핸들러)에 의해 독점적으로 접근됩니다.
     - 로직 스레드로는 데이터의 복사본(Packet Object)이 전달되므로, 버퍼 자체에 대한 별도의 동기화(Lock)가 필요
    전무합니다.
     - 설계 의도: Lock-Free를 통한 성능 확보 및 메모리 연속성(Cache Locality) 극대화.
+    - 블록 풀만 스레드 간 공유됩니다 (moodycamel::ConcurrentQueue).
 
     [Hot Path Optimization]
     - OnWrite/OnRead: O(1), no branches in fast path
@@ -35,25 +56,62 @@ public:
     // Higher = less compaction, but risk of buffer full
     static constexpr int32_t COMPACT_THRESHOLD = 10 * 1024; // 10KB
 
+    // [Tuning] Idle blocks kept in the shared pool (beyond this they go back to the heap)
+    static constexpr size_t MAX_POOLED_BLOCKS = 1024; // 64MB
+
+    // [Tuning] Per-IO-thread scratch for parked reads (one read_some worth of data)
+    static constexpr int32_t SCRATCH_CAPACITY = 16 * 1024; // 16KB
+
+    // [Shared Blocks] Refcount header in front of the data (one cache line)
+    static constexpr int32_t SHARED_HEADER = 64;
+
     RecvBuffer(int32_t bufferSize = DEFAULT_CAPACITY);
-    ~RecvBuffer() = default;
+    ~RecvBuffer();
+
+    RecvBuffer(const RecvBuffer &) = delete;
+    RecvBuffer &operator=(const RecvBuffer &) = delete;
+
+    // Before handing WritePos() to a read: takes a block if none is attached
+    void Attach();
+    // Gives the block back (only while no data is pending); cursors rewind
+    void Detach();
+    bool IsAttached() const
+    {
+        return _buffer != nullptr;
+    }
+
+    // [Shared Blocks] Only while detached, DEFAULT_CAPACITY buffers only
+    void SetShared(bool shared);
+    bool IsShared() const
+    {
+        return _shared;
+    }
+    // +1 reference on the attached block for a frame handed to another thread
+    uint8_t *RetainBlock();
+    // Drops one reference (any thread); the last one returns the block to the shared pool
+    static void ReleaseBlock(uint8_t *block);
+
+    // Attach + copy in (e.g. the partial frame left over in the scratch buffer)
+    bool Append(const uint8_t *data, int32_t size);
 
     void Clean();
     bool MoveReadPos(int32_t numOfBytes);
     bool MoveWritePos(int32_t numOfBytes);
 
+    // Connection reuse: drops pending bytes and releases the block
     void Reset()
     {
         _readPos = _writePos = 0;
+        Detach();
     }
 
     uint8_t *ReadPos()
     {
-        return &_buffer[_readPos];
+        return _buffer + _readPos;
     }
     uint8_t *WritePos()
     {
-        return &_buffer[_writePos];
+        return _buffer + _writePos;
     }
 
     int32_t DataSize() const
@@ -62,14 +120,50 @@ public:
     }
     int32_t FreeSize() const
     {
-        return _capacity - _writePos;
+        return _buffer ? _capacity - _writePos : 0;
+    }
+
+    // Largest frame a block can hold; larger ones would fill it and never complete.
+    // Shared blocks lose SHARED_HEADER bytes to the refcount.
+    int32_t MaxFrameSize() const
+    {
+        return _capacity - DataBegin();
     }
 
+    // SCRATCH_CAPACITY bytes owned by the calling thread.
+    // Only valid inside one synchronous read + parse; never hand it to an async operation.
+    static uint8_t *GetThreadScratch();
+
+    // Block under the cursors (nullptr while detached)
+    const uint8_t *BlockBase() const
+    {
+        return _buffer;
+    }
+
+    // [Block Arena] One contiguous run of blockCount pooled blocks (first call only, returns false after)
+    static bool ReserveArena(size_t blockCount);
+    static uint8_t *GetArenaBase();
+    static size_t GetArenaBlockCount();
+    // Arena slot of a block, -1 if it came from the heap
+    static int32_t ArenaIndexOf(const uint8_t *block);
+
+    // [Metrics] Blocks currently attached to a buffer / parked in the shared pool
+    static size_t GetAttachedBlockCount();
+    static size_t GetPooledBlockCount();
+
 private:
+    int32_t DataBegin() const
+    {
+        return _shared ? SHARED_HEADER : 0;
+    }
+    bool IsReferenced() const; // Shared block still used by a PacketRefMessage
+    void Rotate();             // Shared block: continue in a fresh block with the pending bytes
+
     int32_t _capacity = 0;
     int32_t _readPos = 0;
     int32_t _writePos = 0;
-    std::vector<uint8_t> _buffer;
+    uint8_t *_buffer = nullptr;
+    bool _shared = false;
 };
 
 } // namespace System
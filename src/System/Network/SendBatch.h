@@ -0,0 +1,123 @@
+#pragma once
+
+#include "System/Dispatcher/IMessage.h"
+#include "System/Dispatcher/MessagePool.h"
+#include <boost/asio/buffer.hpp>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace System {
+
+/*
+    Scatter-Gather Send Batch for plain (unencrypted) TCP sessions.
+
+    [Design]
+    - Shared packets (refCount > 1, e.g. PacketBroadcast / SendToSessions) are referenced in place.
+      The payload is written straight from the single shared PacketMessage -> no per-recipient copy.
+    - Private packets (refCount == 1) are small unicast replies; they are copied into one linear
+      segment so a burst of tiny packets does not become one iovec each.
+    - Consecutive private packets share a single const_buffer.
+
+    [Thread Safety]
+    - Owned by one session and touched only by its Flush / write completion (same as _linearBuffer).
+*/
+class SendBatch
+{
+public:
+    SendBatch()
+    {
+        _linear.reserve(16 * 1024);
+    }
+
+    ~SendBatch()
+    {
+        Clear();
+    }
+
+    SendBatch(const SendBatch &) = delete;
+    SendBatch &operator=(const SendBatch &) = delete;
+
+    // Takes ownership of items[0..count) (one reference each)
+    void Build(PacketMessage *const *items, size_t count)
+    {
+        Clear();
+
+        // Reserve up front: const_buffers point into _linear, so it must not reallocate below
+        size_t privateBytes = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!IsShared(items[i]))
+                privateBytes += items[i]->length;
+        }
+        if (_linear.capacity() < privateBytes)
+            _linear.reserve(privateBytes);
+        _linear.resize(privateBytes);
+
+        size_t offset = 0;
+        bool lastIsLinear = false;
+        for (size_t i = 0; i < count; ++i)
+        {
+            PacketMessage *msg = items[i];
+            if (IsShared(msg))
+            {
+                _buffers.push_back(boost::asio::buffer(msg->Payload(), msg->length));
+                _holding.push_back(msg);
+                lastIsLinear = false;
+                continue;
+            }
+
+            std::memcpy(_linear.data() + offset, msg->Payload(), msg->length);
+            if (lastIsLinear)
+            {
+                const boost::asio::const_buffer &last = _buffers.back();
+                _buffers.back() = boost::asio::buffer(last.data(), last.size() + msg->length);
+            }
+            else
+            {
+                _buffers.push_back(boost::asio::buffer(_linear.data() + offset, msg->length));
+            }
+            offset += msg->length;
+            lastIsLinear = true;
+            MessagePool::Free(msg);
+        }
+        _copiedBytes = privateBytes;
+    }
+
+    // Call after the write completes: drops the references to shared packets
+    void Clear()
+    {
+        for (PacketMessage *msg : _holding)
+        {
+            MessagePool::Free(msg);
+        }
+        _holding.clear();
+        _buffers.clear();
+        _linear.clear();
+        _copiedBytes = 0;
+    }
+
+    const std::vector<boost::asio::const_buffer> &Buffers() const
+    {
+        return _buffers;
+    }
+
+    // Bytes memcpy'd by the last Build() (shared packets excluded)
+    size_t CopiedBytes() const
+    {
+        return _copiedBytes;
+    }
+
+private:
+    static bool IsShared(const PacketMessage *msg)
+    {
+        return msg->refCount.load(std::memory_order_relaxed) > 1;
+    }
+
+    std::vector<boost::asio::const_buffer> _buffers;
+    std::vector<PacketMessage *> _holding;
+    std::vector<uint8_t> _linear;
+    size_t _copiedBytes = 0;
+};
+
+} // namespace System
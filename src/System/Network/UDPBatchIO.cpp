@@ -0,0 +1,320 @@
+#include "System/Network/UDPBatchIO.h"
+#include "System/ILog.h"
+#include "System/Network/UDPLimits.h"
+#include "System/Network/UDPSendContextPool.h"
+#include <algorithm>
+#include <array>
+#include <boost/asio/error.hpp>
+#include <vector>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#endif
+
+namespace System {
+
+bool IsUDPBatchIOSupported()
+{
+#if defined(__linux__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+#if defined(__linux__)
+
+// Kernel limits for one UDP_SEGMENT send (UDP_MAX_SEGMENTS, 16-bit IP length)
+static constexpr size_t GSO_MAX_SEGMENTS = 64;
+static constexpr size_t GSO_MAX_BYTES = 65000;
+
+static bool IsWouldBlock(int err)
+{
+    return err == EAGAIN || err == EWOULDBLOCK;
+}
+
+struct UDPRecvBatch::Impl
+{
+    std::vector<uint8_t> slots;
+    std::vector<iovec> iovecs;
+    std::vector<sockaddr_storage> addrs;
+    std::vector<mmsghdr> msgs;
+};
+
+UDPRecvBatch::UDPRecvBatch(size_t batchSize) : _impl(std::make_unique<Impl>())
+{
+    batchSize = std::max<size_t>(batchSize, 1);
+    _impl->slots.resize(batchSize * SLOT_BYTES);
+    _impl->iovecs.resize(batchSize);
+    _impl->addrs.resize(batchSize);
+    _impl->msgs.resize(batchSize);
+    for (size_t i = 0; i < batchSize; ++i)
+    {
+        _impl->iovecs[i].iov_base = _impl->slots.data() + i * SLOT_BYTES;
+        _impl->iovecs[i].iov_len = SLOT_BYTES;
+    }
+}
+
+UDPRecvBatch::~UDPRecvBatch() = default;
+
+size_t UDPRecvBatch::Receive(int fd, boost::system::error_code &ec)
+{
+    ec.clear();
+    for (size_t i = 0; i < _impl->msgs.size(); ++i)
+    {
+        msghdr &hdr = _impl->msgs[i].msg_hdr;
+        std::memset(&hdr, 0, sizeof(hdr));
+        hdr.msg_name = &_impl->addrs[i];
+        hdr.msg_namelen = sizeof(sockaddr_storage);
+        hdr.msg_iov = &_impl->iovecs[i];
+        hdr.msg_iovlen = 1;
+        _impl->msgs[i].msg_len = 0;
+    }
+
+    int received;
+    do
+    {
+        received = recvmmsg(fd, _impl->msgs.data(), static_cast<unsigned>(_impl->msgs.size()), MSG_DONTWAIT, nullptr);
+    } while (received < 0 && errno == EINTR);
+
+    if (received < 0)
+    {
+        if (!IsWouldBlock(errno))
+            ec.assign(errno, boost::system::system_category());
+        return 0;
+    }
+    return static_cast<size_t>(received);
+}
+
+size_t UDPRecvBatch::Capacity() const
+{
+    return _impl->msgs.size();
+}
+
+const uint8_t *UDPRecvBatch::Data(size_t index) const
+{
+    return _impl->slots.data() + index * SLOT_BYTES;
+}
+
+size_t UDPRecvBatch::Size(size_t index) const
+{
+    return std::min<size_t>(_impl->msgs[index].msg_len, SLOT_BYTES);
+}
+
+bool UDPRecvBatch::Truncated(size_t index) const
+{
+    return (_impl->msgs[index].msg_hdr.msg_flags & MSG_TRUNC) != 0;
+}
+
+boost::asio::ip::udp::endpoint UDPRecvBatch::Sender(size_t index) const
+{
+    boost::asio::ip::udp::endpoint endpoint;
+    const socklen_t length = _impl->msgs[index].msg_hdr.msg_namelen;
+    std::memcpy(endpoint.data(), &_impl->addrs[index], std::min<size_t>(length, endpoint.capacity()));
+    endpoint.resize(length);
+    return endpoint;
+}
+
+struct UDPSendBatch::Impl
+{
+    bool gso = false;
+    std::vector<mmsghdr> msgs;
+    std::vector<iovec> iovecs;           // 2 per datagram: transport header + payload
+    std::vector<sockaddr_storage> addrs; // 1 per message
+    std::vector<size_t> datagramsPerMsg;
+    std::vector<std::array<uint8_t, CMSG_SPACE(sizeof(uint16_t))>> controls;
+};
+
+UDPSendBatch::UDPSendBatch(size_t batchSize, bool gso) : _impl(std::make_unique<Impl>())
+{
+    batchSize = std::max<size_t>(batchSize, 1);
+    _impl->gso = gso;
+    _impl->msgs.resize(batchSize);
+    _impl->iovecs.resize(batchSize * 2);
+    _impl->addrs.resize(batchSize);
+    _impl->datagramsPerMsg.resize(batchSize);
+    _impl->controls.resize(batchSize);
+}
+
+UDPSendBatch::~UDPSendBatch() = default;
+
+size_t UDPSendBatch::Send(int fd, UDPSendContext *const *contexts, size_t count, boost::system::error_code &ec)
+{
+    ec.clear();
+    count = std::min(count, _impl->msgs.size());
+
+    size_t msgCount = 0;
+    for (size_t first = 0; first < count;)
+    {
+        const UDPSendContext *head = contexts[first];
+        const size_t segmentBytes = UDP_TRANSPORT_HEADER_BYTES + head->payloadLen;
+
+        // [GSO] Same destination, same size (the last one may be shorter) -> one UDP_SEGMENT message
+        size_t last = first + 1;
+        size_t totalBytes = segmentBytes;
+        while (_impl->gso && last < count && last - first < GSO_MAX_SEGMENTS)
+        {
+            const UDPSendContext *next = contexts[last];
+            const size_t nextBytes = UDP_TRANSPORT_HEADER_BYTES + next->payloadLen;
+            if (next->destination != head->destination || nextBytes > segmentBytes ||
+                totalBytes + nextBytes > GSO_MAX_BYTES)
+                break;
+            totalBytes += nextBytes;
+            ++last;
+            if (nextBytes < segmentBytes)
+                break;
+        }
+
+        for (size_t i = first; i < last; ++i)
+        {
+            UDPSendContext *ctx = contexts[i];
+            _impl->iovecs[i * 2] = {ctx->headerBytes.data(), ctx->headerBytes.size()};
+            _impl->iovecs[i * 2 + 1] = {ctx->payload->Payload(), ctx->payloadLen};
+        }
+
+        std::memcpy(&_impl->addrs[msgCount], head->destination.data(), head->destination.size());
+
+        msghdr &hdr = _impl->msgs[msgCount].msg_hdr;
+        std::memset(&hdr, 0, sizeof(hdr));
+        hdr.msg_name = &_impl->addrs[msgCount];
+        hdr.msg_namelen = static_cast<socklen_t>(head->destination.size());
+        hdr.msg_iov = &_impl->iovecs[first * 2];
+        hdr.msg_iovlen = (last - first) * 2;
+        if (last - first > 1)
+        {
+            hdr.msg_control = _impl->controls[msgCount].data();
+            hdr.msg_controllen = _impl->controls[msgCount].size();
+            cmsghdr *cmsg = CMSG_FIRSTHDR(&hdr);
+            cmsg->cmsg_level = IPPROTO_UDP;
+            cmsg->cmsg_type = UDP_SEGMENT;
+            cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+            const uint16_t segment = static_cast<uint16_t>(segmentBytes);
+            std::memcpy(CMSG_DATA(cmsg), &segment, sizeof(segment));
+        }
+
+        _impl->datagramsPerMsg[msgCount] = last - first;
+        ++msgCount;
+        first = last;
+    }
+
+    int sent;
+    do
+    {
+        sent = sendmmsg(fd, _impl->msgs.data(), static_cast<unsigned>(msgCount), MSG_DONTWAIT);
+    } while (sent < 0 && errno == EINTR);
+
+    if (sent < 0)
+    {
+        const int err = errno;
+        if (IsWouldBlock(err))
+        {
+            ec = boost::asio::error::would_block;
+            return 0;
+        }
+        if (_impl->datagramsPerMsg[0] > 1 && (err == EIO || err == EINVAL || err == ENOPROTOOPT || err == EOPNOTSUPP))
+        {
+            // Kernel without UDP GSO or a device that cannot segment: fall back for good
+            LOG_WARN("UDP GSO rejected ({}), falling back to plain sendmmsg", std::strerror(err));
+            _impl->gso = false;
+            return Send(fd, contexts, count, ec);
+        }
+        ec.assign(err, boost::system::system_category());
+        return 0;
+    }
+
+    size_t datagrams = 0;
+    for (int i = 0; i < sent; ++i)
+        datagrams += _impl->datagramsPerMsg[i];
+    return datagrams;
+}
+
+size_t UDPSendBatch::Capacity() const
+{
+    return _impl->msgs.size();
+}
+
+bool UDPSendBatch::IsGsoEnabled() const
+{
+    return _impl->gso;
+}
+
+#else
+
+struct UDPRecvBatch::Impl
+{
+};
+
+UDPRecvBatch::UDPRecvBatch(size_t) : _impl(std::make_unique<Impl>())
+{
+}
+
+UDPRecvBatch::~UDPRecvBatch() = default;
+
+size_t UDPRecvBatch::Receive(int, boost::system::error_code &ec)
+{
+    ec = boost::asio::error::operation_not_supported;
+    return 0;
+}
+
+size_t UDPRecvBatch::Capacity() const
+{
+    return 0;
+}
+
+const uint8_t *UDPRecvBatch::Data(size_t) const
+{
+    return nullptr;
+}
+
+size_t UDPRecvBatch::Size(size_t) const
+{
+    return 0;
+}
+
+bool UDPRecvBatch::Truncated(size_t) const
+{
+    return false;
+}
+
+boost::asio::ip::udp::endpoint UDPRecvBatch::Sender(size_t) const
+{
+    return {};
+}
+
+struct UDPSendBatch::Impl
+{
+};
+
+UDPSendBatch::UDPSendBatch(size_t, bool) : _impl(std::make_unique<Impl>())
+{
+}
+
+UDPSendBatch::~UDPSendBatch() = default;
+
+size_t UDPSendBatch::Send(int, UDPSendContext *const *, size_t, boost::system::error_code &ec)
+{
+    ec = boost::asio::error::operation_not_supported;
+    return 0;
+}
+
+size_t UDPSendBatch::Capacity() const
+{
+    return 0;
+}
+
+bool UDPSendBatch::IsGsoEnabled() const
+{
+    return false;
+}
+
+#endif
+
+} // namespace System
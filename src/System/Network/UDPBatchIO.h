@@ -0,0 +1,79 @@
+#pragma once
+
+#include <boost/asio/ip/udp.hpp>
+#include <boost/system/error_code.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace System {
+
+struct UDPSendContext;
+
+/**
+ * @brief [Linux] recvmmsg / sendmmsg 배치 IO (UDPNetworkImpl 소켓 샤드 전용)
+ *
+ * - UDPRecvBatch: recvmmsg 한 번으로 최대 N 개 데이터그램을 고정 슬롯에 받는다.
+ * - UDPSendBatch: 쌓인 UDPSendContext 들을 sendmmsg 한 번으로 내보낸다.
+ *   GSO(UDP_SEGMENT) 사용 시 같은 목적지 + 같은 크기의 연속 데이터그램을 메시지 하나로 합친다.
+ *
+ * 둘 다 non-blocking 소켓 기준이며, 샤드 하나의 수신 체인 / 송신 스트랜드 안에서만 사용한다.
+ * Linux 외 플랫폼에서는 IsUDPBatchIOSupported() == false 이고 UDPNetworkImpl 은 기존 경로를 쓴다.
+ */
+bool IsUDPBatchIOSupported();
+
+class UDPRecvBatch
+{
+public:
+    // > UDP_MAX_DATAGRAM_BYTES and KCP's default 1400 byte MTU; larger datagrams are flagged Truncated
+    static constexpr size_t SLOT_BYTES = 2048;
+
+    explicit UDPRecvBatch(size_t batchSize);
+    ~UDPRecvBatch();
+
+    UDPRecvBatch(const UDPRecvBatch &) = delete;
+    UDPRecvBatch &operator=(const UDPRecvBatch &) = delete;
+
+    // Datagrams received (0 = nothing pending). ec is set only for hard errors.
+    size_t Receive(int fd, boost::system::error_code &ec);
+
+    size_t Capacity() const;
+    const uint8_t *Data(size_t index) const;
+    size_t Size(size_t index) const;
+    bool Truncated(size_t index) const;
+    boost::asio::ip::udp::endpoint Sender(size_t index) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+class UDPSendBatch
+{
+public:
+    UDPSendBatch(size_t batchSize, bool gso);
+    ~UDPSendBatch();
+
+    UDPSendBatch(const UDPSendBatch &) = delete;
+    UDPSendBatch &operator=(const UDPSendBatch &) = delete;
+
+    /**
+     * @brief contexts[0..count) 를 sendmmsg 로 송신
+     * @return 커널에 넘어간 앞쪽 컨텍스트 수 (count 이하)
+     *
+     * 0 을 반환하면 ec 를 확인한다:
+     * - would_block: 소켓 송신 버퍼가 가득 참 (쓰기 가능해질 때 다시 호출)
+     * - 그 외: contexts[0] 을 보낼 수 없음 (호출자가 드랍)
+     * GSO 가 커널/NIC 에서 거부되면 스스로 끄고 일반 sendmmsg 로 재시도한다.
+     */
+    size_t Send(int fd, UDPSendContext *const *contexts, size_t count, boost::system::error_code &ec);
+
+    size_t Capacity() const;
+    bool IsGsoEnabled() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+} // namespace System
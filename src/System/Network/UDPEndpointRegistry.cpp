@@ -1,135 +1,585 @@
 #include "System/Network/UDPEndpointRegistry.h"
-#include "System/ISession.h"
 #include "System/ILog.h"
 #include "System/Pch.h"
 #include <algorithm>
+#include <array>
+#include <cstring>
+#include <thread>
+#include <vector>
 
 namespace System {
 
-UDPEndpointRegistry::UDPEndpointRegistry()
+namespace {
+
+constexpr size_t SHARD_COUNT = 16;     // hash >> 60
+constexpr size_t INITIAL_SLOTS = 64;   // per shard, power of two
+constexpr uint64_t FAMILY_V4 = 4ull << 16;
+constexpr uint64_t FAMILY_V6 = 6ull << 16;
+constexpr uint64_t TOKEN_TAG = 1ull << 63;
+
+// Idle wheel: buckets keyed by last-activity time (10ms ticks), 4096 slots ~= 41s per revolution
+constexpr int64_t IDLE_TICK_MS = 10;
+constexpr size_t IDLE_WHEEL_SLOTS = 4096;
+constexpr size_t IDLE_WHEEL_MASK = IDLE_WHEEL_SLOTS - 1;
+
+// endpoint: {address hi, address lo, port | family | scope}, token: {high, low, TOKEN_TAG} (word 2 never 0)
+struct RegistryKey
 {
-}
+    uint64_t words[3];
+};
 
-UDPEndpointRegistry::~UDPEndpointRegistry()
+uint64_t Mix(uint64_t x)
 {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
 }
 
-void UDPEndpointRegistry::Register(const boost::asio::ip::udp::endpoint &endpoint, ISession *session)
+uint64_t HashOf(const RegistryKey &key)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    return Mix(key.words[0] ^ Mix(key.words[1] ^ Mix(key.words[2])));
+}
 
-    auto it = _sessions.find(endpoint);
-    if (it != _sessions.end())
+RegistryKey MakeKey(const boost::asio::ip::udp::endpoint &endpoint)
+{
+    RegistryKey key{};
+    const boost::asio::ip::address address = endpoint.address();
+    if (address.is_v4())
     {
-        // Update existing entry
-        it->second.session = session;
-        it->second.lastActivity = std::chrono::steady_clock::now();
+        key.words[1] = address.to_v4().to_uint();
+        key.words[2] = endpoint.port() | FAMILY_V4;
     }
     else
     {
-        // New entry
-        SessionInfo info;
-        info.session = session;
-        info.lastActivity = std::chrono::steady_clock::now();
-        _sessions[endpoint] = info;
+        const boost::asio::ip::address_v6 v6 = address.to_v6();
+        const auto bytes = v6.to_bytes();
+        std::memcpy(&key.words[0], bytes.data(), sizeof(uint64_t));
+        std::memcpy(&key.words[1], bytes.data() + sizeof(uint64_t), sizeof(uint64_t));
+        key.words[2] = endpoint.port() | FAMILY_V6 | (static_cast<uint64_t>(v6.scope_id()) << 32);
     }
+    return key;
+}
+
+RegistryKey MakeKey(uint128_t token)
+{
+    return RegistryKey{{token.high, token.low, TOKEN_TAG}};
 }
 
-ISession *UDPEndpointRegistry::Find(const boost::asio::ip::udp::endpoint &endpoint)
+int64_t IdleTick(std::chrono::steady_clock::time_point time)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    return std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count() / IDLE_TICK_MS;
+}
 
-    auto it = _sessions.find(endpoint);
-    if (it != _sessions.end())
+/**
+ * @brief Seqlock 으로 읽는 샤드별 Linear Probing 테이블 (key -> UDPSession*)
+ * session == nullptr 인 슬롯이 빈 슬롯이다.
+ */
+class SeqlockSessionMap
+{
+public:
+    struct Removed
     {
-        return it->second.session;
+        UDPSession *session = nullptr;
+        uint128_t token{0, 0};
+    };
+
+    SeqlockSessionMap()
+    {
+        for (Shard &shard : _shards)
+        {
+            shard.tables.push_back(std::make_unique<Table>(INITIAL_SLOTS));
+            shard.table.store(shard.tables.back().get(), std::memory_order_release);
+        }
     }
-    return nullptr;
-}
 
-void UDPEndpointRegistry::Remove(const boost::asio::ip::udp::endpoint &endpoint)
+    UDPSession *Find(const RegistryKey &key, uint64_t hash) const
+    {
+        return Read<UDPSession *>(
+            hash,
+            [&](const Table &table)
+            {
+                const Slot *slot = FindSlot(table, key, hash);
+                return slot != nullptr ? slot->session.load(std::memory_order_relaxed) : nullptr;
+            }
+        );
+    }
+
+    // Generation of the live mapping for key (0 if none)
+    uint64_t GenerationOf(const RegistryKey &key, uint64_t hash) const
+    {
+        return Read<uint64_t>(
+            hash,
+            [&](const Table &table)
+            {
+                const Slot *slot = FindSlot(table, key, hash);
+                return slot != nullptr ? slot->generation.load(std::memory_order_relaxed) : 0;
+            }
+        );
+    }
+
+    // Returns the generation of a new mapping, or 0 if key already mapped to session (registration unchanged).
+    // replaced (optional) receives the mapping that was overwritten, if any.
+    uint64_t Insert(
+        const RegistryKey &key, uint64_t hash, UDPSession *session, uint128_t token, Removed *replaced = nullptr
+    )
+    {
+        Shard &shard = ShardOf(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        Table *table = shard.table.load(std::memory_order_relaxed);
+        if ((shard.count + 1) * 2 > table->mask + 1)
+            table = Grow(shard);
+
+        size_t index = hash & table->mask;
+        UDPSession *previous = nullptr;
+        for (;; index = (index + 1) & table->mask)
+        {
+            Slot &slot = table->slots[index];
+            if (slot.session.load(std::memory_order_relaxed) == nullptr)
+                break;
+            if (slot.Matches(key))
+            {
+                previous = slot.session.load(std::memory_order_relaxed);
+                if (replaced != nullptr)
+                    *replaced = Removed{previous, slot.token};
+                break;
+            }
+        }
+
+        const uint64_t generation = previous == session ? table->slots[index].generation.load(std::memory_order_relaxed)
+                                                       : ++shard.generation;
+        BeginWrite(shard);
+        table->slots[index].Store(key, hash, session, token, generation);
+        EndWrite(shard);
+
+        if (previous == nullptr)
+            ++shard.count;
+        return previous == session ? 0 : generation;
+    }
+
+    // expected != nullptr: only erase while the key still maps to that session (and generation, if given)
+    Removed Erase(const RegistryKey &key, uint64_t hash, UDPSession *expected = nullptr, uint64_t generation = 0)
+    {
+        Shard &shard = ShardOf(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return EraseLocked(shard, key, hash, expected, generation);
+    }
+
+    size_t Size() const
+    {
+        size_t total = 0;
+        for (const Shard &shard : _shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            total += shard.count;
+        }
+        return total;
+    }
+
+private:
+    struct Slot
+    {
+        // Read racily by Find / GenerationOf (validated by the shard sequence)
+        std::atomic<uint64_t> words[3];
+        std::atomic<UDPSession *> session{nullptr};
+        std::atomic<uint64_t> generation{0}; // New per registration; tells a live idle-wheel entry from a stale one
+        // Writer-only (shard mutex)
+        uint64_t hash = 0;
+        uint128_t token{0, 0};
+
+        bool Matches(const RegistryKey &key) const
+        {
+            return words[0].load(std::memory_order_relaxed) == key.words[0] &&
+                   words[1].load(std::memory_order_relaxed) == key.words[1] &&
+                   words[2].load(std::memory_order_relaxed) == key.words[2];
+        }
+
+        RegistryKey Key() const
+        {
+            return RegistryKey{
+                {words[0].load(std::memory_order_relaxed),
+                 words[1].load(std::memory_order_relaxed),
+                 words[2].load(std::memory_order_relaxed)}
+            };
+        }
+
+        void Store(
+            const RegistryKey &key, uint64_t keyHash, UDPSession *value, uint128_t valueToken, uint64_t valueGeneration
+        )
+        {
+            for (int i = 0; i < 3; ++i)
+                words[i].store(key.words[i], std::memory_order_relaxed);
+            hash = keyHash;
+            token = valueToken;
+            generation.store(valueGeneration, std::memory_order_relaxed);
+            session.store(value, std::memory_order_relaxed);
+        }
+
+        void MoveFrom(const Slot &other)
+        {
+            Store(
+                other.Key(), other.hash, other.session.load(std::memory_order_relaxed), other.token,
+                other.generation.load(std::memory_order_relaxed)
+            );
+        }
+
+        void Clear()
+        {
+            session.store(nullptr, std::memory_order_relaxed);
+            for (auto &word : words)
+                word.store(0, std::memory_order_relaxed);
+            hash = 0;
+            token = uint128_t(0, 0);
+            generation.store(0, std::memory_order_relaxed);
+        }
+    };
+
+    struct Table
+    {
+        explicit Table(size_t capacity) : mask(capacity - 1), slots(std::make_unique<Slot[]>(capacity))
+        {
+        }
+
+        size_t mask;
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    struct alignas(64) Shard
+    {
+        mutable std::mutex mutex;
+        std::atomic<uint32_t> sequence{0}; // Odd while a writer mutates the live table
+        std::atomic<Table *> table{nullptr};
+        size_t count = 0;
+        uint64_t generation = 0; // Last registration generation handed out
+        std::vector<std::unique_ptr<Table>> tables; // Live table is last; older ones may still be read
+    };
+
+    // Seqlock read: retried while a writer overlaps
+    template <typename T, typename Fn> T Read(uint64_t hash, Fn &&read) const
+    {
+        const Shard &shard = ShardOf(hash);
+        for (;;)
+        {
+            const uint32_t before = shard.sequence.load(std::memory_order_acquire);
+            if (before & 1)
+            {
+                std::this_thread::yield(); // Writer mid-update (a few stores)
+                continue;
+            }
+
+            const Table *table = shard.table.load(std::memory_order_acquire);
+            const T found = read(*table);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (shard.sequence.load(std::memory_order_relaxed) == before)
+                return found;
+        }
+    }
+
+    static const Slot *FindSlot(const Table &table, const RegistryKey &key, uint64_t hash)
+    {
+        size_t index = hash & table.mask;
+        for (size_t probes = 0; probes <= table.mask; ++probes, index = (index + 1) & table.mask)
+        {
+            const Slot &slot = table.slots[index];
+            if (slot.session.load(std::memory_order_relaxed) == nullptr)
+                return nullptr;
+            if (slot.Matches(key))
+                return &slot;
+        }
+        return nullptr;
+    }
+
+    static void BeginWrite(Shard &shard)
+    {
+        shard.sequence.store(shard.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    static void EndWrite(Shard &shard)
+    {
+        shard.sequence.store(shard.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // New table is filled before it is published, and the old one is never written again
+    static Table *Grow(Shard &shard)
+    {
+        const Table &old = *shard.table.load(std::memory_order_relaxed);
+        auto grown = std::make_unique<Table>((old.mask + 1) * 2);
+        for (size_t i = 0; i <= old.mask; ++i)
+        {
+            const Slot &slot = old.slots[i];
+            if (slot.session.load(std::memory_order_relaxed) == nullptr)
+                continue;
+            size_t index = slot.hash & grown->mask;
+            while (grown->slots[index].session.load(std::memory_order_relaxed) != nullptr)
+                index = (index + 1) & grown->mask;
+            grown->slots[index].MoveFrom(slot);
+        }
+
+        Table *raw = grown.get();
+        shard.tables.push_back(std::move(grown));
+        shard.table.store(raw, std::memory_order_release);
+        return raw;
+    }
+
+    static Removed EraseLocked(
+        Shard &shard, const RegistryKey &key, uint64_t hash, UDPSession *expected, uint64_t generation
+    )
+    {
+        Table &table = *shard.table.load(std::memory_order_relaxed);
+        size_t hole = hash & table.mask;
+        for (;; hole = (hole + 1) & table.mask)
+        {
+            const Slot &slot = table.slots[hole];
+            if (slot.session.load(std::memory_order_relaxed) == nullptr)
+                return {};
+            if (slot.Matches(key))
+                break;
+        }
+
+        Removed removed{table.slots[hole].session.load(std::memory_order_relaxed), table.slots[hole].token};
+        if (expected != nullptr && removed.session != expected)
+            return {};
+        if (generation != 0 && table.slots[hole].generation.load(std::memory_order_relaxed) != generation)
+            return {};
+
+        // [Backward Shift] Pull later entries of the cluster into the hole unless their home lies in (hole, next]
+        BeginWrite(shard);
+        for (size_t next = (hole + 1) & table.mask;; next = (next + 1) & table.mask)
+        {
+            const Slot &slot = table.slots[next];
+            if (slot.session.load(std::memory_order_relaxed) == nullptr)
+                break;
+
+            const size_t home = slot.hash & table.mask;
+            const bool staysPut = hole <= next ? (hole < home && home <= next) : (hole < home || home <= next);
+            if (!staysPut)
+            {
+                table.slots[hole].MoveFrom(slot);
+                hole = next;
+            }
+        }
+        table.slots[hole].Clear();
+        EndWrite(shard);
+
+        --shard.count;
+        return removed;
+    }
+
+    Shard &ShardOf(uint64_t hash)
+    {
+        return _shards[hash >> 60];
+    }
+
+    const Shard &ShardOf(uint64_t hash) const
+    {
+        return _shards[hash >> 60];
+    }
+
+    std::array<Shard, SHARD_COUNT> _shards;
+};
+
+} // namespace
+
+struct UDPEndpointRegistry::Impl
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    SeqlockSessionMap endpoints;
+    SeqlockSessionMap tokens;
+
+    // [Idle Wheel] One entry per registration, filed under the tick of the session's activity when armed.
+    // Activity never touches the wheel: a due entry whose session was active since is re-filed (lazy re-arm).
+    // An entry is live only while its generation is still the key's mapping; a Remove + Register of the same
+    // session and endpoint gets a new generation, so the old entry is dropped when due instead of re-armed.
+    struct IdleEntry
+    {
+        RegistryKey key;
+        uint64_t hash;
+        UDPSession *session;
+        uint64_t generation;
+        int64_t tick;
+    };
+
+    mutable std::mutex wheelMutex;
+    std::array<std::vector<IdleEntry>, IDLE_WHEEL_SLOTS> wheel;
+    size_t wheelEntries = 0;
+    int64_t nextTick = IdleTick(std::chrono::steady_clock::now());
+
+    void Arm(const RegistryKey &key, uint64_t hash, UDPSession *session, uint64_t generation)
+    {
+        if (generation == 0)
+            return; // Same registration: its entry is already in the wheel
+        const int64_t tick = IdleTick(session->GetLastActivity());
+        std::lock_guard<std::mutex> lock(wheelMutex);
+        wheel[static_cast<size_t>(tick) & IDLE_WHEEL_MASK].push_back(IdleEntry{key, hash, session, generation, tick});
+        ++wheelEntries;
+    }
+
+    // Re-registration of an endpoint: the token the old mapping carried no longer leads anywhere
+    void ReleaseReplacedToken(const SeqlockSessionMap::Removed &replaced, UDPSession *session, uint128_t token)
+    {
+        if (replaced.session != nullptr && (replaced.session != session || replaced.token != token))
+            EraseToken(replaced.session, replaced.token);
+    }
+
+    void EraseToken(UDPSession *session, uint128_t token)
+    {
+        if (token == uint128_t(0, 0))
+            return;
+        // Only if the token was not re-registered to another session since
+        const RegistryKey tokenKey = MakeKey(token);
+        tokens.Erase(tokenKey, HashOf(tokenKey), session);
+    }
+};
 
-    _sessions.erase(endpoint);
+UDPEndpointRegistry::UDPEndpointRegistry() : _impl(std::make_unique<Impl>())
+{
 }
 
-void UDPEndpointRegistry::UpdateActivity(const boost::asio::ip::udp::endpoint &endpoint)
+UDPEndpointRegistry::~UDPEndpointRegistry()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+}
 
-    auto it = _sessions.find(endpoint);
-    if (it != _sessions.end())
+void UDPEndpointRegistry::Register(const boost::asio::ip::udp::endpoint &endpoint, UDPSession *session)
+{
+    if (session == nullptr)
     {
-        it->second.lastActivity = std::chrono::steady_clock::now();
+        Remove(endpoint);
+        return;
     }
+
+    session->UpdateActivity();
+    const RegistryKey key = MakeKey(endpoint);
+    const uint64_t hash = HashOf(key);
+    SeqlockSessionMap::Removed replaced;
+    _impl->Arm(key, hash, session, _impl->endpoints.Insert(key, hash, session, uint128_t(0, 0), &replaced));
+    _impl->ReleaseReplacedToken(replaced, session, uint128_t(0, 0));
 }
 
-void UDPEndpointRegistry::RegisterWithToken(const boost::asio::ip::udp::endpoint &endpoint,
-                                             ISession *session, uint128_t udpToken)
+UDPSession *UDPEndpointRegistry::Find(const boost::asio::ip::udp::endpoint &endpoint) const
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    const RegistryKey key = MakeKey(endpoint);
+    return _impl->endpoints.Find(key, HashOf(key));
+}
 
-    auto it = _sessions.find(endpoint);
-    if (it != _sessions.end())
+void UDPEndpointRegistry::Remove(const boost::asio::ip::udp::endpoint &endpoint)
+{
+    // The wheel entry is dropped lazily when its bucket comes due
+    const RegistryKey key = MakeKey(endpoint);
+    SeqlockSessionMap::Removed removed = _impl->endpoints.Erase(key, HashOf(key));
+    if (removed.session != nullptr)
     {
-        it->second.session = session;
-        it->second.udpToken = udpToken;
-        it->second.lastActivity = std::chrono::steady_clock::now();
+        _impl->EraseToken(removed.session, removed.token);
     }
-    else
+}
+
+void UDPEndpointRegistry::UpdateActivity(const boost::asio::ip::udp::endpoint &endpoint)
+{
+    if (UDPSession *session = Find(endpoint))
     {
-        SessionInfo info;
-        info.session = session;
-        info.udpToken = udpToken;
-        info.lastActivity = std::chrono::steady_clock::now();
-        _sessions[endpoint] = info;
+        session->UpdateActivity();
     }
-
-    _tokens[udpToken] = endpoint;
 }
 
-ISession *UDPEndpointRegistry::GetEndpointByToken(uint128_t token)
+void UDPEndpointRegistry::RegisterWithToken(
+    const boost::asio::ip::udp::endpoint &endpoint, UDPSession *session, uint128_t udpToken
+)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-
-    auto tokenIt = _tokens.find(token);
-    if (tokenIt != _tokens.end())
+    if (session == nullptr)
     {
-        auto sessionIt = _sessions.find(tokenIt->second);
-        if (sessionIt != _sessions.end())
-        {
-            return sessionIt->second.session;
-        }
+        Remove(endpoint);
+        return;
     }
-    return nullptr;
+
+    session->UpdateActivity();
+    const RegistryKey key = MakeKey(endpoint);
+    const uint64_t hash = HashOf(key);
+    SeqlockSessionMap::Removed replaced;
+    _impl->Arm(key, hash, session, _impl->endpoints.Insert(key, hash, session, udpToken, &replaced));
+    _impl->ReleaseReplacedToken(replaced, session, udpToken);
+
+    const RegistryKey tokenKey = MakeKey(udpToken);
+    _impl->tokens.Insert(tokenKey, HashOf(tokenKey), session, udpToken);
+}
+
+UDPSession *UDPEndpointRegistry::GetEndpointByToken(uint128_t token) const
+{
+    const RegistryKey key = MakeKey(token);
+    return _impl->tokens.Find(key, HashOf(key));
 }
 
 size_t UDPEndpointRegistry::CleanupTimeouts(uint32_t timeoutMs)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    size_t removed = 0;
-    auto now = std::chrono::steady_clock::now();
+    const auto now = std::chrono::steady_clock::now();
+    const auto timeout = std::chrono::milliseconds(timeoutMs);
+    const int64_t cutoffTick = IdleTick(now - timeout);
+
+    std::lock_guard<std::mutex> lock(_impl->wheelMutex);
+    if (cutoffTick < _impl->nextTick)
+        return 0;
 
-    auto it = _sessions.begin();
-    while (it != _sessions.end())
+    // Only buckets that came due since the last sweep; sessions active within the timeout are never visited
+    const int64_t span = std::min<int64_t>(cutoffTick - _impl->nextTick + 1, IDLE_WHEEL_SLOTS);
+    size_t removed = 0;
+    std::vector<Impl::IdleEntry> due;
+    for (int64_t tick = cutoffTick - span + 1; tick <= cutoffTick; ++tick)
     {
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-            now - it->second.lastActivity
-        ).count();
+        std::vector<Impl::IdleEntry> &bucket = _impl->wheel[static_cast<size_t>(tick) & IDLE_WHEEL_MASK];
+        if (bucket.empty())
+            continue;
+        due.clear();
+        due.swap(bucket);
 
-        if (elapsed > timeoutMs)
-        {
-            _tokens.erase(it->second.udpToken);
-            it = _sessions.erase(it);
-            ++removed;
-        }
-        else
+        for (Impl::IdleEntry &entry : due)
         {
-            ++it;
+            if (entry.tick > cutoffTick)
+            {
+                bucket.push_back(entry); // Later revolution (timeout longer than the wheel)
+                continue;
+            }
+            if (_impl->endpoints.GenerationOf(entry.key, entry.hash) != entry.generation)
+            {
+                --_impl->wheelEntries; // Removed, replaced or re-registered since it was armed
+                continue;
+            }
+
+            const auto lastActivity = entry.session->GetLastActivity();
+            if (now - lastActivity > timeout)
+            {
+                --_impl->wheelEntries;
+                SeqlockSessionMap::Removed victim =
+                    _impl->endpoints.Erase(entry.key, entry.hash, entry.session, entry.generation);
+                if (victim.session != nullptr)
+                {
+                    _impl->EraseToken(victim.session, victim.token);
+                    ++removed;
+                }
+                continue;
+            }
+
+            // [Lazy Re-arm] Active since: file under the latest activity (the cutoff bucket itself if still inside it)
+            entry.tick = IdleTick(lastActivity);
+            _impl->wheel[static_cast<size_t>(entry.tick) & IDLE_WHEEL_MASK].push_back(entry);
         }
     }
+
+    // The cutoff bucket may still hold sessions that expire later within the same tick
+    _impl->nextTick = cutoffTick;
     return removed;
 }
 
+size_t UDPEndpointRegistry::Size() const
+{
+    return _impl->endpoints.Size();
+}
+
+size_t UDPEndpointRegistry::GetIdleEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(_impl->wheelMutex);
+    return _impl->wheelEntries;
+}
+
 } // namespace System
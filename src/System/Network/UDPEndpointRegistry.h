@@ -1,41 +1,61 @@
 #pragma once
 
 #include "System/Pch.h"
-#include "System/Network/UDPEndpointRegistry.h"
 #include "System/Session/UDPSession.h"
 #include <chrono>
 #include <cstdint>
+#include <memory>
 
 namespace System {
 
-struct SessionInfo
-{
-    ISession *session;
-    std::chrono::steady_clock::time_point lastActivity;
-    uint128_t udpToken = 0; // 16바이트 랜덤 토큰
-};
-
+/**
+ * @brief UDP endpoint / token -> UDPSession Registry (수신 경로 전용, Read-Mostly)
+ *
+ * [Concurrency]
+ * - 조회(Find / GetEndpointByToken)는 락과 공유 쓰기 없이 동작한다.
+ *   샤드별 Open Addressing(Linear Probing) 테이블을 Seqlock 으로 읽고, 쓰기와 겹치면 다시 읽는다.
+ * - 등록/삭제는 샤드 단위 mutex. 삭제는 Backward Shift 라 Tombstone 이 없다.
+ * - 테이블 확장 시 이전 배열은 Registry 파괴 시까지 보관한다 (읽는 중인 스레드 보호, 총량 <= 2배).
+ *
+ * [Activity]
+ * 마지막 활동 시각은 세션이 relaxed atomic 으로 들고 있다 (UDPSession::UpdateActivity).
+ * 패킷마다 Registry 를 다시 찾아 갱신할 필요가 없다.
+ *
+ * [Idle Timeout]
+ * 등록 시 활동 시각 기준 Coarse Wheel(10ms tick) 버킷에 한 번 넣고, 활동 시에는 건드리지 않는다.
+ * CleanupTimeouts 는 timeout 이 지난 버킷만 보고, 그 사이 활동한 세션은 최신 시각 버킷으로 옮긴다 (Lazy Re-arm).
+ * 따라서 비용은 전체 세션 수가 아니라 만료/재배치 수에 비례하고, 수신 경로(조회)를 막지 않는다.
+ * 휠 항목은 등록 세대(generation)를 들고 있어, Remove 후 같은 세션/endpoint 를 다시 등록하면 이전 항목은 만료 시 버려진다.
+ *
+ * 반환되는 UDPSession* 는 SessionPool 소유이므로 Remove 와 경합해도 메모리는 유효하다.
+ */
 class UDPEndpointRegistry
 {
 public:
     UDPEndpointRegistry();
     ~UDPEndpointRegistry();
 
-    void Register(const boost::asio::ip::udp::endpoint &endpoint, ISession *session);
-    ISession *Find(const boost::asio::ip::udp::endpoint &endpoint);
+    UDPEndpointRegistry(const UDPEndpointRegistry &) = delete;
+    UDPEndpointRegistry &operator=(const UDPEndpointRegistry &) = delete;
+
+    void Register(const boost::asio::ip::udp::endpoint &endpoint, UDPSession *session);
+    UDPSession *Find(const boost::asio::ip::udp::endpoint &endpoint) const;
     void Remove(const boost::asio::ip::udp::endpoint &endpoint);
 
     // [New] 토큰 기반 세션 등록 및 조회
-    void RegisterWithToken(const boost::asio::ip::udp::endpoint &endpoint, ISession *session, uint128_t udpToken);
-    ISession *GetEndpointByToken(uint128_t token);
+    void RegisterWithToken(const boost::asio::ip::udp::endpoint &endpoint, UDPSession *session, uint128_t udpToken);
+    UDPSession *GetEndpointByToken(uint128_t token) const;
     void UpdateActivity(const boost::asio::ip::udp::endpoint &endpoint);
 
     size_t CleanupTimeouts(uint32_t timeoutMs);
 
+    size_t Size() const;
+    // Idle wheel entries (one per live registration, plus stale ones not yet reached)
+    size_t GetIdleEntryCount() const;
+
 private:
-    std::unordered_map<boost::asio::ip::udp::endpoint, SessionInfo> _sessions;
-    std::unordered_map<uint128_t, boost::asio::ip::udp::endpoint, System::uint128_hash> _tokens;
-    std::mutex _mutex;
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
 };
 
 } // namespace System
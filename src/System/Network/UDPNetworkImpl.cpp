@@ -2,16 +2,148 @@
 #include "System/Dispatcher/MessagePool.h"
 #include "System/ILog.h"
 #include "System/ISession.h"
+#include "System/Metrics/IMetrics.h"
+#include "System/Network/UDPBatchIO.h"
 #include "System/Network/UDPEndpointRegistry.h"
 #include "System/Network/UDPLimits.h"
 #include "System/Network/UDPSendContextPool.h"
 #include "System/Pch.h"
+#include "System/Session/UDP/KCPScheduler.h"
 #include "System/Session/UDPSession.h"
+#include "System/Thread/CpuTopology.h"
+#include <algorithm>
+#include <optional>
+#include <thread>
+#include <utility>
 
 namespace System {
 
+// [Metrics] UDP drop counters (handles resolved once, lock-free increment)
+static const CounterHandle &DropOversize()
+{
+    static const CounterHandle handle("udp_drop_oversize");
+    return handle;
+}
+
+static const CounterHandle &DropSendContext()
+{
+    static const CounterHandle handle("udp_drop_send_context");
+    return handle;
+}
+
+static const CounterHandle &DropInvalidHeader()
+{
+    static const CounterHandle handle("udp_drop_invalid_header");
+    return handle;
+}
+
+static const CounterHandle &DropUnknownSession()
+{
+    static const CounterHandle handle("udp_drop_unknown_session");
+    return handle;
+}
+
+static const CounterHandle &DropTruncated()
+{
+    static const CounterHandle handle("udp_drop_truncated");
+    return handle;
+}
+
+static void ReleaseSendContext(UDPSendContext *ctx)
+{
+    MessagePool::Free(ctx->payload);
+    ctx->payload = nullptr;
+    ctx->payloadLen = 0;
+    UDPSendContextPool::Instance().Release(ctx);
+}
+
+#if defined(SO_REUSEPORT)
+using ReusePort = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+#endif
+
+/**
+ * @brief 소켓 샤드 1개 (소켓 + 송신 스트랜드 + 수신 버퍼)
+ * ownedContext 가 있으면 전용 io_context 를 자기 스레드에서 돌린다 (N > 1).
+ */
+struct UDPSocketShard
+{
+    UDPSocketShard(size_t shardIndex, boost::asio::io_context *sharedContext)
+        : index(shardIndex), ownedContext(sharedContext ? nullptr : std::make_unique<boost::asio::io_context>(1)),
+          ioContext(sharedContext ? *sharedContext : *ownedContext), socket(ioContext),
+          strand(boost::asio::make_strand(socket.get_executor()))
+    {
+    }
+
+    ~UDPSocketShard()
+    {
+        DrainSendQueue();
+    }
+
+    // Frees every queued / pending send (socket closed or shard destroyed)
+    void DrainSendQueue()
+    {
+        for (size_t i = 0; i < sendPendingCount; ++i)
+            ReleaseSendContext(sendPending[i]);
+        sendPendingCount = 0;
+
+        UDPSendContext *ctx = nullptr;
+        while (sendQueue.try_dequeue(ctx))
+            ReleaseSendContext(ctx);
+    }
+
+    size_t index;
+    std::unique_ptr<boost::asio::io_context> ownedContext;
+    boost::asio::io_context &ioContext;
+    boost::asio::ip::udp::socket socket;
+    boost::asio::strand<boost::asio::any_io_executor> strand;
+    std::optional<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> workGuard;
+    std::thread thread;
+
+    boost::asio::ip::udp::endpoint senderEndpoint;
+    std::atomic<uint64_t> received{0};
+
+    // 수신 버퍼
+    std::array<uint8_t, 65536> receiveBuffer;
+
+    // [Batch] recvmmsg / sendmmsg (batchSize > 1)
+    std::unique_ptr<UDPRecvBatch> recvBatch;
+    std::unique_ptr<UDPSendBatch> sendBatch;
+    moodycamel::ConcurrentQueue<UDPSendContext *> sendQueue; // AsyncSend -> Flush (MPSC)
+    std::atomic<bool> flushScheduled{false};
+    std::vector<UDPSendContext *> sendPending; // Strand only: batch not yet accepted by the kernel
+    size_t sendPendingCount = 0;
+    bool waitingWritable = false; // Strand only
+
+    // Handlers that still reference this shard (Stop destroys the shard once they have all run)
+    std::atomic<int> pendingOps{0};
+};
+
+// Held by every async handler that references a shard (move-only, released when the handler is destroyed)
+struct ShardOp
+{
+    explicit ShardOp(UDPSocketShard &shard) : _shard(&shard)
+    {
+        shard.pendingOps.fetch_add(1, std::memory_order_relaxed);
+    }
+    ShardOp(ShardOp &&other) noexcept : _shard(std::exchange(other._shard, nullptr))
+    {
+    }
+    ShardOp(const ShardOp &) = delete;
+    ShardOp &operator=(const ShardOp &) = delete;
+    ShardOp &operator=(ShardOp &&) = delete;
+
+    ~ShardOp()
+    {
+        if (_shard)
+            _shard->pendingOps.fetch_sub(1, std::memory_order_release);
+    }
+
+private:
+    UDPSocketShard *_shard;
+};
+
 UDPNetworkImpl::UDPNetworkImpl(boost::asio::io_context &ioContext)
-    : _ioContext(ioContext), _socket(_ioContext), _strand(boost::asio::make_strand(_socket.get_executor()))
+    : _ioContext(ioContext), _kcpScheduler(std::make_unique<KCPScheduler>(ioContext))
 {
     // 컨텍스트 풀 미리 준비 (1024개)
     UDPSendContextPool::Instance().Prepare(1024);
@@ -22,25 +154,106 @@ UDPNetworkImpl::~UDPNetworkImpl()
     Stop();
 }
 
+void UDPNetworkImpl::SetShardCount(size_t count, std::vector<int> cpus)
+{
+    _shardCount = std::max<size_t>(count, 1);
+    _shardCpus = std::move(cpus);
+}
+
+void UDPNetworkImpl::SetBatching(size_t batchSize, bool gso)
+{
+    if (batchSize > 1 && !IsUDPBatchIOSupported())
+    {
+        LOG_WARN("UDP: recvmmsg/sendmmsg are not available on this platform, batching disabled");
+        batchSize = 0;
+    }
+    _batchSize = batchSize > 1 ? batchSize : 0;
+    _gso = _batchSize > 0 && gso;
+}
+
 bool UDPNetworkImpl::Start(uint16_t port)
 {
+    if (!_shards.empty())
+    {
+        LOG_WARN("UDP Network already started on port {}", GetLocalPort());
+        return false;
+    }
+
+    size_t shardCount = _shardCount;
+#if !defined(SO_REUSEPORT)
+    if (shardCount > 1)
+    {
+        LOG_WARN("UDP: SO_REUSEPORT is not available on this platform, using 1 socket instead of {}", shardCount);
+        shardCount = 1;
+    }
+#endif
+
     _isStopping.store(false);
     try
     {
         boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::make_address("127.0.0.1"), port);
 
-        _socket.open(endpoint.protocol());
-        _socket.set_option(boost::asio::socket_base::reuse_address(false));
-        _socket.bind(endpoint);
+        for (size_t i = 0; i < shardCount; ++i)
+        {
+            auto shard = std::make_unique<UDPSocketShard>(i, shardCount == 1 ? &_ioContext : nullptr);
+            shard->socket.open(endpoint.protocol());
+#if defined(SO_REUSEPORT)
+            if (shardCount > 1)
+                shard->socket.set_option(ReusePort(true));
+            else
+#endif
+                shard->socket.set_option(boost::asio::socket_base::reuse_address(false));
+            shard->socket.bind(endpoint);
+
+            if (_batchSize > 0)
+            {
+                shard->recvBatch = std::make_unique<UDPRecvBatch>(_batchSize);
+                shard->sendBatch = std::make_unique<UDPSendBatch>(_batchSize, _gso);
+                shard->sendPending.resize(_batchSize);
+            }
+
+            // Port 0: the remaining shards join the port the kernel picked for the first one
+            endpoint.port(shard->socket.local_endpoint().port());
+            _shards.push_back(std::move(shard));
+        }
+
+        LOG_INFO("UDP Network listening on 127.0.0.1:{} ({} socket shard(s))", endpoint.port(), shardCount);
+        if (_batchSize > 0)
+        {
+            LOG_INFO("UDP Batching: {} datagrams per recvmmsg/sendmmsg (GSO: {})", _batchSize, _gso);
+        }
 
-        LOG_INFO("UDP Network listening on 127.0.0.1:{}", port);
+        _kcpScheduler->Start();
 
-        StartReceive();
+        for (auto &shard : _shards)
+        {
+            StartReceive(*shard);
+            if (!shard->ownedContext)
+                continue;
+
+            shard->workGuard.emplace(shard->ownedContext->get_executor());
+            UDPSocketShard *raw = shard.get();
+            shard->thread = std::thread(
+                [this, raw]()
+                {
+                    CpuTopology::PinWorker(_shardCpus, raw->index, "UDP Thread");
+                    try
+                    {
+                        raw->ownedContext->run();
+                    } catch (const std::exception &e)
+                    {
+                        LOG_ERROR("UDP Thread #{} Exception: {}", raw->index, e.what());
+                    }
+                }
+            );
+        }
 
         return true;
     } catch (const std::exception &e)
     {
         LOG_ERROR("UDP Network Start Failed: {}", e.what());
+        // No shard thread has been started yet (binds come first)
+        _shards.clear();
         return false;
     }
 }
@@ -48,19 +261,78 @@ bool UDPNetworkImpl::Start(uint16_t port)
 void UDPNetworkImpl::Stop()
 {
     _isStopping.store(true);
+    _kcpScheduler->Stop();
 
     // 스트랜드를 통해 안전하게 소켓 닫기 (송신 중인 작업과의 충돌 방지)
-    boost::asio::dispatch(
-        _strand,
-        [this]()
+    for (auto &shard : _shards)
+    {
+        UDPSocketShard *raw = shard.get();
+        boost::asio::dispatch(
+            raw->strand,
+            [raw, op = ShardOp(*raw)]()
+            {
+                boost::system::error_code ec;
+                if (raw->socket.is_open())
+                {
+                    raw->socket.close(ec);
+                }
+                raw->DrainSendQueue();
+            }
+        );
+    }
+
+    // Owned contexts drain the aborted operations (payloads freed) and return
+    for (auto &shard : _shards)
+    {
+        shard->workGuard.reset();
+        if (shard->thread.joinable() && shard->thread.get_id() != std::this_thread::get_id())
+        {
+            shard->thread.join();
+        }
+    }
+
+    // Shared context: run the aborted handlers here so the shard can go away
+    // (not from inside the context itself, and not once it has been stopped -> those shards are retired instead)
+    if (!_ioContext.get_executor().running_in_this_thread())
+    {
+        for (auto &shard : _shards)
         {
-            boost::system::error_code ec;
-            if (_socket.is_open())
+            while (!shard->ownedContext && shard->pendingOps.load(std::memory_order_acquire) > 0 &&
+                   !_ioContext.stopped())
             {
-                _socket.close(ec);
+                if (_ioContext.poll_one() == 0)
+                    std::this_thread::yield();
             }
         }
-    );
+    }
+
+    for (auto &shard : _shards)
+    {
+        if (shard->pendingOps.load(std::memory_order_acquire) > 0 || shard->thread.joinable())
+            _retiredShards.push_back(std::move(shard)); // Freed with the network object
+    }
+    _shards.clear();
+    _isStopping.store(false);
+}
+
+uint16_t UDPNetworkImpl::GetLocalPort() const
+{
+    if (_shards.empty())
+        return 0;
+    boost::system::error_code ec;
+    return _shards.front()->socket.local_endpoint(ec).port();
+}
+
+uint64_t UDPNetworkImpl::GetReceivedCount(size_t index) const
+{
+    return index < _shards.size() ? _shards[index]->received.load(std::memory_order_relaxed) : 0;
+}
+
+UDPSocketShard &UDPNetworkImpl::ShardFor(const boost::asio::ip::udp::endpoint &destination)
+{
+    if (_shards.size() == 1)
+        return *_shards.front();
+    return *_shards[std::hash<boost::asio::ip::udp::endpoint>{}(destination) % _shards.size()];
 }
 
 void UDPNetworkImpl::SetRegistry(UDPEndpointRegistry *registry)
@@ -75,14 +347,20 @@ void UDPNetworkImpl::SetDispatcher(IDispatcher *dispatcher)
 
 bool UDPNetworkImpl::SendTo(const uint8_t *data, size_t length, const boost::asio::ip::udp::endpoint &destination)
 {
-    if (!_socket.is_open() || _isStopping.load())
+    if (_shards.empty() || _isStopping.load())
+    {
+        return false;
+    }
+
+    UDPSocketShard &shard = ShardFor(destination);
+    if (!shard.socket.is_open())
     {
         return false;
     }
 
     try
     {
-        _socket.async_send_to(
+        shard.socket.async_send_to(
             boost::asio::buffer(data, length),
             destination,
             [](const boost::system::error_code &error, size_t /*bytesSent*/)
@@ -110,6 +388,7 @@ void UDPNetworkImpl::AsyncSend(
     if (payloadLen > UDP_MAX_APP_BYTES)
     {
         _oversizeDrops.fetch_add(1, std::memory_order_relaxed);
+        DropOversize().Increment();
 
         // 5초 단위 Rate-limited 로깅 (CAS 사용)
         auto nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -132,11 +411,19 @@ void UDPNetworkImpl::AsyncSend(
         return;
     }
 
+    // 시작 전 / 정지 후에는 스트랜드를 돌려줄 스레드가 없을 수 있음
+    if (_shards.empty() || _isStopping.load())
+    {
+        MessagePool::Free(payload);
+        return;
+    }
+
     // [Safety 2] 컨텍스트 풀 확인
     UDPSendContext *ctx = UDPSendContextPool::Instance().Acquire();
     if (!ctx)
     {
         // 풀 부족 시 드랍
+        DropSendContext().Increment();
         MessagePool::Free(payload);
         return;
     }
@@ -151,12 +438,21 @@ void UDPNetworkImpl::AsyncSend(
     std::memcpy(ctx->headerBytes.data() + 1, &sessionId, sizeof(sessionId));
     std::memcpy(ctx->headerBytes.data() + 9, &udpToken, sizeof(udpToken));
 
-    // [Strand] 동시 송신 호출 순서 보장
+    // [Strand] 동시 송신 호출 순서 보장 (목적지별 샤드)
+    UDPSocketShard &shard = ShardFor(destination);
+    if (shard.sendBatch)
+    {
+        // [Batch] 큐에 쌓고, 스트랜드의 Flush 가 모인 만큼 sendmmsg 한 번으로 내보낸다
+        shard.sendQueue.enqueue(ctx);
+        ScheduleFlush(shard);
+        return;
+    }
+
     boost::asio::post(
-        _strand,
-        [this, ctx]()
+        shard.strand,
+        [this, &shard, ctx, op = ShardOp(shard)]()
         {
-            if (!_socket.is_open() || _isStopping.load())
+            if (!shard.socket.is_open() || _isStopping.load())
             {
                 // 스트랜드 내부 실패 시 정리
                 MessagePool::Free(ctx->payload);
@@ -174,11 +470,17 @@ void UDPNetworkImpl::AsyncSend(
             // [Exception Safety] async_send_to 시작 시 예외 발생 시 정리
             try
             {
-                _socket.async_send_to(
+                _sendCalls.fetch_add(1, std::memory_order_relaxed);
+                shard.socket.async_send_to(
                     buffers,
                     ctx->destination,
-                    [ctx](const boost::system::error_code &error, size_t /*bytesSent*/)
+                    [this, ctx](const boost::system::error_code &error, size_t /*bytesSent*/)
                     {
+                        if (!error)
+                        {
+                            _sentDatagrams.fetch_add(1, std::memory_order_relaxed);
+                        }
+
                         // 완료 후 무조건 페이로드 해제 및 컨텍스트 반납
                         MessagePool::Free(ctx->payload);
 
@@ -206,24 +508,140 @@ void UDPNetworkImpl::AsyncSend(
     );
 }
 
-void UDPNetworkImpl::StartReceive()
+void UDPNetworkImpl::ScheduleFlush(UDPSocketShard &shard)
+{
+    if (!shard.flushScheduled.exchange(true, std::memory_order_acq_rel))
+    {
+        boost::asio::post(
+            shard.strand,
+            [this, &shard, op = ShardOp(shard)]()
+            {
+                FlushSendQueue(shard);
+            }
+        );
+    }
+}
+
+void UDPNetworkImpl::FlushSendQueue(UDPSocketShard &shard)
 {
-    if (!_socket.is_open())
+    // Cleared first: AsyncSend calls from here on schedule another flush
+    shard.flushScheduled.store(false, std::memory_order_release);
+    if (shard.waitingWritable)
+        return; // The writable wait resumes the flush
+
+    if (!shard.socket.is_open() || _isStopping.load())
+    {
+        shard.DrainSendQueue();
+        return;
+    }
+
+    const size_t capacity = shard.sendPending.size();
+    shard.sendPendingCount += shard.sendQueue.try_dequeue_bulk(
+        shard.sendPending.begin() + static_cast<std::ptrdiff_t>(shard.sendPendingCount),
+        capacity - shard.sendPendingCount
+    );
+    if (shard.sendPendingCount == 0)
         return;
 
-    _socket.async_receive_from(
-        boost::asio::buffer(_receiveBuffer),
-        _senderEndpoint,
-        [this](const boost::system::error_code &error, size_t bytesReceived)
+    boost::system::error_code ec;
+    size_t sent =
+        shard.sendBatch->Send(shard.socket.native_handle(), shard.sendPending.data(), shard.sendPendingCount, ec);
+    _sendCalls.fetch_add(1, std::memory_order_relaxed);
+
+    if (sent == 0)
+    {
+        if (ec == boost::asio::error::would_block)
         {
-            HandleReceive(error, bytesReceived, _senderEndpoint);
+            // 송신 버퍼 가득 참: 쓰기 가능해지면 남은 배치부터 이어서 보낸다
+            shard.waitingWritable = true;
+            shard.socket.async_wait(
+                boost::asio::socket_base::wait_write,
+                boost::asio::bind_executor(
+                    shard.strand,
+                    [this, &shard, op = ShardOp(shard)](const boost::system::error_code &error)
+                    {
+                        shard.waitingWritable = false;
+                        if (error)
+                        {
+                            shard.DrainSendQueue();
+                            return;
+                        }
+                        FlushSendQueue(shard);
+                    }
+                )
+            );
+            return;
         }
+
+        // 첫 데이터그램을 보낼 수 없음 (목적지 오류 등): 그것만 드랍하고 계속
+        LOG_ERROR("UDP sendmmsg Error: {}", ec.message());
+        sent = 1;
+    }
+    else
+    {
+        _sentDatagrams.fetch_add(sent, std::memory_order_relaxed);
+    }
+
+    for (size_t i = 0; i < sent; ++i)
+        ReleaseSendContext(shard.sendPending[i]);
+    std::copy(
+        shard.sendPending.begin() + static_cast<std::ptrdiff_t>(sent),
+        shard.sendPending.begin() + static_cast<std::ptrdiff_t>(shard.sendPendingCount),
+        shard.sendPending.begin()
     );
+    shard.sendPendingCount -= sent;
+
+    // One batch per handler: other work on this strand/context is not starved by a busy sender
+    if (shard.sendPendingCount > 0 || shard.sendQueue.size_approx() > 0)
+        ScheduleFlush(shard);
 }
 
-void UDPNetworkImpl::HandleReceive(
-    const boost::system::error_code &error, size_t bytesReceived, const boost::asio::ip::udp::endpoint &senderEndpoint
-)
+void UDPNetworkImpl::StartReceive(UDPSocketShard &shard)
+{
+    if (!shard.socket.is_open())
+        return;
+
+    if (shard.recvBatch)
+    {
+        shard.socket.async_wait(
+            boost::asio::socket_base::wait_read,
+            [this, &shard, op = ShardOp(shard)](const boost::system::error_code &error)
+            {
+                HandleReadable(shard, error);
+            }
+        );
+        return;
+    }
+
+    shard.socket.async_receive_from(
+        boost::asio::buffer(shard.receiveBuffer),
+        shard.senderEndpoint,
+        [this, &shard, op = ShardOp(shard)](const boost::system::error_code &error, size_t bytesReceived)
+        {
+            HandleReceive(shard, error, bytesReceived);
+        }
+    );
+}
+
+void UDPNetworkImpl::HandleReceive(UDPSocketShard &shard, const boost::system::error_code &error, size_t bytesReceived)
+{
+    if (_isStopping.load())
+        return;
+
+    if (error)
+    {
+        if (error != boost::asio::error::operation_aborted)
+        {
+            LOG_ERROR("UDP Receive Error: {}", error.message());
+        }
+        return;
+    }
+
+    HandleDatagram(shard, shard.receiveBuffer.data(), bytesReceived, shard.senderEndpoint);
+    StartReceive(shard);
+}
+
+void UDPNetworkImpl::HandleReadable(UDPSocketShard &shard, const boost::system::error_code &error)
 {
     if (_isStopping.load())
         return;
@@ -237,18 +655,55 @@ void UDPNetworkImpl::HandleReceive(
         return;
     }
 
+    // Drain the socket queue, but yield to the other handlers of this context after a few batches
+    UDPRecvBatch &batch = *shard.recvBatch;
+    for (int round = 0; round < 4; ++round)
+    {
+        boost::system::error_code ec;
+        size_t count = batch.Receive(shard.socket.native_handle(), ec);
+        if (ec)
+        {
+            LOG_ERROR("UDP recvmmsg Error: {}", ec.message());
+            return;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (batch.Truncated(i))
+            {
+                DropTruncated().Increment();
+                continue;
+            }
+            HandleDatagram(shard, batch.Data(i), batch.Size(i), batch.Sender(i));
+        }
+
+        if (count < batch.Capacity())
+            break;
+    }
+
+    StartReceive(shard);
+}
+
+void UDPNetworkImpl::HandleDatagram(
+    UDPSocketShard &shard, const uint8_t *data, size_t bytesReceived,
+    const boost::asio::ip::udp::endpoint &senderEndpoint
+)
+{
+    shard.received.fetch_add(1, std::memory_order_relaxed);
+
     if (bytesReceived > UDPTransportHeader::SIZE)
     {
         if (_registry != nullptr && _dispatcher != nullptr)
         {
-            const UDPTransportHeader *header = reinterpret_cast<const UDPTransportHeader *>(_receiveBuffer.data());
+            const UDPTransportHeader *header = reinterpret_cast<const UDPTransportHeader *>(data);
             if (!header->IsValid())
             {
-                StartReceive();
+                DropInvalidHeader().Increment();
                 return;
             }
 
-            ISession *session = _registry->Find(senderEndpoint);
+            // [Lock-Free] Seqlock lookups; the session stamps its own activity in HandleData
+            UDPSession *session = _registry->Find(senderEndpoint);
             if (!session)
             {
                 session = _registry->GetEndpointByToken(header->udpToken);
@@ -256,24 +711,16 @@ void UDPNetworkImpl::HandleReceive(
 
             if (!session)
             {
-                StartReceive();
+                DropUnknownSession().Increment();
                 return;
             }
 
-            _registry->UpdateActivity(senderEndpoint);
-
-            const uint8_t *packetData = _receiveBuffer.data() + UDPTransportHeader::SIZE;
+            const uint8_t *packetData = data + UDPTransportHeader::SIZE;
             size_t packetLength = bytesReceived - UDPTransportHeader::SIZE;
 
-            UDPSession *udpSession = dynamic_cast<UDPSession *>(session);
-            if (udpSession)
-            {
-                udpSession->HandleData(packetData, packetLength, header->IsKCP());
-            }
+            session->HandleData(packetData, packetLength, header->IsKCP());
         }
     }
-
-    StartReceive();
 }
 
 } // namespace System
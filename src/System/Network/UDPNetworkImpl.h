@@ -6,16 +6,27 @@
 #include <boost/asio/ip/udp.hpp>
 #include <boost/asio/strand.hpp>
 #include <memory>
+#include <vector>
 
 namespace System {
 
 class IDispatcher;
 class UDPEndpointRegistry;
 class PacketMessage;
+class KCPScheduler;
+
+struct UDPSocketShard;
 
 /**
  * @brief UDP 네트워크 구현 클래스
  * 비동기 송신(AsyncSend)을 통해 제로 할당 및 스레드 안전한 송신을 지원합니다.
+ *
+ * [Socket Shards]
+ * - 1 (기본): 소켓 1개, 생성자로 받은 공유 io_context 에서 동작 (기존 동작)
+ * - N > 1:    같은 포트에 SO_REUSEPORT 로 N 개 소켓을 바인드. 샤드마다 전용 io_context + 스레드.
+ *             커널이 4-tuple 해시로 분배하므로 한 클라이언트는 항상 같은 샤드로 수신된다.
+ *             송신은 목적지 해시로 샤드를 고른다 (같은 목적지 = 같은 스트랜드 = 순서 보장).
+ * SO_REUSEPORT 가 없는 플랫폼(Windows)에서는 경고 후 1 개로 동작한다.
  */
 class UDPNetworkImpl
 {
@@ -23,12 +34,49 @@ public:
     explicit UDPNetworkImpl(boost::asio::io_context &ioContext);
     ~UDPNetworkImpl();
 
+    // Start 전에 호출. cpus = 샤드 스레드 CPU 목록 (round-robin, 비어 있으면 OS 스케줄링)
+    void SetShardCount(size_t count, std::vector<int> cpus = {});
+    size_t GetShardCount() const
+    {
+        return _shards.size();
+    }
+
+    /**
+     * @brief [Linux] recvmmsg / sendmmsg 배치 모드 (Start 전에 호출)
+     * @param batchSize syscall 한 번에 처리할 최대 데이터그램 수 (0, 1 = 끔: 데이터그램당 async 호출)
+     * @param gso 같은 목적지로의 연속 송신을 UDP_SEGMENT 하나로 합침 (커널이 거부하면 자동으로 끔)
+     *
+     * 수신: 읽기 가능 알림 1번에 recvmmsg 로 큐를 비운다.
+     * 송신: AsyncSend 는 샤드 큐에 쌓기만 하고, 스트랜드의 Flush 가 쌓인 만큼 sendmmsg 로 내보낸다.
+     */
+    void SetBatching(size_t batchSize, bool gso);
+
     bool Start(uint16_t port);
     void Stop();
 
+    // Bound port (resolves port 0 after Start)
+    uint16_t GetLocalPort() const;
+    // Datagrams received by socket shard #index
+    uint64_t GetReceivedCount(size_t index) const;
+    // Datagrams handed to the kernel / send syscalls issued (batching: sendmmsg calls)
+    uint64_t GetSentCount() const
+    {
+        return _sentDatagrams.load(std::memory_order_relaxed);
+    }
+    uint64_t GetSendCallCount() const
+    {
+        return _sendCalls.load(std::memory_order_relaxed);
+    }
+
     void SetRegistry(UDPEndpointRegistry *registry);
     void SetDispatcher(IDispatcher *dispatcher);
 
+    // KCP update wheel on the shared io_context (runs between Start and Stop)
+    KCPScheduler *GetKCPScheduler() const
+    {
+        return _kcpScheduler.get();
+    }
+
     /**
      * @brief [Legacy] UDP 데이터 직접 송신
      * @deprecated AsyncSend 사용을 권장합니다.
@@ -49,6 +97,7 @@ public:
      * - 전달받은 `payload`의 소유권을 1개 가져옵니다.
      * - 송신 시작에 실패(Oversize 등)하면 즉시 호출자 스레드에서 해제합니다.
      * - 성공적으로 strand에 게시되면, 송신 완료 핸들러에서만 해제합니다.
+     * - 송신 샤드는 destination 으로 결정됩니다 (호출 스레드 무관).
      */
     void AsyncSend(
         const boost::asio::ip::udp::endpoint &destination, uint8_t tag, uint64_t sessionId, uint128_t udpToken,
@@ -62,28 +111,37 @@ public:
     uint64_t GetOversizeDrops() const { return _oversizeDrops.load(std::memory_order_relaxed); }
 
 private:
-    void StartReceive();
-    void HandleReceive(
-        const boost::system::error_code &error, size_t bytesReceived,
+    UDPSocketShard &ShardFor(const boost::asio::ip::udp::endpoint &destination);
+    void StartReceive(UDPSocketShard &shard);
+    void HandleReceive(UDPSocketShard &shard, const boost::system::error_code &error, size_t bytesReceived);
+    void HandleReadable(UDPSocketShard &shard, const boost::system::error_code &error);
+    void HandleDatagram(
+        UDPSocketShard &shard, const uint8_t *data, size_t bytesReceived,
         const boost::asio::ip::udp::endpoint &senderEndpoint
     );
+    void FlushSendQueue(UDPSocketShard &shard);
+    void ScheduleFlush(UDPSocketShard &shard);
 
 private:
     boost::asio::io_context &_ioContext;
-    boost::asio::ip::udp::socket _socket;
-    boost::asio::strand<boost::asio::any_io_executor> _strand;
+    size_t _shardCount = 1;
+    std::vector<int> _shardCpus;
+    size_t _batchSize = 0; // 0 = unbatched
+    bool _gso = false;
+    std::vector<std::unique_ptr<UDPSocketShard>> _shards; // Fixed between Start and Stop (AsyncSend reads it lock-free)
+    // Shards whose handlers could not be drained by Stop (shared context stopped / Stop called from it)
+    std::vector<std::unique_ptr<UDPSocketShard>> _retiredShards;
 
-    boost::asio::ip::udp::endpoint _senderEndpoint;
     UDPEndpointRegistry *_registry = nullptr;
+    std::unique_ptr<KCPScheduler> _kcpScheduler;
     IDispatcher *_dispatcher = nullptr;
     std::atomic<bool> _isStopping{false};
 
     // 통계 및 메트릭
     std::atomic<uint64_t> _oversizeDrops{0};
+    std::atomic<uint64_t> _sentDatagrams{0};
+    std::atomic<uint64_t> _sendCalls{0};
     std::atomic<int64_t> _lastLogMs{0};
-
-    // 수신 버퍼
-    std::array<uint8_t, 65536> _receiveBuffer;
 };
 
 } // namespace System
@@ -10,11 +10,11 @@ namespace System {
 // IPacket -> PacketStorage
 struct PacketBuilder
 {
-    static PacketMessage *Build(const IPacket &pkt)
+    static PacketMessage *Build(const IPacket &pkt, AllocPriority priority = AllocPriority::Normal)
     {
         uint16_t size = pkt.GetTotalSize();
 
-        auto msg = MessagePool::AllocatePacket(size);
+        auto msg = MessagePool::AllocatePacket(size, priority);
         if (!msg)
             return nullptr;
 
@@ -28,10 +28,10 @@ struct PacketBuilder
     }
 
     // [New] RAII Support
-    static PacketPtr BuildShared(const IPacket &pkt)
+    static PacketPtr BuildShared(const IPacket &pkt, AllocPriority priority = AllocPriority::Normal)
     {
         // Build returns raw pointer with refCount=1
-        PacketMessage *raw = Build(pkt);
+        PacketMessage *raw = Build(pkt, priority);
         // PacketPtr takes ownership
         return PacketPtr(raw);
     }
@@ -2,6 +2,7 @@
 #include "System/Dispatcher/IDispatcher.h"
 #include "System/Dispatcher/MessagePool.h"
 #include "System/ILog.h"
+#include "System/Network/IoBackend.h"
 #include "System/Network/RecvBuffer.h"
 #include "System/Packet/PacketHeader.h"
 #include "System/Packet/PacketPtr.h"
@@ -34,14 +35,19 @@ struct BackendSessionImpl
     std::function<void(BackendSession *)> _hbPingFunc;
 
     bool _readPaused = false;
+    bool _parkIdleReads = false; // Idle -> no RecvBuffer block, read into the thread scratch
 
     BackendSessionImpl(BackendSession *owner) : _owner(owner)
     {
     }
 
     void StartRead();
+    void StartParkedRead();
+    void OnReadable(const boost::system::error_code &ec);
     void OnReadComplete(const boost::system::error_code &ec, size_t tr);
     void OnRecv(size_t tr);
+    // false = closed. inPlace: data is the shared _recvBuffer block -> PacketRefMessage instead of a copy
+    bool DrainFrames(const uint8_t *data, int32_t size, int32_t &consumed, bool inPlace);
 
     void StartHeartbeat();
     void OnHeartbeatTimer(const boost::system::error_code &ec);
@@ -99,6 +105,7 @@ void BackendSession::OnRecycle()
     _impl->_gatherBuffers.clear();
     _impl->_sendingPackets.clear();
     _impl->_socket.reset();
+    _impl->_recvBuffer.Reset(); // Pooled sessions hold no receive block
 
     Session::Reset();
 }
@@ -149,6 +156,16 @@ void BackendSession::OnDisconnect()
     }
 }
 
+void BackendSession::SetParkIdleReads(bool enable)
+{
+    _impl->_parkIdleReads = enable;
+}
+
+void BackendSession::SetZeroCopyRecv(bool enable)
+{
+    _impl->_recvBuffer.SetShared(enable);
+}
+
 void BackendSession::ConfigHeartbeat(
     uint32_t intervalMs, uint32_t timeoutMs, std::function<void(BackendSession *)> pingFunc
 )
@@ -243,10 +260,19 @@ void BackendSessionImpl::StartRead()
 {
     if (!_socket || !_socket->is_open())
         return;
+    if (_parkIdleReads && _recvBuffer.DataSize() == 0)
+    {
+        _recvBuffer.Detach();
+        StartParkedRead();
+        return;
+    }
+    _recvBuffer.Attach();
     _recvBuffer.Clean();
     _owner->IncRef();
-    _socket->async_read_some(
-        boost::asio::buffer(_recvBuffer.WritePos(), _recvBuffer.FreeSize()),
+    // [io_uring] Registered arena blocks are read as fixed buffers (IoBackend.h)
+    AsyncReadSome(
+        *_socket,
+        _recvBuffer,
         [this](auto ec, auto tr)
         {
             OnReadComplete(ec, tr);
@@ -255,6 +281,57 @@ void BackendSessionImpl::StartRead()
     );
 }
 
+void BackendSessionImpl::StartParkedRead()
+{
+    // Readiness only; bytes are read synchronously on the completing thread (see GatewaySessionImpl)
+    if (!_socket->non_blocking())
+    {
+        boost::system::error_code ec;
+        _socket->non_blocking(true, ec);
+    }
+    _owner->IncRef();
+    _socket->async_wait(
+        boost::asio::ip::tcp::socket::wait_read,
+        [this](auto ec)
+        {
+            OnReadable(ec);
+            _owner->DecRef();
+        }
+    );
+}
+
+void BackendSessionImpl::OnReadable(const boost::system::error_code &ec)
+{
+    if (ec)
+    {
+        _owner->Close();
+        return;
+    }
+    uint8_t *scratch = RecvBuffer::GetThreadScratch();
+    boost::system::error_code readEc;
+    size_t tr = _socket->read_some(boost::asio::buffer(scratch, RecvBuffer::SCRATCH_CAPACITY), readEc);
+    if (readEc == boost::asio::error::would_block || readEc == boost::asio::error::try_again)
+    {
+        StartParkedRead();
+        return;
+    }
+    if (readEc)
+    {
+        _owner->Close();
+        return;
+    }
+    int32_t consumed = 0;
+    if (!DrainFrames(scratch, static_cast<int32_t>(tr), consumed, false))
+        return;
+    if (consumed < static_cast<int32_t>(tr) &&
+        !_recvBuffer.Append(scratch + consumed, static_cast<int32_t>(tr) - consumed))
+    {
+        _owner->Close();
+        return;
+    }
+    StartRead();
+}
+
 void BackendSessionImpl::OnReadComplete(const boost::system::error_code &ec, size_t tr)
 {
     if (ec)
@@ -270,40 +347,65 @@ void BackendSessionImpl::OnRecv(size_t tr)
         _owner->Close();
         return;
     }
+    int32_t consumed = 0;
+    bool open = DrainFrames(_recvBuffer.ReadPos(), _recvBuffer.DataSize(), consumed, _recvBuffer.IsShared());
+    _recvBuffer.MoveReadPos(consumed);
+    if (!open)
+        return;
+    StartRead();
+}
+
+bool BackendSessionImpl::DrainFrames(const uint8_t *data, int32_t size, int32_t &consumed, bool inPlace)
+{
+    consumed = 0;
     while (true)
     {
-        int32_t ds = _recvBuffer.DataSize();
+        int32_t ds = size - consumed;
         if (ds < (int32_t)sizeof(PacketHeader))
             break;
-        PacketHeader *h = (PacketHeader *)_recvBuffer.ReadPos();
+        const PacketHeader *h = (const PacketHeader *)(data + consumed);
         if (h->size > 1024 * 10 || h->size == 0)
         {
             _owner->Close();
-            return;
+            return false;
         }
         if (ds < h->size)
             break;
 
-        PacketMessage *msg = MessagePool::AllocatePacket(h->size);
+        // Server-to-server traffic is never shed by the MessagePool budget
+        IMessage *msg = nullptr;
+        if (inPlace)
+        {
+            PacketRefMessage *ref = MessagePool::AllocatePacketRef(AllocPriority::Critical);
+            if (ref)
+            {
+                ref->block = _recvBuffer.RetainBlock();
+                ref->frame = data + consumed;
+                ref->length = h->size;
+            }
+            msg = ref;
+        }
+        else
+        {
+            PacketMessage *copy = MessagePool::AllocatePacket(h->size, AllocPriority::Critical);
+            if (copy)
+            {
+                copy->type = MessageType::NETWORK_DATA;
+                std::memcpy(copy->Payload(), data + consumed, h->size);
+            }
+            msg = copy;
+        }
         if (!msg)
         {
             _owner->Close();
-            return;
+            return false;
         }
-        msg->type = MessageType::NETWORK_DATA;
         msg->sessionId = _owner->GetId();
         msg->session = _owner;
-        std::memcpy(msg->Payload(), _recvBuffer.ReadPos(), h->size);
-        if (_owner->_dispatcher)
-        {
-            _owner->IncRef();
-            _owner->_dispatcher->Post(msg);
-        }
-        else
-            MessagePool::Free(msg);
-        _recvBuffer.MoveReadPos(h->size);
+        _owner->PostInbound(msg);
+        consumed += h->size;
     }
-    StartRead();
+    return true;
 }
 
 void BackendSessionImpl::StartHeartbeat()
@@ -32,6 +32,8 @@ public:
     void OnDisconnect() override;
 
     // Specialized Methods
+    void SetParkIdleReads(bool enable); // Idle -> no receive block, reads via per-IO-thread scratch
+    void SetZeroCopyRecv(bool enable);  // Frames reference the receive block (call right after Reset)
     void ConfigHeartbeat(uint32_t intervalMs, uint32_t timeoutMs, std::function<void(BackendSession *)> pingFunc);
     void OnPong() override;
 
@@ -3,7 +3,9 @@
 #include "System/Dispatcher/MessagePool.h"
 #include "System/ILog.h"
 #include "System/Network/IPacketEncryption.h"
+#include "System/Network/IoBackend.h"
 #include "System/Network/RecvBuffer.h"
+#include "System/Network/SendBatch.h"
 #include "System/Packet/PacketHeader.h"
 #include "System/Pch.h"
 
@@ -20,7 +22,8 @@ struct GatewaySessionImpl
 
     // Networking Buffers
     RecvBuffer _recvBuffer;
-    std::vector<uint8_t> _linearBuffer;
+    std::vector<uint8_t> _linearBuffer; // Encrypted path
+    SendBatch _sendBatch;               // Plain path (scatter-gather, shared broadcast buffers)
 
     // Timers
     std::unique_ptr<boost::asio::steady_timer> _flowControlTimer;
@@ -33,16 +36,32 @@ struct GatewaySessionImpl
     uint32_t _hbTimeout = 0;
     std::function<void(GatewaySession *)> _hbPingFunc;
 
-    bool _readPaused = false;
+    // [Parked Reads] Idle -> no RecvBuffer block, wait for readiness and read into the thread scratch
+    bool _parkIdleReads = false;
 
     GatewaySessionImpl(GatewaySession *owner) : _owner(owner)
     {
     }
 
+    enum class DrainResult {
+        Drained, // Only a partial frame (or nothing) left
+        Closed,
+        Stalled // MessagePool hard limit: keep the rest, retry after a pause
+    };
+
     void StartRead();
+    void StartParkedRead();
+    void OnReadable(const boost::system::error_code &ec);
     void OnReadComplete(const boost::system::error_code &ec, size_t bytesTransferred);
     void OnRecv(size_t bytesTransferred);
+    // inPlace: data is the shared _recvBuffer block -> PacketRefMessage instead of a copy
+    DrainResult DrainFrames(const uint8_t *data, int32_t size, int32_t &consumed, bool inPlace);
+    IMessage *CopyFrame(const uint8_t *frame, uint16_t size);
+    IMessage *ShareFrame(const uint8_t *frame, uint16_t size);
+    bool DrainRecvBuffer(); // false = closed or paused (stop reading)
     void OnResumeRead(const boost::system::error_code &ec);
+    void ContinueRead();
+    void PauseRead();
 
     void StartHeartbeat();
     void OnHeartbeatTimer(const boost::system::error_code &ec);
@@ -64,7 +83,7 @@ void GatewaySession::Reset()
     _impl->_socket.reset();
     _impl->_encryption.reset();
     _impl->_recvBuffer.Reset();
-    _impl->_readPaused = false;
+    _impl->_sendBatch.Clear();
     _impl->_flowControlTimer.reset();
     _impl->_heartbeatTimer.reset();
 }
@@ -89,7 +108,6 @@ void GatewaySession::Reset(std::shared_ptr<void> socket, uint64_t sessionId, IDi
     }
 
     _impl->_recvBuffer.Reset();
-    _impl->_linearBuffer.reserve(64 * 1024);
     _impl->_lastRecvTime = std::chrono::steady_clock::now();
 }
 
@@ -99,6 +117,7 @@ void GatewaySession::OnRecycle()
         Close();
     _impl->_socket.reset();
     _impl->_encryption.reset();
+    _impl->_recvBuffer.Reset(); // Pooled sessions hold no receive block
 }
 
 void GatewaySession::Close()
@@ -109,6 +128,10 @@ void GatewaySession::Close()
         _impl->_socket->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
         _impl->_socket->close(ec);
     }
+    if (_impl->_flowControlTimer)
+    {
+        _impl->_flowControlTimer->cancel(); // Paused read -> OnResumeRead(operation_aborted)
+    }
     OnDisconnect();
 }
 
@@ -157,6 +180,16 @@ void GatewaySession::SetEncryption(std::unique_ptr<IPacketEncryption> encryption
     _impl->_encryption = std::move(encryption);
 }
 
+void GatewaySession::SetParkIdleReads(bool enable)
+{
+    _impl->_parkIdleReads = enable;
+}
+
+void GatewaySession::SetZeroCopyRecv(bool enable)
+{
+    _impl->_recvBuffer.SetShared(enable);
+}
+
 void GatewaySession::ConfigHeartbeat(
     uint32_t intervalMs, uint32_t timeoutMs, std::function<void(GatewaySession *)> pingFunc
 )
@@ -228,6 +261,26 @@ void GatewaySession::Flush()
         return;
     }
 
+    // [Optimization] Plain: Scatter-Gather (like BackendSession).
+    // Broadcast packets are written from the shared PacketMessage -> O(packet) memory traffic, not O(packet x recipients)
+    if (!_impl->_encryption)
+    {
+        _impl->_sendBatch.Build(tempItems, count);
+
+        IncRef();
+        boost::asio::async_write(
+            *_impl->_socket,
+            _impl->_sendBatch.Buffers(),
+            [this](const boost::system::error_code &ec, size_t bytesTransferred)
+            {
+                _impl->_sendBatch.Clear();
+                _impl->OnWriteComplete(ec, bytesTransferred);
+                DecRef();
+            }
+        );
+        return;
+    }
+
     // Linearize with Encryption
     size_t totalSize = 0;
     for (size_t i = 0; i < count; ++i)
@@ -244,23 +297,16 @@ void GatewaySession::Flush()
     {
         PacketMessage *msg = tempItems[i];
         size_t pktSize = msg->length;
-        if (_impl->_encryption)
-        {
-            // Copy Header (Plain)
-            std::memcpy(destPtr, msg->Payload(), sizeof(PacketHeader));
-            // Encrypt Payload
-            if (pktSize > sizeof(PacketHeader))
-            {
-                _impl->_encryption->Encrypt(
-                    msg->Payload() + sizeof(PacketHeader),
-                    destPtr + sizeof(PacketHeader),
-                    pktSize - sizeof(PacketHeader)
-                );
-            }
-        }
-        else
+        // Copy Header (Plain)
+        std::memcpy(destPtr, msg->Payload(), sizeof(PacketHeader));
+        // Encrypt Payload
+        if (pktSize > sizeof(PacketHeader))
         {
-            std::memcpy(destPtr, msg->Payload(), pktSize);
+            _impl->_encryption->Encrypt(
+                msg->Payload() + sizeof(PacketHeader),
+                destPtr + sizeof(PacketHeader),
+                pktSize - sizeof(PacketHeader)
+            );
         }
         destPtr += pktSize;
         MessagePool::Free(msg);
@@ -287,11 +333,22 @@ void GatewaySessionImpl::StartRead()
     if (!_socket || !_socket->is_open())
         return;
 
+    // [Parked Reads] Nothing pending -> park without a block
+    if (_parkIdleReads && _recvBuffer.DataSize() == 0)
+    {
+        _recvBuffer.Detach();
+        StartParkedRead();
+        return;
+    }
+
+    _recvBuffer.Attach();
     _recvBuffer.Clean();
     _owner->IncRef();
 
-    _socket->async_read_some(
-        boost::asio::buffer(_recvBuffer.WritePos(), _recvBuffer.FreeSize()),
+    // [io_uring] Registered arena blocks are read as fixed buffers (IoBackend.h)
+    AsyncReadSome(
+        *_socket,
+        _recvBuffer,
         [this](const boost::system::error_code &ec, size_t tr)
         {
             OnReadComplete(ec, tr);
@@ -300,6 +357,71 @@ void GatewaySessionImpl::StartRead()
     );
 }
 
+void GatewaySessionImpl::StartParkedRead()
+{
+    // Readiness only: the bytes are pulled synchronously in OnReadable, on the completing thread.
+    // (async_read_some into a per-thread scratch is unsafe: the reactor may fill it from any IO thread.)
+    if (!_socket->non_blocking())
+    {
+        boost::system::error_code ec;
+        _socket->non_blocking(true, ec);
+    }
+
+    _owner->IncRef();
+    _socket->async_wait(
+        boost::asio::ip::tcp::socket::wait_read,
+        [this](const boost::system::error_code &ec)
+        {
+            OnReadable(ec);
+            _owner->DecRef();
+        }
+    );
+}
+
+void GatewaySessionImpl::OnReadable(const boost::system::error_code &ec)
+{
+    if (ec)
+    {
+        _owner->Close();
+        return;
+    }
+
+    uint8_t *scratch = RecvBuffer::GetThreadScratch();
+    boost::system::error_code readEc;
+    size_t bytes = _socket->read_some(boost::asio::buffer(scratch, RecvBuffer::SCRATCH_CAPACITY), readEc);
+    if (readEc == boost::asio::error::would_block || readEc == boost::asio::error::try_again)
+    {
+        StartParkedRead(); // Spurious readiness
+        return;
+    }
+    if (readEc)
+    {
+        _owner->Close();
+        return;
+    }
+
+    // Complete frames go straight from the scratch; only the leftover borrows a block
+    int32_t consumed = 0;
+    DrainResult result = DrainFrames(scratch, static_cast<int32_t>(bytes), consumed, false);
+    if (result == DrainResult::Closed)
+        return;
+
+    if (consumed < static_cast<int32_t>(bytes) &&
+        !_recvBuffer.Append(scratch + consumed, static_cast<int32_t>(bytes) - consumed))
+    {
+        _owner->Close();
+        return;
+    }
+
+    if (result == DrainResult::Stalled)
+    {
+        PauseRead();
+        return;
+    }
+
+    ContinueRead();
+}
+
 void GatewaySessionImpl::OnReadComplete(const boost::system::error_code &ec, size_t bytesTransferred)
 {
     if (ec)
@@ -318,61 +440,160 @@ void GatewaySessionImpl::OnRecv(size_t bytesTransferred)
         return;
     }
 
+    if (!DrainRecvBuffer())
+        return;
+
+    ContinueRead();
+}
+
+GatewaySessionImpl::DrainResult
+GatewaySessionImpl::DrainFrames(const uint8_t *data, int32_t size, int32_t &consumed, bool inPlace)
+{
+    consumed = 0;
     while (true)
     {
-        int32_t dataSize = _recvBuffer.DataSize();
+        int32_t dataSize = size - consumed;
         if (dataSize < (int32_t)sizeof(PacketHeader))
             break;
 
-        PacketHeader *header = (PacketHeader *)_recvBuffer.ReadPos();
-        if (header->size > 65535 || header->size == 0)
+        const uint8_t *frame = data + consumed;
+        const PacketHeader *header = (const PacketHeader *)frame;
+        // [Shared Blocks] MaxFrameSize < 65535: an oversized frame would leave a full block and a zero-length read
+        if (header->size > _recvBuffer.MaxFrameSize() || header->size == 0)
         {
             _owner->Close();
-            return;
+            return DrainResult::Closed;
         }
 
         if (dataSize < header->size)
             break;
 
-        PacketMessage *msg = MessagePool::AllocatePacket(header->size);
+        IMessage *msg = inPlace ? ShareFrame(frame, header->size) : CopyFrame(frame, header->size);
         if (!msg)
         {
+            // [Budget] Hard limit: leave the packet in the recv buffer and retry after a pause
+            if (MessagePool::IsOverHardLimit())
+                return DrainResult::Stalled;
             _owner->Close();
-            return;
+            return DrainResult::Closed;
         }
 
-        msg->type = MessageType::NETWORK_DATA;
         msg->sessionId = _owner->GetId();
         msg->session = _owner;
+        _owner->PostInbound(msg);
 
-        if (_encryption)
-        {
-            std::memcpy(msg->Payload(), _recvBuffer.ReadPos(), sizeof(PacketHeader));
-            if (header->size > sizeof(PacketHeader))
-            {
-                _encryption->Decrypt(
-                    _recvBuffer.ReadPos() + sizeof(PacketHeader),
-                    msg->Payload() + sizeof(PacketHeader),
-                    header->size - sizeof(PacketHeader)
-                );
-            }
-        }
-        else
+        consumed += header->size;
+    }
+    return DrainResult::Drained;
+}
+
+IMessage *GatewaySessionImpl::CopyFrame(const uint8_t *frame, uint16_t size)
+{
+    PacketMessage *msg = MessagePool::AllocatePacket(size);
+    if (!msg)
+        return nullptr;
+
+    msg->type = MessageType::NETWORK_DATA;
+    if (_encryption)
+    {
+        std::memcpy(msg->Payload(), frame, sizeof(PacketHeader));
+        if (size > sizeof(PacketHeader))
         {
-            std::memcpy(msg->Payload(), _recvBuffer.ReadPos(), header->size);
+            _encryption->Decrypt(
+                frame + sizeof(PacketHeader), msg->Payload() + sizeof(PacketHeader), size - sizeof(PacketHeader)
+            );
         }
+    }
+    else
+    {
+        std::memcpy(msg->Payload(), frame, size);
+    }
+    return msg;
+}
+
+IMessage *GatewaySessionImpl::ShareFrame(const uint8_t *frame, uint16_t size)
+{
+    PacketRefMessage *msg = MessagePool::AllocatePacketRef();
+    if (!msg)
+        return nullptr;
+
+    msg->block = _recvBuffer.RetainBlock();
+    msg->frame = frame;
+    msg->length = size;
+    return msg;
+}
 
-        if (_owner->_dispatcher)
+bool GatewaySessionImpl::DrainRecvBuffer()
+{
+    int32_t consumed = 0;
+    // [Zero-Copy] Plain sessions hand frames over in place (encrypted payloads must be decrypted into a copy)
+    const bool inPlace = _recvBuffer.IsShared() && !_encryption;
+    DrainResult result = DrainFrames(_recvBuffer.ReadPos(), _recvBuffer.DataSize(), consumed, inPlace);
+    _recvBuffer.MoveReadPos(consumed);
+
+    if (result == DrainResult::Stalled)
+    {
+        PauseRead();
+        return false;
+    }
+    return result == DrainResult::Drained;
+}
+
+void GatewaySessionImpl::ContinueRead()
+{
+    // [Backpressure] Stop pulling from the socket while the logic thread is behind.
+    // Unread bytes stay in the kernel buffer and the TCP window throttles the client.
+    if (_owner->ShouldPauseRead())
+    {
+        PauseRead();
+        return;
+    }
+    StartRead();
+}
+
+void GatewaySessionImpl::PauseRead()
+{
+    if (!_flowControlTimer)
+    {
+        StartRead();
+        return;
+    }
+
+    // [Lazy Buffer] Nothing pending -> no read outstanding while paused, give the block back
+    if (_recvBuffer.DataSize() == 0)
+        _recvBuffer.Detach();
+
+    _owner->MarkReadPaused(true);
+    _flowControlTimer->expires_after(std::chrono::milliseconds(Session::FLOW_CONTROL_RETRY_MS));
+    _owner->IncRef();
+    _flowControlTimer->async_wait(
+        [this](const boost::system::error_code &ec)
         {
-            _owner->IncRef();
-            _owner->_dispatcher->Post(msg);
+            OnResumeRead(ec);
+            _owner->DecRef();
         }
-        else
-            MessagePool::Free(msg);
+    );
+}
 
-        _recvBuffer.MoveReadPos(header->size);
+void GatewaySessionImpl::OnResumeRead(const boost::system::error_code &ec)
+{
+    if (ec || !_owner->IsConnected())
+    {
+        _owner->MarkReadPaused(false);
+        return;
     }
 
+    if (!_owner->CanResumeRead())
+    {
+        PauseRead(); // Re-arm (still counted as one paused session)
+        return;
+    }
+
+    // Packets held back by a budget stall are delivered before reading more
+    if (!DrainRecvBuffer())
+        return;
+
+    _owner->MarkReadPaused(false);
     StartRead();
 }
 
@@ -34,6 +34,8 @@ public:
 
     // Specialized Methods
     void SetEncryption(std::unique_ptr<IPacketEncryption> encryption);
+    void SetParkIdleReads(bool enable); // Idle -> no receive block, reads via per-IO-thread scratch
+    void SetZeroCopyRecv(bool enable);  // Plain frames reference the receive block (call right after Reset)
     void ConfigHeartbeat(uint32_t intervalMs, uint32_t timeoutMs, std::function<void(GatewaySession *)> pingFunc);
     void OnPong() override;
 
@@ -2,10 +2,40 @@
 #include "System/Dispatcher/IDispatcher.h"
 #include "System/Dispatcher/MessagePool.h"
 #include "System/ILog.h"
+#include "System/Metrics/IMetrics.h"
 #include "System/Packet/IPacket.h"
 
 namespace System {
 
+// [Backpressure Metrics] Totals across all sessions
+static std::atomic<int64_t> s_readPausedSessions{0};
+
+// Posted/processed are per-thread sharded counters: the inbound hot path never touches a shared cache line.
+// The aggregate in-flight gauge is the difference, sampled on flow-control transitions.
+struct InboundCounters
+{
+    CounterHandle posted{"session_inbound_posted_total"};
+    CounterHandle processed{"session_inbound_processed_total"};
+};
+
+static InboundCounters &GetInboundCounters()
+{
+    static InboundCounters counters;
+    return counters;
+}
+
+static Gauge &InboundInFlightGauge()
+{
+    static std::shared_ptr<Gauge> gauge = GetMetrics().GetGauge("session_inbound_inflight");
+    return *gauge;
+}
+
+static Gauge &ReadPausedGauge()
+{
+    static std::shared_ptr<Gauge> gauge = GetMetrics().GetGauge("session_read_paused");
+    return *gauge;
+}
+
 Session::Session()
 {
     _lastStatTime = std::chrono::steady_clock::now();
@@ -46,6 +76,13 @@ void Session::Reset()
     _ioRef.store(0);
     _isSending.store(false);
 
+    MarkReadPaused(false);
+    int32_t leftover = _inboundInFlight.exchange(0);
+    if (leftover > 0)
+    {
+        GetInboundCounters().processed.Increment(static_cast<uint64_t>(leftover));
+    }
+
     // Clear send queue safely
     PacketMessage *msg = nullptr;
     while (_sendQueue.try_dequeue(msg))
@@ -104,4 +141,78 @@ void Session::EnqueueSend(PacketMessage *msg)
     }
 }
 
+void Session::PostInbound(IMessage *msg)
+{
+    if (_dispatcher == nullptr)
+    {
+        MessagePool::Free(msg);
+        return;
+    }
+
+    _inboundInFlight.fetch_add(1, std::memory_order_relaxed);
+    GetInboundCounters().posted.Increment();
+
+    IncRef();
+    _dispatcher->Post(msg);
+}
+
+void Session::OnInboundProcessed()
+{
+    _inboundInFlight.fetch_sub(1, std::memory_order_relaxed);
+    GetInboundCounters().processed.Increment();
+}
+
+int64_t Session::GetTotalInboundInFlight()
+{
+    // Slow path: sums every shard
+    const InboundCounters &counters = GetInboundCounters();
+    return static_cast<int64_t>(counters.posted.GetValue() - counters.processed.GetValue());
+}
+
+void Session::PublishInboundInFlight()
+{
+    InboundInFlightGauge().Set(GetTotalInboundInFlight());
+}
+
+bool Session::ShouldPauseRead() const
+{
+    if (_inboundInFlight.load(std::memory_order_relaxed) > INBOUND_HIGH_WATER)
+        return true;
+    // [Budget] MessagePool hard limit: stop pulling new packets in until memory drains
+    if (MessagePool::IsOverHardLimit())
+        return true;
+    return _dispatcher != nullptr && _dispatcher->IsOverloaded();
+}
+
+bool Session::CanResumeRead() const
+{
+    if (_inboundInFlight.load(std::memory_order_relaxed) > INBOUND_LOW_WATER)
+        return false;
+    // Hysteresis: resume only once usage is back under the soft limit
+    if (MessagePool::IsOverSoftLimit())
+        return false;
+    return _dispatcher == nullptr || _dispatcher->IsRecovered();
+}
+
+void Session::MarkReadPaused(bool paused)
+{
+    if (_readPaused == paused)
+        return;
+    _readPaused = paused;
+
+    if (paused)
+    {
+        static const CounterHandle pauseCounter("session_read_pause_total");
+        pauseCounter.Increment();
+        ReadPausedGauge().Set(s_readPausedSessions.fetch_add(1, std::memory_order_relaxed) + 1);
+    }
+    else
+    {
+        ReadPausedGauge().Set(s_readPausedSessions.fetch_sub(1, std::memory_order_relaxed) - 1);
+    }
+
+    // Pause/resume transitions are rare, so the aggregate is sampled here instead of per message
+    PublishInboundInFlight();
+}
+
 } // namespace System
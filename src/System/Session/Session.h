@@ -25,6 +25,11 @@ class Session : public ISession
     friend struct BackendSessionImpl;
 
 public:
+    // [Backpressure] Per-session inbound limit (messages posted but not yet processed)
+    static constexpr int32_t INBOUND_HIGH_WATER = 256;
+    static constexpr int32_t INBOUND_LOW_WATER = 64;
+    static constexpr uint32_t FLOW_CONTROL_RETRY_MS = 5;
+
     Session();
     virtual ~Session();
 
@@ -52,10 +57,32 @@ public:
     {
     }
 
+    // [Backpressure] Inbound accounting
+    void OnInboundProcessed() override;
+    int32_t GetInboundInFlight() const
+    {
+        return _inboundInFlight.load(std::memory_order_relaxed);
+    }
+
+    // Aggregate over all sessions (posted - processed); sums per-thread shards, so not for the hot path
+    static int64_t GetTotalInboundInFlight();
+    // Sets the session_inbound_inflight gauge from the aggregate (also done on every pause/resume transition)
+    static void PublishInboundInFlight();
+
 protected:
     // Internal Enqueue logic used by all Send methods
     void EnqueueSend(PacketMessage *msg);
 
+    // Inbound: IncRef + in-flight accounting + Post (frees msg if there is no dispatcher)
+    void PostInbound(IMessage *msg);
+
+    // [Backpressure] Pause reads when the dispatcher or this session is over its high water,
+    // resume only after both are back under the low water (hysteresis).
+    // MessagePool hard limit pauses every session; reads resume below the soft limit.
+    bool ShouldPauseRead() const;
+    bool CanResumeRead() const;
+    void MarkReadPaused(bool paused);
+
     // Virtual hooks to be implemented by derived classes (using PIMPL to hide implementation)
     virtual void Flush() = 0;
 
@@ -65,6 +92,8 @@ protected:
     IDispatcher *_dispatcher = nullptr;
     std::atomic<bool> _connected{false};
     std::atomic<int> _ioRef{0};
+    std::atomic<int32_t> _inboundInFlight{0};
+    bool _readPaused = false; // Touched only from the session's IO completion handlers
 
     // Shared Networking State (Lock-Free)
     moodycamel::ConcurrentQueue<PacketMessage *> _sendQueue;
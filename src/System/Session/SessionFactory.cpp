@@ -3,12 +3,14 @@
 #include "System/Pch.h"
 #include "System/Session/BackendSession.h"
 #include "System/Session/GatewaySession.h"
+#include "System/Session/SessionHandleAllocator.h"
 #include "System/Session/SessionPool.h"
 #include "System/Session/UDPSession.h"
 
 namespace System {
 
-std::atomic<uint64_t> SessionFactory::_nextSessionId = 1;
+// [SessionHandle] Version | Slot 형태의 ID 발급 (Destroy 시 Slot 반환)
+static SessionHandleAllocator s_sessionHandles;
 std::function<std::unique_ptr<IPacketEncryption>()> SessionFactory::_encryptionFactory;
 double SessionFactory::_rateLimit = 10000.0;
 double SessionFactory::_rateBurst = 20000.0;
@@ -20,10 +22,12 @@ std::function<void(ISession *)> SessionFactory::_hbPingFunc = nullptr;
 
 // Server Role Default (Gateway for backward compatibility)
 ServerRole SessionFactory::_serverRole = ServerRole::Gateway;
+bool SessionFactory::_parkIdleReads = false;
+bool SessionFactory::_zeroCopyRecv[2] = {false, false};
 
 ISession *SessionFactory::CreateSession(std::shared_ptr<boost::asio::ip::tcp::socket> socket, IDispatcher *dispatcher)
 {
-    uint64_t id = _nextSessionId.fetch_add(1);
+    uint64_t id = s_sessionHandles.Allocate();
 
     if (_serverRole == ServerRole::Gateway)
     {
@@ -31,10 +35,13 @@ ISession *SessionFactory::CreateSession(std::shared_ptr<boost::asio::ip::tcp::so
         GatewaySession *gatewaySess = pool.Acquire();
         if (!gatewaySess)
         {
+            s_sessionHandles.Release(id);
             return nullptr;
         }
 
         gatewaySess->Reset(std::static_pointer_cast<void>(socket), id, dispatcher);
+        gatewaySess->SetParkIdleReads(_parkIdleReads);
+        gatewaySess->SetZeroCopyRecv(GetZeroCopyRecv(ServerRole::Gateway) && !_encryptionFactory);
 
         if (_encryptionFactory)
         {
@@ -61,9 +68,14 @@ ISession *SessionFactory::CreateSession(std::shared_ptr<boost::asio::ip::tcp::so
         auto &pool = GetSessionPool<BackendSession>();
         BackendSession *backendSess = pool.Acquire();
         if (!backendSess)
+        {
+            s_sessionHandles.Release(id);
             return nullptr;
+        }
 
         backendSess->Reset(std::static_pointer_cast<void>(socket), id, dispatcher);
+        backendSess->SetParkIdleReads(_parkIdleReads);
+        backendSess->SetZeroCopyRecv(GetZeroCopyRecv(ServerRole::Backend));
 
         if (_hbInterval > 0)
         {
@@ -84,13 +96,14 @@ ISession *SessionFactory::CreateSession(std::shared_ptr<boost::asio::ip::tcp::so
 
 ISession *SessionFactory::CreateUDPSession(const boost::asio::ip::udp::endpoint &endpoint, IDispatcher *dispatcher)
 {
-    uint64_t id = _nextSessionId.fetch_add(1);
+    uint64_t id = s_sessionHandles.Allocate();
 
     auto &pool = GetSessionPool<UDPSession>();
     UDPSession *udpSess = pool.Acquire();
     if (!udpSess)
     {
         LOG_ERROR("[SessionFactory] GetSessionPool<UDPSession>().Acquire() returned NULL!");
+        s_sessionHandles.Release(id);
         return nullptr;
     }
 
@@ -108,6 +121,8 @@ void SessionFactory::Destroy(ISession *session)
     if (!session)
         return;
 
+    // Stale ID (WithSession/SendToSessions after disconnect) -> SessionTable version mismatch
+    s_sessionHandles.Release(session->GetId());
     session->OnRecycle();
 
     if (auto *udpSession = dynamic_cast<UDPSession *>(session))
@@ -148,6 +163,16 @@ void SessionFactory::SetHeartbeatConfig(
     _hbPingFunc = pingFunc;
 }
 
+void SessionFactory::SetParkIdleReads(bool enable)
+{
+    _parkIdleReads = enable;
+}
+
+void SessionFactory::SetZeroCopyRecv(ServerRole role, bool enable)
+{
+    _zeroCopyRecv[static_cast<size_t>(role)] = enable;
+}
+
 void SessionFactory::SetServerRole(ServerRole role)
 {
     _serverRole = role;
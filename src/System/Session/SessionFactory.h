@@ -47,6 +47,21 @@ public:
     // [Heartbeat Config]
     static void SetHeartbeatConfig(uint32_t intervalMs, uint32_t timeoutMs, std::function<void(ISession *)> pingFunc);
 
+    // [Parked Reads] Idle TCP sessions hold no receive block (see RecvBuffer)
+    static void SetParkIdleReads(bool enable);
+    static bool GetParkIdleReads()
+    {
+        return _parkIdleReads;
+    }
+
+    // [Zero-Copy Recv] Per role: framed packets reference the receive block instead of being copied.
+    // Gateway sessions with an encryption factory always copy (payload is decrypted into the message).
+    static void SetZeroCopyRecv(ServerRole role, bool enable);
+    static bool GetZeroCopyRecv(ServerRole role)
+    {
+        return _zeroCopyRecv[static_cast<size_t>(role)];
+    }
+
     // [Server Role Config]
     static void SetServerRole(ServerRole role);
     static ServerRole GetServerRole()
@@ -58,7 +73,6 @@ public:
     static void Cleanup();
 
 private:
-    static std::atomic<uint64_t> _nextSessionId;
     static std::function<std::unique_ptr<IPacketEncryption>()> _encryptionFactory;
     static double _rateLimit;
     static double _rateBurst;
@@ -70,6 +84,9 @@ private:
 
     // Server Role
     static ServerRole _serverRole;
+
+    static bool _parkIdleReads;
+    static bool _zeroCopyRecv[2]; // Index: ServerRole
 };
 
 } // namespace System
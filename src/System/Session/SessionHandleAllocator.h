@@ -0,0 +1,69 @@
+#pragma once
+
+#include "System/Memory/GenerationalID.h"
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace System {
+
+/**
+ * @brief SessionHandle(Version | Slot) 발급기
+ *
+ * - Allocate(): Free Slot 을 재사용하거나 새 Slot 을 연다. (Slot 은 1 부터 시작)
+ * - Release(): 해당 Slot 의 Version 을 올리고 Free List 로 반환 -> 이전 ID 는 Stale 이 된다.
+ *
+ * Slot 번호가 Dense 하게 유지되므로 Dispatcher 의 SessionTable 이 배열 인덱스로 바로 쓸 수 있다.
+ * Accept/Destroy 빈도는 낮으므로 단순 mutex 로 보호한다.
+ */
+class SessionHandleAllocator
+{
+public:
+    uint64_t Allocate()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        uint32_t slot;
+        if (!_freeSlots.empty())
+        {
+            slot = _freeSlots.back();
+            _freeSlots.pop_back();
+        }
+        else
+        {
+            _versions.push_back(0);
+            slot = static_cast<uint32_t>(_versions.size()); // 1-based
+        }
+        return SessionHandle::Make(_versions[slot - 1], slot);
+    }
+
+    void Release(uint64_t sessionId)
+    {
+        uint32_t slot = SessionHandle::GetSlot(sessionId);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (slot == 0 || slot > _versions.size())
+            return;
+
+        // 이미 반환된 ID (중복 Destroy) 는 무시
+        uint32_t &version = _versions[slot - 1];
+        if (version != SessionHandle::GetVersion(sessionId))
+            return;
+
+        ++version;
+        _freeSlots.push_back(slot);
+    }
+
+    size_t GetSlotCount() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _versions.size();
+    }
+
+private:
+    mutable std::mutex _mutex;
+    std::vector<uint32_t> _versions; // index = slot - 1
+    std::vector<uint32_t> _freeSlots;
+};
+
+} // namespace System
@@ -1,24 +1,41 @@
 #pragma once
 
+#include "System/ILog.h"
 #include "System/ISession.h"
 #include "System/Pch.h"
 #include "System/Session/BackendSession.h"
 #include "System/Session/GatewaySession.h"
 #include "System/Session/UDPSession.h"
+#include "System/Thread/CpuTopology.h"
 #include <concurrentqueue/moodycamel/concurrentqueue.h>
 
+#include <algorithm>
 #include <atomic>
+#include <mutex>
 #include <thread>
 
 namespace System {
 
+/**
+ * [NUMA] One free list per pool node (CpuTopology pool locality).
+ * Sessions are constructed on a thread running on their node (first-touch placement),
+ * Acquire prefers the caller's node and Release returns a session to the node backing it.
+ * With locality off there is a single free list (node 0).
+ *
+ * [Growth] Never blocks the caller on a batch allocation.
+ * - Sessions no longer own a receive block up front (RecvBuffer attaches lazily), so one session is cheap.
+ * - Empty pool -> Acquire constructs a single session inline and kicks the background grower.
+ * - WarmUp constructs a small seed synchronously; the rest is filled by the background grower.
+ */
 template <typename T> class SessionPoolBase
 {
 public:
     static constexpr double GROWTH_THRESHOLD = 0.8; // 80% used -> grow
     static constexpr size_t DEFAULT_GROWTH_SIZE = 512;
+    static constexpr size_t WARMUP_SEED_SIZE = 256; // Per node, before the server reports ready
+    static constexpr size_t NODE_COUNT = CpuTopology::MAX_POOL_NODES;
 
-    SessionPoolBase() : _totalAllocated(0), _availableCount(0), _isGrowing(false)
+    SessionPoolBase() : _totalAllocated(0), _availableCount(0), _isGrowing(false), _stopGrowth(false)
     {
     }
 
@@ -29,28 +46,55 @@ public:
 
     void Clear()
     {
+        // Stop and join the grower first so it cannot refill the lists behind us
+        _stopGrowth.store(true);
+        JoinGrower();
+        _stopGrowth.store(false);
+
         T *session;
-        while (_pool.try_dequeue(session))
+        for (auto &pool : _pools)
         {
-            delete session;
+            while (pool.try_dequeue(session))
+            {
+                delete session;
+            }
         }
         _totalAllocated.store(0);
         _availableCount.store(0);
     }
 
-    // [Production] Initial Warm-up: 1.2x expected CCU
+    // [Production] Initial Warm-up: 1.2x expected CCU (seed now, remainder in background)
     void WarmUp(size_t expectedCCU)
     {
         // 1.2x Warm-up using integer math
         size_t initialSize = expectedCCU + (expectedCCU / 5);
-        LOG_INFO("[SessionPool] Warming up with {} sessions (Expected CCU: {})...", initialSize, expectedCCU);
-        Grow(initialSize);
+        const size_t nodeCount = CpuTopology::GetPoolNodeCount();
+        const size_t perNode = (initialSize + nodeCount - 1) / nodeCount;
+        const size_t seed = std::min(perNode, WARMUP_SEED_SIZE);
+
+        LOG_INFO(
+            "[SessionPool] Warming up with {} sessions (Expected CCU: {}, seed {} per node, rest in background)...",
+            initialSize,
+            expectedCCU,
+            seed
+        );
+
+        for (size_t node = 0; node < nodeCount; ++node)
+        {
+            Grow(seed, node);
+        }
+
+        if (perNode > seed)
+        {
+            StartGrower(perNode - seed, nodeCount);
+        }
     }
 
     T *Acquire()
     {
+        const size_t node = CpuTopology::GetCurrentPoolNode();
         T *session;
-        if (_pool.try_dequeue(session))
+        if (TryDequeue(node, session))
         {
             size_t available = _availableCount.fetch_sub(1) - 1;
             size_t total = _totalAllocated.load();
@@ -58,73 +102,150 @@ public:
             // Proactive Check: If available < 20% of total (80% used), grow in background
             if (available * 5 < total)
             {
-                TriggerBackgroundGrowth();
+                TriggerBackgroundGrowth(node);
             }
 
             return session;
         }
 
-        // [Emergency Fix] If pool is totally empty, block once to grow
-        LOG_WARN("[SessionPool] Pool exhausted! Emergency blocking growth initiated.");
-        Grow(DEFAULT_GROWTH_SIZE);
-
-        if (_pool.try_dequeue(session))
-        {
-            _availableCount.fetch_sub(1);
-            return session;
-        }
-
-        return nullptr;
+        // [Lock-Free Growth] Pool dry: one session inline (no receive block -> cheap), batch in background
+        session = new T();
+        _totalAllocated.fetch_add(1);
+        TriggerBackgroundGrowth(node);
+        return session;
     }
 
     void Release(T *session)
     {
         if (session)
         {
-            _pool.enqueue(session);
+            _pools[HomeNodeOf(session)].enqueue(session);
             _availableCount.fetch_add(1);
         }
     }
 
+    size_t GetTotalAllocated() const
+    {
+        return _totalAllocated.load();
+    }
+
+    size_t GetAvailableCount() const
+    {
+        return _availableCount.load();
+    }
+
+    bool IsGrowing() const
+    {
+        return _isGrowing.load();
+    }
+
 private:
-    void TriggerBackgroundGrowth()
+    // Caller's node first, then any other node (a remote session beats a fresh allocation)
+    bool TryDequeue(size_t node, T *&session)
+    {
+        if (_pools[node].try_dequeue(session))
+            return true;
+        for (size_t other = 0; other < NODE_COUNT; ++other)
+        {
+            if (other != node && _pools[other].try_dequeue(session))
+                return true;
+        }
+        return false;
+    }
+
+    static size_t HomeNodeOf(const T *session)
+    {
+        if (CpuTopology::GetPoolNodeCount() <= 1)
+            return 0;
+        // get_mempolicy syscall: Release is a disconnect-rate event, not a packet-rate one
+        int node = CpuTopology::GetNodeOfAddress(session);
+        if (node < 0)
+            return CpuTopology::GetCurrentPoolNode();
+        return static_cast<size_t>(node) % NODE_COUNT;
+    }
+
+    void TriggerBackgroundGrowth(size_t node)
+    {
+        StartGrower(DEFAULT_GROWTH_SIZE, node + 1, node);
+    }
+
+    // One grower at a time: adds `countPerNode` sessions to nodes [firstNode, endNode)
+    void StartGrower(size_t countPerNode, size_t endNode, size_t firstNode = 0)
     {
         // Atomically set _isGrowing to true only if it was false
         bool expected = false;
         if (!_isGrowing.compare_exchange_strong(expected, true))
             return; // Growth already in progress
 
-        // Standard Practice: Growth in background to avoid blocking logic thread
-        // Use detached thread for fire-and-forget background maintenance
-        std::thread(
-            [this]()
+        // The previous grower already cleared _isGrowing (its last step) -> join is immediate
+        std::lock_guard<std::mutex> lock(_growerMutex);
+        if (_grower.joinable())
+            _grower.join();
+
+        // Standard Practice: Growth in background to avoid blocking logic/IO threads.
+        // Joinable (not detached) so Clear()/shutdown never races a grower still filling the lists.
+        _grower = std::thread(
+            [this, countPerNode, firstNode, endNode]()
             {
                 LOG_INFO(
-                    "[SessionPool] Background growing... (Current: {}, Added: {})",
+                    "[SessionPool] Background growing... (Current: {}, Added: {} per node, Nodes: {}~{})",
                     _totalAllocated.load(),
-                    DEFAULT_GROWTH_SIZE
+                    countPerNode,
+                    firstNode,
+                    endNode - 1
                 );
-                Grow(DEFAULT_GROWTH_SIZE);
+                for (size_t node = firstNode; node < endNode && !_stopGrowth.load(); ++node)
+                {
+                    Grow(countPerNode, node);
+                }
                 _isGrowing.store(false);
             }
-        ).detach();
+        );
+    }
+
+    void JoinGrower()
+    {
+        std::lock_guard<std::mutex> lock(_growerMutex);
+        if (_grower.joinable())
+            _grower.join();
     }
 
-    void Grow(size_t count)
+    void Grow(size_t count, size_t node)
     {
-        for (size_t i = 0; i < count; ++i)
+        // [NUMA] Construct on a thread bound to the target node so first-touch places the pages there
+        if (CpuTopology::GetPoolNodeCount() > 1 && node != CpuTopology::GetCurrentPoolNode())
         {
-            _pool.enqueue(new T());
+            std::thread(
+                [this, count, node]()
+                {
+                    CpuTopology::PinCurrentThread(CpuTopology::GetCpusOfNode(static_cast<int>(node)));
+                    GrowLocal(count, node);
+                }
+            ).join();
+            return;
+        }
+        GrowLocal(count, node);
+    }
+
+    void GrowLocal(size_t count, size_t node)
+    {
+        // Publish one by one: an Acquire racing the grower gets a session as soon as it exists
+        for (size_t i = 0; i < count && !_stopGrowth.load(std::memory_order_relaxed); ++i)
+        {
+            _pools[node].enqueue(new T());
+            _totalAllocated.fetch_add(1);
+            _availableCount.fetch_add(1);
         }
-        _totalAllocated.fetch_add(count);
-        _availableCount.fetch_add(count);
     }
 
 private:
-    moodycamel::ConcurrentQueue<T *> _pool;
+    moodycamel::ConcurrentQueue<T *> _pools[NODE_COUNT];
     std::atomic<size_t> _totalAllocated;
     std::atomic<size_t> _availableCount;
     std::atomic<bool> _isGrowing;
+    std::atomic<bool> _stopGrowth;
+    std::mutex _growerMutex; // Guards the std::thread handle only (start/join), never Acquire/Release
+    std::thread _grower;
 };
 
 template <typename T> SessionPoolBase<T> &GetSessionPool()
@@ -41,6 +41,25 @@ public:
      */
     virtual void Update(uint32_t current) = 0;
 
+    /**
+     * @brief Update and flush right away (ACKs / new segments after Input or Send).
+     * @param current Current time in milliseconds
+     */
+    virtual void Flush(uint32_t current) = 0;
+
+    /**
+     * @brief Time the next Update is due (ikcp_check).
+     * @param current Current time in milliseconds
+     * @return Due time in milliseconds (<= current + interval)
+     */
+    virtual uint32_t Check(uint32_t current) const = 0;
+
+    /**
+     * @brief Nothing queued, in flight, to acknowledge or to probe.
+     * An idle instance needs no Update until the next Send or Input.
+     */
+    virtual bool IsIdle() const = 0;
+
     /**
      * @brief Get data ready to send over UDP.
      * @param buffer Output buffer
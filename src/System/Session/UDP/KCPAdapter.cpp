@@ -78,6 +78,37 @@ void KCPAdapter::Update(uint32_t current)
     }
 }
 
+void KCPAdapter::Flush(uint32_t current)
+{
+    if (_kcp)
+    {
+        // ikcp_update stamps the clock (and flushes if the interval elapsed); ikcp_flush sends the rest now
+        ikcp_update((ikcpcb *)_kcp, current);
+        ikcp_flush((ikcpcb *)_kcp);
+    }
+}
+
+uint32_t KCPAdapter::Check(uint32_t current) const
+{
+    if (!_kcp)
+    {
+        return current;
+    }
+
+    return ikcp_check((const ikcpcb *)_kcp, current);
+}
+
+bool KCPAdapter::IsIdle() const
+{
+    if (!_kcp)
+    {
+        return true;
+    }
+
+    const ikcpcb *kcp = (const ikcpcb *)_kcp;
+    return ikcp_waitsnd(kcp) == 0 && kcp->ackcount == 0 && kcp->probe == 0 && kcp->rmt_wnd != 0;
+}
+
 int KCPAdapter::Output(uint8_t *buffer, int maxSize)
 {
     if (!_kcp)
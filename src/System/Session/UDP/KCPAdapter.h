@@ -19,6 +19,9 @@ public:
     int Send(const void *data, int length) override;
     int Input(const void *data, int length) override;
     void Update(uint32_t current) override;
+    void Flush(uint32_t current) override;
+    uint32_t Check(uint32_t current) const override;
+    bool IsIdle() const override;
     int Output(uint8_t *buffer, int maxSize) override;
     int Recv(uint8_t *buffer, int maxSize) override;
 
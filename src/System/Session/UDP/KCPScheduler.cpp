@@ -0,0 +1,165 @@
+#include "System/Session/UDP/KCPScheduler.h"
+#include "System/ILog.h"
+#include "System/Pch.h"
+#include "System/Session/UDPSession.h"
+#include <algorithm>
+#include <array>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <vector>
+
+namespace System {
+
+static constexpr size_t WHEEL_MASK = KCPScheduler::WHEEL_SLOTS - 1;
+static_assert((KCPScheduler::WHEEL_SLOTS & WHEEL_MASK) == 0, "WHEEL_SLOTS must be a power of two");
+
+struct KCPScheduler::Impl : std::enable_shared_from_this<KCPScheduler::Impl>
+{
+    struct Entry
+    {
+        UDPSession *session;
+        uint64_t tick;
+        uint32_t generation;
+    };
+
+    explicit Impl(boost::asio::io_context &ioContext) : timer(ioContext)
+    {
+    }
+
+    boost::asio::steady_timer timer;
+    std::atomic<bool> running{false};
+
+    mutable std::mutex mutex;
+    std::array<std::vector<Entry>, WHEEL_SLOTS> wheel;
+    uint64_t lastTick = KCPScheduler::NowMs() / TICK_MS; // Ticks <= lastTick have been run
+    size_t pending = 0;
+    std::atomic<uint64_t> updates{0};
+
+    void Arm()
+    {
+        timer.expires_after(std::chrono::milliseconds(TICK_MS));
+        timer.async_wait(
+            [weak = weak_from_this()](const boost::system::error_code &ec)
+            {
+                if (ec)
+                    return;
+                auto self = weak.lock();
+                if (!self || !self->running.load(std::memory_order_relaxed))
+                    return;
+                self->Advance(KCPScheduler::NowMs());
+                self->Arm();
+            }
+        );
+    }
+
+    size_t Advance(uint64_t nowMs)
+    {
+        const uint64_t nowTick = nowMs / TICK_MS;
+        std::vector<Entry> ready;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (nowTick <= lastTick)
+                return 0;
+
+            // A stall longer than one revolution visits every bucket once
+            const uint64_t first = std::max(lastTick + 1, nowTick >= WHEEL_SLOTS ? nowTick - WHEEL_SLOTS + 1 : 0);
+            for (uint64_t tick = first; tick <= nowTick; ++tick)
+            {
+                std::vector<Entry> &bucket = wheel[tick & WHEEL_MASK];
+                auto keep = std::partition(
+                    bucket.begin(), bucket.end(),
+                    [nowTick](const Entry &entry)
+                    {
+                        return entry.tick > nowTick; // Later revolution
+                    }
+                );
+                ready.insert(ready.end(), keep, bucket.end());
+                bucket.erase(keep, bucket.end());
+            }
+            lastTick = nowTick;
+            pending -= ready.size();
+        }
+
+        // Outside the wheel lock: the update reschedules into this wheel
+        size_t ran = 0;
+        for (const Entry &entry : ready)
+        {
+            if (entry.session->RunScheduledKCP(entry.generation, static_cast<uint32_t>(nowMs)))
+                ++ran;
+        }
+        updates.fetch_add(ran, std::memory_order_relaxed);
+        return ran;
+    }
+};
+
+KCPScheduler::KCPScheduler(boost::asio::io_context &ioContext) : _impl(std::make_shared<Impl>(ioContext))
+{
+}
+
+KCPScheduler::~KCPScheduler()
+{
+    Stop();
+}
+
+void KCPScheduler::Start()
+{
+    if (_impl->running.exchange(true))
+        return;
+    _impl->Arm();
+    LOG_INFO("[KCPScheduler] Started ({}ms tick, {} slots)", TICK_MS, WHEEL_SLOTS);
+}
+
+void KCPScheduler::Stop()
+{
+    if (!_impl->running.exchange(false))
+        return;
+    // The timer belongs to the io_context thread (skipped if Start ran again in the meantime:
+    // its Arm() already replaced the old wait)
+    boost::asio::post(
+        _impl->timer.get_executor(),
+        [weak = std::weak_ptr<Impl>(_impl)]()
+        {
+            auto self = weak.lock();
+            if (self && !self->running.load(std::memory_order_relaxed))
+                self->timer.cancel();
+        }
+    );
+}
+
+void KCPScheduler::Schedule(UDPSession *session, uint32_t dueMs, uint32_t generation)
+{
+    const uint64_t now = NowMs();
+    const int32_t delay = static_cast<int32_t>(dueMs - static_cast<uint32_t>(now)); // KCP clock wraps
+    uint64_t dueTick = (now + static_cast<uint64_t>(std::max(delay, 0)) + TICK_MS - 1) / TICK_MS;
+
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    dueTick = std::max(dueTick, _impl->lastTick + 1);
+    _impl->wheel[dueTick & WHEEL_MASK].push_back(Impl::Entry{session, dueTick, generation});
+    ++_impl->pending;
+}
+
+size_t KCPScheduler::Advance(uint64_t nowMs)
+{
+    return _impl->Advance(nowMs);
+}
+
+size_t KCPScheduler::GetPendingCount() const
+{
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    return _impl->pending;
+}
+
+uint64_t KCPScheduler::GetUpdateCount() const
+{
+    return _impl->updates.load(std::memory_order_relaxed);
+}
+
+uint64_t KCPScheduler::NowMs()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count()
+    );
+}
+
+} // namespace System
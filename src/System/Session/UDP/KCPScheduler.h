@@ -0,0 +1,57 @@
+#pragma once
+
+#include <boost/asio/io_context.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace System {
+
+class UDPSession;
+
+/**
+ * @brief ikcp_check 기반 KCP Update 스케줄러 (UDPNetworkImpl 소유, 공유 io_context 에서 동작)
+ *
+ * - 세션은 ikcp_check 가 알려준 다음 처리 시각의 버킷(5ms tick, 512 슬롯 Hashed Wheel)에 들어간다.
+ * - tick 마다 시각이 된 세션만 UDPSession::RunScheduledKCP 로 ikcp_update + flush 한다.
+ * - 보낼 것 / 재전송 / ACK / 윈도우 프로브가 없는 세션은 휠에 없다 (Send / Input 이 다시 넣는다).
+ *   따라서 유휴 세션 비용은 0 이고, tick 비용은 처리할 세션 수에만 비례한다.
+ *
+ * 세션별 중복/취소는 세대 번호(generation)로 처리한다: 더 이른 시각으로 다시 넣으면 이전 항목은
+ * 만료 시 무시된다. 항목이 가리키는 UDPSession 은 SessionPool 소유라 메모리가 유효해야 한다.
+ */
+class KCPScheduler
+{
+public:
+    static constexpr uint32_t TICK_MS = 5;
+    static constexpr size_t WHEEL_SLOTS = 512; // 2.56s per revolution; later dues wait for their revolution
+
+    explicit KCPScheduler(boost::asio::io_context &ioContext);
+    ~KCPScheduler();
+
+    KCPScheduler(const KCPScheduler &) = delete;
+    KCPScheduler &operator=(const KCPScheduler &) = delete;
+
+    void Start();
+    void Stop();
+
+    // Thread-safe. dueMs is on the KCP clock (NowMs truncated to 32 bits).
+    void Schedule(UDPSession *session, uint32_t dueMs, uint32_t generation);
+
+    // Runs every entry due at nowMs (the timer calls this each tick; tests may drive it directly)
+    size_t Advance(uint64_t nowMs);
+
+    // Entries in the wheel (including stale ones not yet reached)
+    size_t GetPendingCount() const;
+    // Scheduled updates run so far
+    uint64_t GetUpdateCount() const;
+
+    // Monotonic milliseconds (steady_clock); the low 32 bits are the KCP clock
+    static uint64_t NowMs();
+
+private:
+    struct Impl;
+    std::shared_ptr<Impl> _impl; // Timer handlers hold a weak_ptr
+};
+
+} // namespace System
@@ -10,6 +10,7 @@
 #include "System/Packet/IPacket.h"
 #include "System/Pch.h"
 #include "System/Session/UDP/KCPAdapter.h"
+#include "System/Session/UDP/KCPScheduler.h"
 
 #include <cstdint>
 #include <functional>
@@ -19,10 +20,52 @@ namespace System {
 struct UDPSessionImpl
 {
     boost::asio::ip::udp::endpoint endpoint;
-    std::chrono::steady_clock::time_point lastActivity;
+    // steady_clock ticks; written by the receiving shard, read by registry cleanup
+    std::atomic<std::chrono::steady_clock::rep> lastActivity{0};
     UDPNetworkImpl *network = nullptr;
     uint128_t udpToken = 0;
     std::unique_ptr<IKCPAdapter> kcp;
+
+    // [KCP Scheduling] kcp is touched by the receive shard, logic threads and the scheduler
+    std::mutex kcpMutex;
+    uint32_t kcpGeneration = 0; // Bumped when the wheel entry is superseded
+    bool kcpScheduled = false;
+    uint32_t kcpDueMs = 0;
+
+    static uint32_t KcpNow()
+    {
+        return static_cast<uint32_t>(KCPScheduler::NowMs());
+    }
+
+    // kcpMutex held. Files the next ikcp_check time unless idle or an earlier entry is already queued.
+    void ScheduleKCP(UDPSession *session, uint32_t currentMs)
+    {
+        if (kcp == nullptr || network == nullptr || kcp->IsIdle())
+            return;
+        KCPScheduler *scheduler = network->GetKCPScheduler();
+        if (scheduler == nullptr)
+            return;
+
+        const uint32_t due = kcp->Check(currentMs);
+        if (kcpScheduled && static_cast<int32_t>(due - kcpDueMs) >= 0)
+            return; // That run re-checks
+
+        ++kcpGeneration;
+        kcpScheduled = true;
+        kcpDueMs = due;
+        scheduler->Schedule(session, due, kcpGeneration);
+    }
+
+    void SendKCP(UDPSession *session, const uint8_t *data, int length)
+    {
+        std::lock_guard<std::mutex> lock(kcpMutex);
+        if (kcp == nullptr)
+            return;
+        const uint32_t now = KcpNow();
+        kcp->Send(data, length);
+        kcp->Flush(now);
+        ScheduleKCP(session, now);
+    }
 };
 
 UDPSession::UDPSession() : _impl(std::make_unique<UDPSessionImpl>())
@@ -45,44 +88,53 @@ void UDPSession::Reset(
     _connected.store(true);
 
     _impl->endpoint = endpoint;
-    _impl->lastActivity = std::chrono::steady_clock::now();
+    UpdateActivity();
     _impl->udpToken = GenerateUDPToken::Generate();
 
     // KCP 초기화
-    _impl->kcp = std::make_unique<KCPAdapter>(static_cast<uint32_t>(sessionId));
-    _impl->kcp->SetOutputCallback(
-        [this](const char *buf, int len) -> int
-        {
-            if (_impl->network == nullptr)
-                return 0;
-
-            // [Zero-Copy] 풀에서 할당 -> 복사 1회 -> AsyncSend로 소유권 이전
-            auto *msg = MessagePool::AllocatePacket(static_cast<uint16_t>(len));
-            if (!msg)
+    {
+        std::lock_guard<std::mutex> lock(_impl->kcpMutex);
+        _impl->kcp = std::make_unique<KCPAdapter>(static_cast<uint32_t>(sessionId));
+        _impl->kcp->SetOutputCallback(
+            [this](const char *buf, int len) -> int
             {
-                LOG_ERROR("KCP Output Failed: MessagePool Exhausted");
-                return -1;
-            }
+                if (_impl->network == nullptr)
+                    return 0;
 
-            std::memcpy(msg->Payload(), buf, len);
+                // [Zero-Copy] 풀에서 할당 -> 복사 1회 -> AsyncSend로 소유권 이전
+                auto *msg = MessagePool::AllocatePacket(static_cast<uint16_t>(len));
+                if (!msg)
+                {
+                    LOG_ERROR("KCP Output Failed: MessagePool Exhausted");
+                    return -1;
+                }
 
-            // AsyncSend가 메시지를 해제할 책임을 가짐
-            _impl->network->AsyncSend(
-                _impl->endpoint, UDPTransportHeader::TAG_KCP, _id, _impl->udpToken, msg, static_cast<uint16_t>(len)
-            );
+                std::memcpy(msg->Payload(), buf, len);
 
-            return 0;
-        }
-    );
+                // AsyncSend가 메시지를 해제할 책임을 가짐
+                _impl->network->AsyncSend(
+                    _impl->endpoint, UDPTransportHeader::TAG_KCP, _id, _impl->udpToken, msg, static_cast<uint16_t>(len)
+                );
+
+                return 0;
+            }
+        );
+    }
 
     LOG_INFO("[UDPSession] Session {} reset for endpoint {}:{}", _id, endpoint.address().to_string(), endpoint.port());
 }
 
 void UDPSession::OnRecycle()
 {
+    {
+        // Any wheel entry left for this session becomes stale
+        std::lock_guard<std::mutex> lock(_impl->kcpMutex);
+        ++_impl->kcpGeneration;
+        _impl->kcpScheduled = false;
+        _impl->kcp.reset();
+    }
     _impl->network = nullptr;
     _impl->endpoint = {};
-    _impl->kcp.reset();
     _connected.store(false);
 
     // 잔여 큐 정리
@@ -100,12 +152,16 @@ const boost::asio::ip::udp::endpoint &UDPSession::GetEndpoint() const
 
 void UDPSession::UpdateActivity()
 {
-    _impl->lastActivity = std::chrono::steady_clock::now();
+    _impl->lastActivity.store(
+        std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed
+    );
 }
 
-const std::chrono::steady_clock::time_point &UDPSession::GetLastActivity() const
+std::chrono::steady_clock::time_point UDPSession::GetLastActivity() const
 {
-    return _impl->lastActivity;
+    return std::chrono::steady_clock::time_point(
+        std::chrono::steady_clock::duration(_impl->lastActivity.load(std::memory_order_relaxed))
+    );
 }
 
 void UDPSession::SetNetwork(UDPNetworkImpl *network)
@@ -132,9 +188,17 @@ void UDPSession::HandleData(const uint8_t *data, size_t length, bool isKCP)
 {
     UpdateActivity();
 
-    if (isKCP && _impl->kcp != nullptr)
+    if (isKCP)
     {
+        // kcp is only read under the lock: OnRecycle resets it on another thread (no kcp: recycled, drop)
+        std::lock_guard<std::mutex> lock(_impl->kcpMutex);
+        if (_impl->kcp == nullptr)
+            return;
+
+        // ACKs go out right away; the scheduler takes over retransmits
+        const uint32_t now = UDPSessionImpl::KcpNow();
         _impl->kcp->Input(data, static_cast<int>(length));
+        _impl->kcp->Flush(now);
 
         uint8_t buffer[2048];
         int receivedSize;
@@ -150,11 +214,12 @@ void UDPSession::HandleData(const uint8_t *data, size_t length, bool isKCP)
                     msg->session = this;
                     std::memcpy(msg->Payload(), buffer, receivedSize);
 
-                    IncRef();
-                    _dispatcher->Post(msg);
+                    PostInbound(msg);
                 }
             }
         }
+
+        _impl->ScheduleKCP(this, now);
     }
     else
     {
@@ -168,8 +233,7 @@ void UDPSession::HandleData(const uint8_t *data, size_t length, bool isKCP)
                 msg->session = this;
                 std::memcpy(msg->Payload(), data, length);
 
-                IncRef();
-                _dispatcher->Post(msg);
+                PostInbound(msg);
             }
         }
     }
@@ -216,31 +280,13 @@ void UDPSession::SendReliable(const IPacket &pkt)
     {
         uint8_t buffer[1024];
         pkt.SerializeTo(buffer);
-        if (_impl->kcp)
-        {
-            _impl->kcp->Send(buffer, size);
-            _impl->kcp->Update(
-                static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
-                                          std::chrono::steady_clock::now().time_since_epoch()
-                )
-                                          .count())
-            );
-        }
+        _impl->SendKCP(this, buffer, size);
     }
     else
     {
         std::vector<uint8_t> buffer(size);
         pkt.SerializeTo(buffer.data());
-        if (_impl->kcp)
-        {
-            _impl->kcp->Send(buffer.data(), size);
-            _impl->kcp->Update(
-                static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
-                                          std::chrono::steady_clock::now().time_since_epoch()
-                )
-                                          .count())
-            );
-        }
+        _impl->SendKCP(this, buffer.data(), size);
     }
 }
 
@@ -252,12 +298,27 @@ void UDPSession::SendUnreliable(const IPacket &pkt)
 
 void UDPSession::UpdateKCP(uint32_t currentMs)
 {
+    std::lock_guard<std::mutex> lock(_impl->kcpMutex);
     if (_impl->kcp != nullptr)
     {
         _impl->kcp->Update(currentMs);
+        _impl->ScheduleKCP(this, currentMs);
     }
 }
 
+bool UDPSession::RunScheduledKCP(uint32_t generation, uint32_t currentMs)
+{
+    std::lock_guard<std::mutex> lock(_impl->kcpMutex);
+    if (!_impl->kcpScheduled || generation != _impl->kcpGeneration || _impl->kcp == nullptr)
+        return false;
+
+    _impl->kcpScheduled = false;
+    // Due may be a retransmit before the flush interval: flush, not just ikcp_update
+    _impl->kcp->Flush(currentMs);
+    _impl->ScheduleKCP(this, currentMs);
+    return true;
+}
+
 void UDPSession::Flush()
 {
     if (_impl->network == nullptr)
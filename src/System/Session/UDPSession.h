@@ -27,9 +27,10 @@ public:
 
     const boost::asio::ip::udp::endpoint &GetEndpoint() const;
 
+    // [Lock-Free] relaxed atomic; safe to call from any network thread
     void UpdateActivity();
 
-    const std::chrono::steady_clock::time_point &GetLastActivity() const;
+    std::chrono::steady_clock::time_point GetLastActivity() const;
 
     void HandleData(const uint8_t *data, size_t length, bool isKCP);
 
@@ -47,8 +48,12 @@ public:
     void SendReliable(const IPacket &pkt) override;
     void SendUnreliable(const IPacket &pkt) override;
 
+    // [Poll] Explicit update; sessions bound to a network are normally driven by its KCPScheduler
     void UpdateKCP(uint32_t currentMs);
 
+    // KCPScheduler entry point. false = stale entry (rescheduled earlier, parked or recycled)
+    bool RunScheduledKCP(uint32_t generation, uint32_t currentMs);
+
 protected:
     void Flush() override;
 
@@ -9,6 +9,9 @@
 
 // [Convention] 시스템 모듈 내부 테스트이므로 구현체 참조가 허용됨
 #include "System/Dispatcher/IDispatcher.h"
+#include "System/Dispatcher/MessagePool.h"
+#include "System/Network/RecvBuffer.h"
+#include "System/Packet/PacketHeader.h"
 #include "System/Session/SessionFactory.h"
 #include "System/Session/UDP/KCPWrapper.h"
 #include "System/Session/UDPSession.h"
@@ -41,13 +44,16 @@ public:
     {
         return true;
     }
-    void WithSession(uint64_t, std::function<void(SessionContext &)>) override
+    void WithSession(uint64_t, SessionTask) override
+    {
+    }
+    void SendToSessions(std::span<const uint64_t>, PacketPtr) override
     {
     }
     void RegisterTimerHandler(ITimerHandler *) override
     {
     }
-    void Push(std::function<void()>) override
+    void Push(DispatchTask) override
     {
     }
     void Shutdown() override
@@ -140,3 +146,71 @@ TEST(PerformanceComparison, ProtocolOverhead)
     printf(" - [Group B] Raw Data Copy: %.4f ms\n", rawDuration.count());
     fflush(stdout);
 }
+
+/**
+ * @brief 비교군 테스트: 수신 프레이밍 복사 vs Zero-Copy (RecvBuffer 블록 참조)
+ */
+TEST(PerformanceComparison, InboundFraming)
+{
+    const int rounds = 200;
+    const uint16_t frameSize = 256;
+
+    MessagePool::Prepare(1000, 10, 10);
+
+    RecvBuffer buffer;
+    buffer.SetShared(true);
+    buffer.Attach();
+    const int32_t frameCount = buffer.FreeSize() / frameSize;
+    for (int32_t i = 0; i < frameCount; ++i)
+    {
+        PacketHeader header{frameSize, static_cast<uint16_t>(i)};
+        std::memset(buffer.WritePos(), 'A', frameSize);
+        std::memcpy(buffer.WritePos(), &header, sizeof(header));
+        buffer.MoveWritePos(frameSize);
+    }
+    const uint8_t *frames = buffer.ReadPos();
+
+    std::vector<IMessage *> inFlight;
+    inFlight.reserve(frameCount);
+
+    auto start1 = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r)
+    {
+        for (int32_t i = 0; i < frameCount; ++i)
+        {
+            PacketMessage *msg = MessagePool::AllocatePacket(frameSize);
+            std::memcpy(msg->Payload(), frames + i * frameSize, frameSize);
+            inFlight.push_back(msg);
+        }
+        for (IMessage *msg : inFlight)
+            MessagePool::Free(msg);
+        inFlight.clear();
+    }
+    auto end1 = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> copyDuration = end1 - start1;
+
+    auto start2 = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r)
+    {
+        for (int32_t i = 0; i < frameCount; ++i)
+        {
+            PacketRefMessage *msg = MessagePool::AllocatePacketRef();
+            msg->block = buffer.RetainBlock();
+            msg->frame = frames + i * frameSize;
+            msg->length = frameSize;
+            inFlight.push_back(msg);
+        }
+        for (IMessage *msg : inFlight)
+            MessagePool::Free(msg);
+        inFlight.clear();
+    }
+    auto end2 = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> refDuration = end2 - start2;
+
+    buffer.Reset();
+
+    printf("\n[Comparison] Inbound Framing (%d frames x %d rounds, %u B)\n", frameCount, rounds, frameSize);
+    printf(" - [Group A] Copy into PacketMessage: %.4f ms\n", copyDuration.count());
+    printf(" - [Group B] Zero-Copy PacketRefMessage: %.4f ms\n", refDuration.count());
+    fflush(stdout);
+}
@@ -0,0 +1,303 @@
+#include "System/Thread/CpuTopology.h"
+#include "System/ILog.h"
+#include "System/Pch.h"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <fstream>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace System {
+
+// <numaif.h> 없이 syscall 직접 호출 (libnuma 미설치 환경 대응)
+static constexpr int MPOL_PREFERRED_MODE = 1;
+static constexpr unsigned MPOL_MF_MOVE_FLAG = 1u << 1;
+static constexpr unsigned long MPOL_F_NODE_FLAG = 1ul << 0;
+static constexpr unsigned long MPOL_F_ADDR_FLAG = 1ul << 1;
+
+std::vector<int> ParseCpuList(std::string_view spec)
+{
+    std::vector<int> cpus;
+    while (!spec.empty())
+    {
+        size_t comma = spec.find(',');
+        std::string_view token = spec.substr(0, comma);
+        spec = comma == std::string_view::npos ? std::string_view{} : spec.substr(comma + 1);
+
+        while (!token.empty() && (token.front() == ' ' || token.front() == '\n'))
+            token.remove_prefix(1);
+        while (!token.empty() && (token.back() == ' ' || token.back() == '\n'))
+            token.remove_suffix(1);
+        if (token.empty())
+            continue;
+
+        size_t dash = token.find('-');
+        int first = 0;
+        int last = 0;
+        std::string_view lo = token.substr(0, dash);
+        if (std::from_chars(lo.data(), lo.data() + lo.size(), first).ec != std::errc{} || first < 0)
+            continue;
+        last = first;
+        if (dash != std::string_view::npos)
+        {
+            std::string_view hi = token.substr(dash + 1);
+            if (std::from_chars(hi.data(), hi.data() + hi.size(), last).ec != std::errc{} || last < first)
+                continue;
+        }
+        for (int cpu = first; cpu <= last; ++cpu)
+            cpus.push_back(cpu);
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+namespace {
+
+struct Topology
+{
+    int cpuCount = 1;
+    std::vector<std::vector<int>> nodeCpus; // index = node id
+    std::vector<int> cpuNode;               // index = cpu id
+
+    Topology()
+    {
+        unsigned hw = std::thread::hardware_concurrency();
+        cpuCount = hw > 0 ? static_cast<int>(hw) : 1;
+
+#if defined(__linux__)
+        std::ifstream online("/sys/devices/system/node/online");
+        std::string line;
+        if (online && std::getline(online, line))
+        {
+            for (int node : ParseCpuList(line))
+            {
+                std::ifstream list("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+                std::string cpus;
+                if (!list || !std::getline(list, cpus))
+                    continue;
+                if (nodeCpus.size() <= static_cast<size_t>(node))
+                    nodeCpus.resize(static_cast<size_t>(node) + 1);
+                nodeCpus[node] = ParseCpuList(cpus);
+            }
+        }
+#endif
+        if (nodeCpus.empty())
+        {
+            nodeCpus.emplace_back();
+            for (int cpu = 0; cpu < cpuCount; ++cpu)
+                nodeCpus[0].push_back(cpu);
+        }
+
+        for (size_t node = 0; node < nodeCpus.size(); ++node)
+        {
+            for (int cpu : nodeCpus[node])
+            {
+                if (cpuNode.size() <= static_cast<size_t>(cpu))
+                    cpuNode.resize(static_cast<size_t>(cpu) + 1, 0);
+                cpuNode[cpu] = static_cast<int>(node);
+            }
+        }
+    }
+};
+
+const Topology &GetTopology()
+{
+    static const Topology topology;
+    return topology;
+}
+
+std::atomic<bool> s_poolLocality{false};
+
+} // namespace
+
+int CpuTopology::GetCpuCount()
+{
+    return GetTopology().cpuCount;
+}
+
+int CpuTopology::GetNodeCount()
+{
+    return static_cast<int>(GetTopology().nodeCpus.size());
+}
+
+int CpuTopology::GetNodeOfCpu(int cpu)
+{
+    const Topology &topology = GetTopology();
+    if (cpu < 0 || static_cast<size_t>(cpu) >= topology.cpuNode.size())
+        return 0;
+    return topology.cpuNode[cpu];
+}
+
+std::vector<int> CpuTopology::GetCpusOfNode(int node)
+{
+    const Topology &topology = GetTopology();
+    if (node < 0 || static_cast<size_t>(node) >= topology.nodeCpus.size())
+        return {};
+    return topology.nodeCpus[node];
+}
+
+int CpuTopology::GetCurrentCpu()
+{
+#if defined(_WIN32)
+    return static_cast<int>(GetCurrentProcessorNumber());
+#elif defined(__linux__)
+    int cpu = sched_getcpu();
+    return cpu >= 0 ? cpu : 0;
+#else
+    return 0;
+#endif
+}
+
+int CpuTopology::GetCurrentNode()
+{
+    return GetNodeOfCpu(GetCurrentCpu());
+}
+
+bool CpuTopology::PinCurrentThread(const std::vector<int> &cpus)
+{
+#if defined(_WIN32)
+    return PinThread(GetCurrentThread(), cpus);
+#elif defined(__linux__)
+    return PinThread(pthread_self(), cpus);
+#else
+    return false;
+#endif
+}
+
+bool CpuTopology::PinThread(std::thread::native_handle_type handle, const std::vector<int> &cpus)
+{
+    if (cpus.empty())
+        return false;
+
+#if defined(_WIN32)
+    DWORD_PTR mask = 0;
+    for (int cpu : cpus)
+    {
+        if (cpu >= 0 && cpu < static_cast<int>(sizeof(DWORD_PTR) * 8))
+            mask |= DWORD_PTR(1) << cpu;
+    }
+    return mask != 0 && SetThreadAffinityMask(reinterpret_cast<HANDLE>(handle), mask) != 0;
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus)
+    {
+        if (cpu >= 0 && cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &set);
+    }
+    if (CPU_COUNT(&set) == 0)
+        return false;
+    return pthread_setaffinity_np(handle, sizeof(set), &set) == 0;
+#else
+    (void)handle;
+    return false;
+#endif
+}
+
+bool CpuTopology::BindMemoryToNode(void *addr, size_t len, int node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    if (GetNodeCount() <= 1 || node < 0 || node >= 64)
+        return false;
+
+    const uintptr_t page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(addr) + page - 1) & ~(page - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(addr) + len) & ~(page - 1);
+    if (end <= begin)
+        return false;
+
+    unsigned long mask = 1ul << node;
+    long rc = syscall(
+        SYS_mbind, reinterpret_cast<void *>(begin), end - begin, MPOL_PREFERRED_MODE, &mask, sizeof(mask) * 8,
+        MPOL_MF_MOVE_FLAG
+    );
+    return rc == 0;
+#else
+    (void)addr;
+    (void)len;
+    (void)node;
+    return false;
+#endif
+}
+
+int CpuTopology::GetNodeOfAddress(const void *addr)
+{
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+    if (GetNodeCount() <= 1)
+        return 0;
+    int node = -1;
+    long rc = syscall(SYS_get_mempolicy, &node, nullptr, 0, addr, MPOL_F_NODE_FLAG | MPOL_F_ADDR_FLAG);
+    return rc == 0 ? node : -1;
+#else
+    (void)addr;
+    return 0;
+#endif
+}
+
+void CpuTopology::SetPoolLocality(bool enabled)
+{
+    s_poolLocality.store(enabled, std::memory_order_relaxed);
+}
+
+bool CpuTopology::IsPoolLocalityEnabled()
+{
+    return s_poolLocality.load(std::memory_order_relaxed);
+}
+
+size_t CpuTopology::GetPoolNodeCount()
+{
+    if (!IsPoolLocalityEnabled())
+        return 1;
+    return std::min(static_cast<size_t>(GetNodeCount()), MAX_POOL_NODES);
+}
+
+size_t CpuTopology::GetCurrentPoolNode()
+{
+    if (!IsPoolLocalityEnabled())
+        return 0;
+    return static_cast<size_t>(GetCurrentNode()) % MAX_POOL_NODES;
+}
+
+void CpuTopology::LogTopology()
+{
+    const Topology &topology = GetTopology();
+    LOG_INFO(
+        "[Topology] {} CPUs, {} NUMA node(s), pool locality: {}",
+        topology.cpuCount,
+        topology.nodeCpus.size(),
+        IsPoolLocalityEnabled() ? "on" : "off"
+    );
+    for (size_t node = 0; node < topology.nodeCpus.size(); ++node)
+    {
+        const std::vector<int> &cpus = topology.nodeCpus[node];
+        if (cpus.empty())
+            continue;
+        LOG_INFO("[Topology] Node {}: {} CPUs ({}-{})", node, cpus.size(), cpus.front(), cpus.back());
+    }
+}
+
+bool CpuTopology::PinWorker(const std::vector<int> &cpus, size_t index, const std::string &name)
+{
+    if (cpus.empty())
+        return false;
+
+    int cpu = cpus[index % cpus.size()];
+    if (!PinCurrentThread({cpu}))
+    {
+        LOG_WARN("[Affinity] {} #{} -> CPU {} failed", name, index, cpu);
+        return false;
+    }
+    LOG_INFO("[Affinity] {} #{} -> CPU {} (Node {})", name, index, cpu, GetNodeOfCpu(cpu));
+    return true;
+}
+
+} // namespace System
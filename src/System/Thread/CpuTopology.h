@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace System {
+
+// "0-3,8,10-11" -> {0,1,2,3,8,10,11} (빈 문자열/잘못된 토큰은 무시)
+std::vector<int> ParseCpuList(std::string_view spec);
+
+/**
+ * @brief CPU / NUMA Topology + Thread Pinning
+ *
+ * Linux: sysfs (/sys/devices/system/node) + sched_setaffinity / mbind / get_mempolicy syscall.
+ * libnuma 의존성 없이 동작하며, NUMA 가 없는 환경(단일 노드, Windows)에서는 노드 0 으로 취급한다.
+ *
+ * [Pool Locality]
+ * SetPoolLocality(true) 이후 생성되는 스레드 캐시는 자신이 도는 노드의 Slab/Depot 을 사용한다.
+ * 기본값(false)에서는 모든 풀이 노드 0 하나만 사용 (기존 동작과 동일).
+ */
+class CpuTopology
+{
+public:
+    // MessagePool / SessionPool 이 구분하는 최대 노드 수 (그 이상은 modulo)
+    static constexpr size_t MAX_POOL_NODES = 4;
+
+    static int GetCpuCount();
+    static int GetNodeCount();
+    static int GetNodeOfCpu(int cpu);
+    static std::vector<int> GetCpusOfNode(int node);
+
+    static int GetCurrentCpu();
+    static int GetCurrentNode();
+
+    // Pins the calling thread. Empty list = no-op (returns false).
+    static bool PinCurrentThread(const std::vector<int> &cpus);
+    static bool PinThread(std::thread::native_handle_type handle, const std::vector<int> &cpus);
+
+    // Preferred placement for [addr, addr+len) (page-aligned inward). No-op without NUMA.
+    static bool BindMemoryToNode(void *addr, size_t len, int node);
+    // Node backing the page at addr (-1 if unknown / not faulted in)
+    static int GetNodeOfAddress(const void *addr);
+
+    // [Pool Locality]
+    static void SetPoolLocality(bool enabled);
+    static bool IsPoolLocalityEnabled();
+    // Number of per-node pools in use (1 unless locality is enabled on a multi-node host)
+    static size_t GetPoolNodeCount();
+    // Pool node of the calling thread (0 unless locality is enabled)
+    static size_t GetCurrentPoolNode();
+
+    // Startup log: nodes, CPUs per node, locality mode
+    static void LogTopology();
+
+    // Round-robin pin for worker #index of a pool (cpus[index % size]). Logs the placement.
+    static bool PinWorker(const std::vector<int> &cpus, size_t index, const std::string &name);
+};
+
+} // namespace System
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "System/Thread/IStrand.h"
+#include "System/Thread/StrandContext.h"
 #include "System/Thread/ThreadPool.h"
 #include <atomic>
 #include <memory>
@@ -67,6 +68,7 @@ private:
             // Execute outside lock
             if (task)
             {
+                StrandContext::Scope scope(this);
                 task();
             }
         }
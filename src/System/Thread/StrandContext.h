@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace System {
+
+/**
+ * @brief Serialized execution context of the calling thread.
+ *
+ * A Strand hops between pool threads, so "same OS thread" is the wrong question for
+ * strand-confined data. Strand::Run publishes itself here while a task runs; code that must
+ * stay on one logical owner (e.g. StrandLocalRefCount debug checks) compares OwnerToken().
+ */
+class StrandContext
+{
+public:
+    // Strand currently running on this thread (nullptr outside strand tasks)
+    static const void *Current()
+    {
+        return t_current;
+    }
+
+    // Strand address inside a strand task, otherwise a per-thread token (odd -> never a pointer)
+    static uintptr_t OwnerToken()
+    {
+        if (t_current)
+            return reinterpret_cast<uintptr_t>(t_current);
+        return (static_cast<uintptr_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) << 1) | 1;
+    }
+
+    // RAII: marks the calling thread as running inside `strand` (nesting-safe)
+    class Scope
+    {
+    public:
+        explicit Scope(const void *strand) : _prev(t_current)
+        {
+            t_current = strand;
+        }
+        ~Scope()
+        {
+            t_current = _prev;
+        }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        const void *_prev;
+    };
+
+private:
+    static inline thread_local const void *t_current = nullptr;
+};
+
+} // namespace System
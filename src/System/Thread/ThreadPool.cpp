@@ -1,6 +1,7 @@
 #include "System/Thread/ThreadPool.h"
 #include "System/ILog.h"
 #include "System/Pch.h"
+#include "System/Thread/CpuTopology.h"
 
 namespace System {
 
@@ -36,6 +37,7 @@ void ThreadPool::Start()
             [this, i]()
             {
                 // LOG_INFO("Task Worker #{} Started", i); // Optional spam reduction
+                CpuTopology::PinWorker(_cpus, static_cast<size_t>(i), _name);
                 while (true)
                 {
                     _taskSemaphore.acquire();
@@ -20,6 +20,12 @@ public:
     ThreadPool(int threadCount, const std::string &name = "ThreadPool (Task)");
     ~ThreadPool();
 
+    // Pin worker #i to cpus[i % size] (call before Start, empty = no pinning)
+    void SetCpuAffinity(std::vector<int> cpus)
+    {
+        _cpus = std::move(cpus);
+    }
+
     // Initialize and start workers
     void Start();
 
@@ -75,6 +81,7 @@ private:
     int _threadCount;
     std::string _name;
     std::vector<std::jthread> _threads;
+    std::vector<int> _cpus;
     std::atomic<bool> _stop{false};
 
     using TaskSemaphore = std::counting_semaphore<std::numeric_limits<std::ptrdiff_t>::max()>;
@@ -0,0 +1,119 @@
+#include "ServerProbe.h"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__linux__)
+#include <cstring>
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+static uint64_t ReadTracepointId()
+{
+    for (const char *path : {"/sys/kernel/tracing/events/raw_syscalls/sys_enter/id",
+                             "/sys/kernel/debug/tracing/events/raw_syscalls/sys_enter/id"})
+    {
+        std::ifstream file(path);
+        uint64_t id = 0;
+        if (file >> id)
+            return id;
+    }
+    return 0;
+}
+
+static int OpenSyscallCounter(uint64_t tracepointId, int tid)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_TRACEPOINT;
+    attr.size = sizeof(attr);
+    attr.config = tracepointId;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, tid, -1, -1, 0));
+}
+#endif
+
+ServerProbe::ServerProbe(int pid) : _pid(pid)
+{
+#if defined(__linux__)
+    if (pid <= 0)
+        return;
+
+    std::ifstream stat("/proc/" + std::to_string(pid) + "/stat");
+    _valid = stat.good();
+    if (!_valid)
+        return;
+
+    uint64_t tracepointId = ReadTracepointId();
+    if (tracepointId == 0)
+        return;
+
+    std::string taskDir = "/proc/" + std::to_string(pid) + "/task";
+    DIR *dir = opendir(taskDir.c_str());
+    if (!dir)
+        return;
+    while (dirent *entry = readdir(dir))
+    {
+        int tid = std::atoi(entry->d_name);
+        if (tid <= 0)
+            continue;
+        int fd = OpenSyscallCounter(tracepointId, tid);
+        if (fd >= 0)
+            _counterFds.push_back(fd);
+    }
+    closedir(dir);
+#endif
+}
+
+ServerProbe::~ServerProbe()
+{
+#if defined(__linux__)
+    for (int fd : _counterFds)
+        close(fd);
+#endif
+}
+
+ServerProbe::Sample ServerProbe::Read() const
+{
+    Sample sample;
+#if defined(__linux__)
+    if (!_valid)
+        return sample;
+
+    // Fields after "(comm)": state is field 3, utime/stime are fields 14/15
+    std::ifstream stat("/proc/" + std::to_string(_pid) + "/stat");
+    std::string line;
+    std::getline(stat, line);
+    size_t commEnd = line.rfind(')');
+    if (commEnd != std::string::npos)
+    {
+        std::istringstream fields(line.substr(commEnd + 2));
+        std::string field;
+        uint64_t utime = 0;
+        uint64_t stime = 0;
+        for (int index = 3; fields >> field; ++index)
+        {
+            if (index == 14)
+                utime = std::stoull(field);
+            else if (index == 15)
+            {
+                stime = std::stoull(field);
+                break;
+            }
+        }
+        sample.cpuSeconds = static_cast<double>(utime + stime) / static_cast<double>(sysconf(_SC_CLK_TCK));
+    }
+
+    for (int fd : _counterFds)
+    {
+        uint64_t count = 0;
+        if (read(fd, &count, sizeof(count)) == sizeof(count))
+            sample.syscalls += count;
+    }
+#endif
+    return sample;
+}
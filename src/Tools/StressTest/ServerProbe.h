@@ -0,0 +1,50 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 서버 프로세스 관측 (IO 백엔드 비교용: epoll vs io_uring)
+ *
+ * - CPU:      /proc/<pid>/stat 의 utime + stime
+ * - Syscalls: raw_syscalls:sys_enter tracepoint 를 서버의 각 스레드에 perf_event_open 으로 붙여 카운트
+ *             (perf_event_paranoid 권한이 없으면 CPU 만 측정)
+ *
+ * 스레드 목록은 생성 시점의 /proc/<pid>/task 기준이므로 서버 기동 완료 후에 만든다.
+ * Linux 전용이며, 그 외 플랫폼에서는 IsValid() == false.
+ */
+class ServerProbe
+{
+public:
+    struct Sample
+    {
+        double cpuSeconds = 0.0;
+        uint64_t syscalls = 0;
+    };
+
+    explicit ServerProbe(int pid);
+    ~ServerProbe();
+
+    ServerProbe(const ServerProbe &) = delete;
+    ServerProbe &operator=(const ServerProbe &) = delete;
+
+    bool IsValid() const
+    {
+        return _valid;
+    }
+    bool HasSyscallCounter() const
+    {
+        return !_counterFds.empty();
+    }
+    size_t GetThreadCount() const
+    {
+        return _counterFds.size();
+    }
+
+    Sample Read() const;
+
+private:
+    int _pid = 0;
+    bool _valid = false;
+    std::vector<int> _counterFds; // One per server thread
+};
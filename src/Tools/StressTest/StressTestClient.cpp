@@ -20,6 +20,9 @@ constexpr uint16_t C_PING = 902;
 constexpr uint16_t S_PONG = 903;
 } // namespace PacketID
 
+std::atomic<uint64_t> StressTestClient::s_packetsSent{0};
+std::atomic<uint64_t> StressTestClient::s_packetsRecv{0};
+
 StressTestClient::StressTestClient(boost::asio::io_context &io_context, int id)
     : _socket(io_context), _strand(io_context.get_executor()), _resolver(io_context), _id(id)
 {
@@ -145,6 +148,7 @@ void StressTestClient::SendPacket(uint16_t id, const google::protobuf::Message &
         key = cipher;
     }
 
+    s_packetsSent.fetch_add(1, std::memory_order_relaxed);
     boost::asio::post(
         _strand,
         [this, self = shared_from_this(), send_buffer = std::move(buffer)]() mutable
@@ -298,6 +302,7 @@ void StressTestClient::RecvLoop()
                         break;
 
                     // Handle Packet
+                    s_packetsRecv.fetch_add(1, std::memory_order_relaxed);
                     HandlePacket(
                         header->id,
                         &_recvBuffer[_readPos + sizeof(System::PacketHeader)],
@@ -54,6 +54,16 @@ public:
 
     void Update(); // Called periodically for Ping/Move
 
+    // [Stats] Packets across all clients (server backend comparison: syscalls / CPU per packet)
+    static uint64_t GetTotalPacketsSent()
+    {
+        return s_packetsSent.load(std::memory_order_relaxed);
+    }
+    static uint64_t GetTotalPacketsRecv()
+    {
+        return s_packetsRecv.load(std::memory_order_relaxed);
+    }
+
 private:
     void SendLogin();
     void SendCreateRoom();
@@ -92,4 +102,7 @@ private:
     // Stats
     size_t _readPos = 0;
     size_t _writePos = 0;
+
+    static std::atomic<uint64_t> s_packetsSent;
+    static std::atomic<uint64_t> s_packetsRecv;
 };
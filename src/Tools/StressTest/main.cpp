@@ -1,8 +1,12 @@
+#include "ServerProbe.h"
 #include "StressTestClient.h"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <iostream>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -18,6 +22,8 @@ int main(int argc, char *argv[])
         int clientCount = 100;
         int durationSec = 60;
         int targetRoomCount = 0;
+        int serverPid = 0;        // > 0: sample server CPU / syscalls (IO backend comparison)
+        std::string backendLabel; // Printed with the summary (e.g. "epoll", "io_uring")
 
         if (argc > 1)
             clientCount = std::stoi(argv[1]);
@@ -25,6 +31,10 @@ int main(int argc, char *argv[])
             durationSec = std::stoi(argv[2]);
         if (argc > 3)
             targetRoomCount = std::stoi(argv[3]);
+        if (argc > 4)
+            serverPid = std::stoi(argv[4]);
+        if (argc > 5)
+            backendLabel = argv[5];
 
         // 사용자가 명시하지 않은 경우, 클라이언트 수에 맞춰 방 개수 자동 조절 (최대 100개)
         if (targetRoomCount <= 0)
@@ -37,6 +47,8 @@ int main(int argc, char *argv[])
         std::cout << " Clients: " << clientCount << "\n";
         std::cout << " Duration: " << durationSec << "s\n";
         std::cout << " Target Rooms: " << targetRoomCount << "\n";
+        if (serverPid > 0)
+            std::cout << " Server PID: " << serverPid << " (" << backendLabel << ")\n";
         std::cout << "========================================\n";
 
         boost::asio::io_context io_context;
@@ -132,6 +144,20 @@ int main(int argc, char *argv[])
         }
         std::cout << "\n[Phase 2] All clients spawned.\n";
 
+        // [Backend Comparison] Probe attaches after startup so every server thread is counted
+        std::unique_ptr<ServerProbe> probe;
+        if (serverPid > 0)
+        {
+            probe = std::make_unique<ServerProbe>(serverPid);
+            if (!probe->IsValid())
+                std::cerr << "[Probe] Cannot read /proc/" << serverPid << ", server metrics disabled\n";
+            else if (!probe->HasSyscallCounter())
+                std::cerr << "[Probe] raw_syscalls tracepoint unavailable (perf_event_paranoid?), CPU only\n";
+        }
+        ServerProbe::Sample probeStart = probe ? probe->Read() : ServerProbe::Sample{};
+        uint64_t packetsStart = StressTestClient::GetTotalPacketsSent() + StressTestClient::GetTotalPacketsRecv();
+        int lastConnected = 0;
+
         // Monitor Loop
         auto startTime = std::chrono::steady_clock::now();
         while (true)
@@ -160,10 +186,35 @@ int main(int argc, char *argv[])
 
             std::cout << "[StressTest] Time: " << elapsed << "s | Con: " << connected << " | Room: " << inRoom
                       << " | ValidRooms: " << g_ValidRoomIds.size() << "\n";
+            lastConnected = connected;
 
             std::this_thread::sleep_for(std::chrono::seconds(1));
         }
 
+        // [Backend Comparison] Summary: server CPU per 10k CCU and syscalls per packet (client-side count)
+        if (probe && probe->IsValid())
+        {
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+            ServerProbe::Sample probeEnd = probe->Read();
+            uint64_t packets =
+                StressTestClient::GetTotalPacketsSent() + StressTestClient::GetTotalPacketsRecv() - packetsStart;
+            double cpuPerSec = (probeEnd.cpuSeconds - probeStart.cpuSeconds) / std::max(seconds, 1.0);
+            double ccuScale = lastConnected > 0 ? 10000.0 / lastConnected : 0.0;
+
+            std::cout << "========================================\n";
+            std::cout << " Backend: " << (backendLabel.empty() ? "(unlabeled)" : backendLabel) << "\n";
+            std::cout << " CCU: " << lastConnected << " | Packets: " << packets << "\n";
+            std::cout << " Server CPU: " << cpuPerSec * 100.0 << "% of a core | per 10k CCU: "
+                      << cpuPerSec * ccuScale * 100.0 << "%\n";
+            if (probe->HasSyscallCounter() && packets > 0)
+            {
+                uint64_t syscalls = probeEnd.syscalls - probeStart.syscalls;
+                std::cout << " Server Syscalls: " << syscalls << " (" << probe->GetThreadCount()
+                          << " threads) | per packet: " << static_cast<double>(syscalls) / packets << "\n";
+            }
+            std::cout << "========================================\n";
+        }
+
         // Cleanup
         std::cout << "Stopping clients...\n";
         for (const auto &c : creators)
@@ -14,9 +14,13 @@
  * @brief UDP AsyncSend 패스 검증을 위한 툴
  * UDPNetworkImpl::AsyncSend를 직접 호출하여 정상 크기 및 오버사이즈 드랍을 검증합니다.
  *
+ * throughput 모드는 속도 제한 없이(인플라이트 512) 보내고 pps / 송신 syscall 당 데이터그램 수를 출력합니다.
+ * --batch / --gso 로 sendmmsg 배치와 UDP GSO 를 비교할 수 있습니다 (Linux).
+ *
  * 사용법:
  *   UdpSpamClient.exe --mode asyncsend --payload 200 --count 50000 --dest 127.0.0.1:9999
  *   UdpSpamClient.exe --mode asyncsend --payload 1300 --count 10000 --dest 127.0.0.1:9999
+ *   UdpSpamClient --mode throughput --payload 200 --count 500000 --batch 32 --gso --dest 127.0.0.1:9999
  */
 int main(int argc, char *argv[])
 {
@@ -25,6 +29,8 @@ int main(int argc, char *argv[])
     uint16_t payloadSize = 200; // 기본: 정상 크기
     uint32_t sendCount = 50000; // 기본: 50000개 전송
     std::string destStr = "127.0.0.1:9999";
+    size_t batchSize = 0; // 0 = async_send_to per datagram
+    bool gso = false;
 
     // 커맨드라인 인자 파싱
     for (int i = 1; i < argc; ++i)
@@ -46,18 +52,29 @@ int main(int argc, char *argv[])
         {
             destStr = argv[++i];
         }
+        else if (arg == "--batch" && i + 1 < argc)
+        {
+            batchSize = static_cast<size_t>(std::stoul(argv[++i]));
+        }
+        else if (arg == "--gso")
+        {
+            gso = true;
+        }
         else if (arg == "--help")
         {
             std::cout << "Usage: UdpSpamClient.exe [options]\n"
                       << "Options:\n"
-                      << "  --mode <mode>      Execution mode (asyncsend, default: asyncsend)\n"
+                      << "  --mode <mode>      Execution mode (asyncsend, throughput, default: asyncsend)\n"
                       << "  --payload <bytes>   Payload size in bytes (default: 200)\n"
                       << "  --count <number>    Number of sends (default: 50000)\n"
                       << "  --dest <address>    Destination endpoint (default: 127.0.0.1:9999)\n"
+                      << "  --batch <n>         Datagrams per sendmmsg (Linux, default: 0 = off)\n"
+                      << "  --gso               UDP GSO for same-destination bursts (needs --batch)\n"
                       << "  --help              Show this help\n"
                       << "\nExamples:\n"
                       << "  UdpSpamClient.exe --mode asyncsend --payload 200 --count 50000 --dest 127.0.0.1:9999\n"
-                      << "  UdpSpamClient.exe --mode asyncsend --payload 1300 --count 10000 --dest 127.0.0.1:9999\n";
+                      << "  UdpSpamClient.exe --mode asyncsend --payload 1300 --count 10000 --dest 127.0.0.1:9999\n"
+                      << "  UdpSpamClient --mode throughput --payload 200 --count 500000 --batch 32 --gso\n";
             return 0;
         }
     }
@@ -77,10 +94,12 @@ int main(int argc, char *argv[])
               << "Payload: " << payloadSize << " bytes (max: " << System::UDP_MAX_APP_BYTES << ")\n"
               << "Count: " << sendCount << "\n"
               << "Destination: " << destStr << "\n"
+              << "Batch: " << batchSize << (gso ? " (GSO)" : "") << "\n"
               << std::endl;
 
-    if (mode == "asyncsend")
+    if (mode == "asyncsend" || mode == "throughput")
     {
+        const bool throughput = mode == "throughput";
         try
         {
             // MessagePool 초기화 (Small: 8192, Medium: 1024, Large: 256)
@@ -88,6 +107,7 @@ int main(int argc, char *argv[])
 
             boost::asio::io_context ioContext;
             System::UDPNetworkImpl udpNet(ioContext);
+            udpNet.SetBatching(batchSize, gso);
 
             // UDP 소켓 바인드 (ephemeral port: 0)
             if (!udpNet.Start(0))
@@ -101,6 +121,7 @@ int main(int argc, char *argv[])
             std::atomic<uint32_t> sentCount{0};
             std::atomic<uint32_t> failedCount{0};
             bool isOversize = payloadSize > System::UDP_MAX_APP_BYTES;
+            auto startTime = std::chrono::steady_clock::now();
 
             // 송신 스레드
             std::thread sendThread(
@@ -108,6 +129,12 @@ int main(int argc, char *argv[])
                 {
                     for (uint32_t i = 0; i < sendCount; ++i)
                     {
+                        // throughput: UDPSendContextPool(1024) 보다 적게 인플라이트 유지
+                        while (throughput && !isOversize && i - udpNet.GetSentCount() > 512)
+                        {
+                            std::this_thread::yield();
+                        }
+
                         // 패킷 할당 및 페이로드 채우기
                         auto *packet = System::MessagePool::AllocatePacket(payloadSize);
                         if (!packet)
@@ -134,7 +161,7 @@ int main(int argc, char *argv[])
                         sentCount++;
 
                         // 속도 제어 (선택적 - 과부하 방지)
-                        if (!isOversize && (i % 1000 == 0))
+                        if (!throughput && !isOversize && (i % 1000 == 0))
                         {
                             std::this_thread::sleep_for(std::chrono::milliseconds(1));
                         }
@@ -175,6 +202,12 @@ int main(int argc, char *argv[])
             // 송신 스레드 대기
             sendThread.join();
             std::cout << "\nSend thread finished. Waiting for completion..." << std::endl;
+            while (!isOversize && udpNet.GetSentCount() < sentCount.load() &&
+                   std::chrono::steady_clock::now() - startTime < std::chrono::seconds(10))
+            {
+                std::this_thread::yield();
+            }
+            double elapsedSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
 
             // 완료 대기 (최대 10초)
             statThread.join();
@@ -190,8 +223,18 @@ int main(int argc, char *argv[])
                       << "Sent: " << sentCount.load() << "\n"
                       << "Failed: " << failedCount.load() << "\n"
                       << "Oversize drops: " << oversizeDrops << "\n"
+                      << "Kernel sent: " << udpNet.GetSentCount() << "\n"
+                      << "Send syscalls: " << udpNet.GetSendCallCount() << "\n"
                       << std::endl;
 
+            if (throughput && udpNet.GetSendCallCount() > 0)
+            {
+                std::cout << "Throughput: " << static_cast<uint64_t>(udpNet.GetSentCount() / elapsedSec) << " pps ("
+                          << elapsedSec * 1000.0 << " ms), "
+                          << static_cast<double>(udpNet.GetSentCount()) / udpNet.GetSendCallCount()
+                          << " datagrams/syscall" << std::endl;
+            }
+
             // 검증
             if (isOversize)
             {
@@ -12,10 +12,10 @@
 class DbTestMockDispatcher : public System::IDispatcher
 {
 public:
-    void Push(std::function<void()> task) override
+    void Push(System::DispatchTask task) override
     {
         std::lock_guard<std::mutex> lock(_mutex);
-        _queue.push_back(task);
+        _queue.push_back(std::move(task));
         _cv.notify_one();
     }
 
@@ -49,7 +49,12 @@ public:
     {
     }
 
-    void WithSession(uint64_t sessionId, std::function<void(System::SessionContext &)> callback) override
+    void WithSession(uint64_t sessionId, System::SessionTask callback) override
+    {
+        // Not used in DB tests
+    }
+
+    void SendToSessions(std::span<const uint64_t> sessionIds, System::PacketPtr packet) override
     {
         // Not used in DB tests
     }
@@ -69,7 +74,7 @@ public:
 
         while (!_queue.empty())
         {
-            auto task = _queue.front();
+            auto task = std::move(_queue.front());
             _queue.pop_front();
             lock.unlock();
             task();
@@ -78,7 +83,7 @@ public:
     }
 
 private:
-    std::deque<std::function<void()>> _queue;
+    std::deque<System::DispatchTask> _queue;
     std::mutex _mutex;
     std::condition_variable _cv;
 };
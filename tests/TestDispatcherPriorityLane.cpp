@@ -0,0 +1,321 @@
+#include "System/Dispatcher/DISPATCHER/DispatcherImpl.h"
+#include "System/Dispatcher/MessagePool.h"
+#include "System/Dispatcher/SystemMessages.h"
+#include "System/ISession.h"
+#include "System/Packet/PacketHeader.h"
+#include "System/Session/SessionContext.h"
+#include <cstring>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace System;
+
+namespace {
+
+class NullLaneHandler : public IPacketHandler
+{
+public:
+    void HandlePacket(SessionContext ctx, PacketView packet) override
+    {
+    }
+};
+
+// Tick 이 처리되는 시점에 이미 실행된 Lambda Job 수를 기록
+class TickRecorder : public ITimerHandler
+{
+public:
+    explicit TickRecorder(const int &jobsDone) : _jobsDone(jobsDone)
+    {
+    }
+
+    void OnTimerExpired(uint64_t timerId) override
+    {
+    }
+    void OnTimerAdd(TimerAddMessage *msg) override
+    {
+    }
+    void OnTimerCancel(TimerCancelMessage *msg) override
+    {
+    }
+    void OnTick(TimerTickMessage *msg) override
+    {
+        jobsBeforeTick.push_back(_jobsDone);
+    }
+
+    std::vector<int> jobsBeforeTick;
+
+private:
+    const int &_jobsDone;
+};
+
+// 최소 세션 (Connect/Data/Disconnect 순서 검증용)
+class LaneTestSession : public ISession
+{
+public:
+    explicit LaneTestSession(uint64_t id) : _id(id)
+    {
+    }
+
+    void SendPacket(const IPacket &pkt) override
+    {
+    }
+    void SendPacket(PacketPtr msg) override
+    {
+    }
+    void SendReliable(const IPacket &pkt) override
+    {
+    }
+    void SendUnreliable(const IPacket &pkt) override
+    {
+    }
+    void SendPreSerialized(const PacketMessage *msg) override
+    {
+    }
+    void Close() override
+    {
+    }
+    uint64_t GetId() const override
+    {
+        return _id;
+    }
+    void Reset() override
+    {
+    }
+    bool CanDestroy() const override
+    {
+        return false;
+    }
+    void OnConnect() override
+    {
+    }
+    void OnDisconnect() override
+    {
+    }
+    bool IsConnected() const override
+    {
+        return true;
+    }
+    void IncRef() override
+    {
+    }
+    void DecRef() override
+    {
+    }
+
+private:
+    uint64_t _id;
+};
+
+// Records each lifecycle step and whether the dispatcher already knew the session at that point
+class LifecycleRecorder : public IPacketHandler
+{
+public:
+    explicit LifecycleRecorder(IDispatcher *&dispatcher) : _dispatcher(dispatcher)
+    {
+    }
+
+    void HandlePacket(SessionContext ctx, PacketView packet) override
+    {
+        events.push_back(Registered(ctx.Id()) ? "data" : "data-unregistered");
+    }
+    void OnSessionDisconnect(SessionContext ctx) override
+    {
+        events.push_back("disconnect");
+    }
+
+    bool Registered(uint64_t sessionId) const
+    {
+        bool found = false;
+        _dispatcher->WithSession(
+            sessionId,
+            [&found](SessionContext &)
+            {
+                found = true;
+            }
+        );
+        return found;
+    }
+
+    std::vector<std::string> events;
+
+private:
+    IDispatcher *&_dispatcher;
+};
+
+// Posts CONNECT / DATA / DISCONNECT back-to-back from a High lane handler, i.e. between the High drain
+// and the Normal slice, the window an IO thread can hit at any time
+class LifecyclePoster : public ITimerHandler
+{
+public:
+    LifecyclePoster(IDispatcher &dispatcher, ISession *session) : _dispatcher(dispatcher), _session(session)
+    {
+    }
+
+    void OnTimerExpired(uint64_t timerId) override
+    {
+    }
+    void OnTimerAdd(TimerAddMessage *msg) override
+    {
+    }
+    void OnTimerCancel(TimerCancelMessage *msg) override
+    {
+    }
+    void OnTick(TimerTickMessage *msg) override
+    {
+        Post(MessageType::NETWORK_CONNECT);
+
+        PacketMessage *data = MessagePool::AllocatePacket(sizeof(PacketHeader));
+        std::memset(data->Payload(), 0, sizeof(PacketHeader));
+        data->type = MessageType::NETWORK_DATA;
+        data->sessionId = _session->GetId();
+        data->session = _session;
+        _dispatcher.Post(data);
+
+        Post(MessageType::NETWORK_DISCONNECT);
+    }
+
+private:
+    void Post(MessageType type)
+    {
+        EventMessage *msg = MessagePool::AllocateEvent();
+        msg->type = type;
+        msg->sessionId = _session->GetId();
+        msg->session = _session;
+        _dispatcher.Post(msg);
+    }
+
+    IDispatcher &_dispatcher;
+    ISession *_session;
+};
+
+} // namespace
+
+class DispatcherPriorityLaneTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        MessagePool::Prepare(1000, 10, 10);
+    }
+};
+
+TEST_F(DispatcherPriorityLaneTest, TimerTickOvertakesPacketFlood)
+{
+    DispatcherImpl dispatcher(std::make_shared<NullLaneHandler>());
+    int jobsDone = 0;
+    TickRecorder recorder(jobsDone);
+    dispatcher.RegisterTimerHandler(&recorder);
+
+    constexpr int FLOOD = 2000;
+    for (int i = 0; i < FLOOD; ++i)
+    {
+        dispatcher.Push(
+            [&jobsDone]()
+            {
+                ++jobsDone;
+            }
+        );
+    }
+
+    // Tick enqueued behind the flood
+    dispatcher.Post(MessagePool::AllocateTimerTick());
+
+    EXPECT_EQ(dispatcher.GetQueueSize(DispatchLane::High), 1u);
+    EXPECT_EQ(dispatcher.GetQueueSize(DispatchLane::Normal), static_cast<size_t>(FLOOD));
+    EXPECT_EQ(dispatcher.GetQueueSize(), static_cast<size_t>(FLOOD + 1));
+
+    while (dispatcher.Process())
+    {
+    }
+
+    ASSERT_EQ(recorder.jobsBeforeTick.size(), 1u);
+    EXPECT_EQ(recorder.jobsBeforeTick[0], 0); // High lane drained first
+    EXPECT_EQ(jobsDone, FLOOD);
+}
+
+TEST_F(DispatcherPriorityLaneTest, TickArrivingMidFloodWaitsAtMostOneSlice)
+{
+    DispatcherImpl dispatcher(std::make_shared<NullLaneHandler>());
+    int jobsDone = 0;
+    TickRecorder recorder(jobsDone);
+    dispatcher.RegisterTimerHandler(&recorder);
+
+    constexpr int FLOOD = 2000;
+    for (int i = 0; i < FLOOD; ++i)
+    {
+        dispatcher.Push(
+            [&dispatcher, &jobsDone]()
+            {
+                // The 5th job schedules a tick while the Normal slice is still running
+                if (++jobsDone == 5)
+                    dispatcher.Post(MessagePool::AllocateTimerTick());
+            }
+        );
+    }
+
+    while (dispatcher.Process())
+    {
+    }
+
+    ASSERT_EQ(recorder.jobsBeforeTick.size(), 1u);
+    EXPECT_LE(recorder.jobsBeforeTick[0], static_cast<int>(DispatcherImpl::NORMAL_SLICE));
+}
+
+// A disconnect must not overtake the session's already-queued packets and jobs
+TEST_F(DispatcherPriorityLaneTest, DisconnectStaysBehindSessionTraffic)
+{
+    EXPECT_EQ(LaneOf(MessageType::NETWORK_DISCONNECT), LaneOf(MessageType::NETWORK_DATA));
+    EXPECT_EQ(LaneOf(MessageType::NETWORK_DISCONNECT), LaneOf(MessageType::NETWORK_DATA_REF));
+    EXPECT_EQ(LaneOf(MessageType::NETWORK_DISCONNECT), LaneOf(MessageType::SESSION_JOB));
+    EXPECT_EQ(LaneOf(MessageType::NETWORK_DISCONNECT), LaneOf(MessageType::SESSION_MULTICAST));
+    EXPECT_EQ(LaneOf(MessageType::NETWORK_DISCONNECT), LaneOf(MessageType::NETWORK_CONNECT));
+}
+
+// A connect -> data -> disconnect burst is handled in order; the session id does not outlive the disconnect
+TEST_F(DispatcherPriorityLaneTest, ConnectDataDisconnectKeepOrder)
+{
+    IDispatcher *self = nullptr;
+    auto recorder = std::make_shared<LifecycleRecorder>(self);
+    DispatcherImpl dispatcher(recorder);
+    self = &dispatcher;
+
+    LaneTestSession session(42);
+    LifecyclePoster poster(dispatcher, &session);
+    dispatcher.RegisterTimerHandler(&poster);
+    dispatcher.Post(MessagePool::AllocateTimerTick());
+
+    while (dispatcher.Process())
+    {
+    }
+
+    EXPECT_EQ(recorder->events, (std::vector<std::string>{"data", "disconnect"}));
+    EXPECT_FALSE(recorder->Registered(session.GetId())); // No stale entry left for a reused session to inherit
+}
+
+TEST_F(DispatcherPriorityLaneTest, OverloadIsTrackedPerLane)
+{
+    DispatcherImpl dispatcher(std::make_shared<NullLaneHandler>());
+
+    for (size_t i = 0; i <= DispatcherImpl::HIGH_WATER; ++i)
+    {
+        dispatcher.Push(
+            []()
+            {
+            }
+        );
+    }
+
+    EXPECT_TRUE(dispatcher.IsOverloaded(DispatchLane::Normal));
+    EXPECT_FALSE(dispatcher.IsOverloaded(DispatchLane::High));
+    EXPECT_TRUE(dispatcher.IsRecovered(DispatchLane::High));
+    EXPECT_TRUE(dispatcher.IsOverloaded());
+    EXPECT_FALSE(dispatcher.IsRecovered());
+
+    while (dispatcher.Process())
+    {
+    }
+
+    EXPECT_FALSE(dispatcher.IsOverloaded());
+    EXPECT_TRUE(dispatcher.IsRecovered());
+}
@@ -18,8 +18,9 @@ public:
     MOCK_METHOD(void, Wait, (int), (override));
 
     // Target Method
-    MOCK_METHOD(void, Push, (std::function<void()>), (override));
-    MOCK_METHOD(void, WithSession, (uint64_t, std::function<void(System::SessionContext &)>), (override));
+    MOCK_METHOD(void, Push, (System::DispatchTask), (override));
+    MOCK_METHOD(void, WithSession, (uint64_t, System::SessionTask), (override));
+    MOCK_METHOD(void, SendToSessions, (std::span<const uint64_t>, System::PacketPtr), (override));
     MOCK_METHOD(void, Shutdown, (), (override));
 };
 
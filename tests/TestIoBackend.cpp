@@ -0,0 +1,47 @@
+#include "System/Network/IoBackend.h"
+#include "System/Network/RecvBuffer.h"
+#include <gtest/gtest.h>
+
+using namespace System;
+
+TEST(IoBackendTest, ParseAndResolve)
+{
+    EXPECT_EQ(ParseIoBackend("io_uring"), IoBackend::IoUring);
+    EXPECT_EQ(ParseIoBackend("epoll"), IoBackend::Epoll);
+    EXPECT_EQ(ParseIoBackend("unknown"), IoBackend::Epoll);
+    EXPECT_STREQ(ToString(IoBackend::IoUring), "io_uring");
+
+    // The reactor is fixed at compile time: any request resolves to the compiled backend
+    EXPECT_EQ(ResolveIoBackend("io_uring"), GetCompiledIoBackend());
+    EXPECT_EQ(ResolveIoBackend("epoll"), GetCompiledIoBackend());
+}
+
+// Arena blocks are handed out by the shared pool and always come back to it (never freed)
+TEST(IoBackendTest, RecvBufferArenaBlocksArePooled)
+{
+    RecvBuffer::ReserveArena(4);
+    ASSERT_NE(RecvBuffer::GetArenaBase(), nullptr);
+    const size_t arenaBlocks = RecvBuffer::GetArenaBlockCount();
+    ASSERT_GE(arenaBlocks, 1u);
+    EXPECT_FALSE(RecvBuffer::ReserveArena(4)); // Once per process
+
+    EXPECT_EQ(RecvBuffer::ArenaIndexOf(RecvBuffer::GetArenaBase()), 0);
+    EXPECT_EQ(RecvBuffer::ArenaIndexOf(nullptr), -1);
+    uint8_t heapByte = 0;
+    EXPECT_EQ(RecvBuffer::ArenaIndexOf(&heapByte), -1);
+
+    // Enough buffers to drain any heap blocks parked ahead of the arena
+    const size_t count = RecvBuffer::GetPooledBlockCount();
+    std::vector<RecvBuffer> buffers(count);
+    size_t fromArena = 0;
+    for (RecvBuffer &buffer : buffers)
+    {
+        buffer.Attach();
+        if (RecvBuffer::ArenaIndexOf(buffer.BlockBase()) >= 0)
+            ++fromArena;
+    }
+    EXPECT_EQ(fromArena, arenaBlocks);
+
+    buffers.clear();
+    EXPECT_GE(RecvBuffer::GetPooledBlockCount(), arenaBlocks);
+}
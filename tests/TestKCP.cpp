@@ -1,8 +1,12 @@
 #include "System/Session/UDP/KCPAdapter.h"
 #include "System/Session/UDP/IKCPWrapper.h"
 #include "System/Session/UDP/KCPWrapper.h"
+#include "System/Dispatcher/IDispatcher.h"
+#include "System/Dispatcher/IMessage.h"
+#include "System/Dispatcher/MessagePool.h"
 #include "System/Pch.h"
 #include <gtest/gtest.h>
+#include <cstring>
 #include <memory>
 #include <random>
 #include <vector>
@@ -15,9 +19,15 @@ namespace System {
 class KCPTestMockDispatcher : public IDispatcher
 {
 public:
+    ~KCPTestMockDispatcher() override
+    {
+        for (IMessage *msg : _receivedMessages)
+            MessagePool::Free(msg);
+    }
+
     void Post(IMessage *msg) override
     {
-        // Just record the message, don't delete it
+        // Record the message; it is returned to the pool when the mock goes away
         _receivedMessages.push_back(msg);
     }
 
@@ -27,7 +37,9 @@ public:
     bool IsOverloaded() const override { return false; }
     bool IsRecovered() const override { return true; }
     void RegisterTimerHandler(ITimerHandler *) override {}
-    void WithSession(uint64_t, std::function<void(SessionContext &)>) override {}
+    void WithSession(uint64_t, SessionTask) override {}
+    void SendToSessions(std::span<const uint64_t>, PacketPtr) override {}
+    void Push(DispatchTask) override {}
     void Shutdown() override {}
 
 private:
@@ -93,25 +105,45 @@ TEST_F(KCPTest, KCPAdapterSendAndRecv)
 TEST_F(KCPTest, KCPAdapterInputAndRecv)
 {
     uint32_t conv = 67890;
+    auto sender = std::make_unique<KCPAdapter>(conv);
     auto kcp = std::make_unique<KCPAdapter>(conv);
 
+    // Input only accepts real KCP segments, so take them from a peer with the same conv
+    std::vector<std::vector<char>> segments;
+    sender->SetOutputCallback([&segments](const char *buf, int len) {
+        segments.emplace_back(buf, buf + len);
+        return len;
+    });
+
     const char* testData = "Test data from client";
     int testDataLength = static_cast<int>(std::strlen(testData));
 
+    ASSERT_GE(sender->Send(testData, testDataLength), 0);
+    uint32_t current = static_cast<uint32_t>(std::chrono::system_clock::now().time_since_epoch().count() / 1000000);
+    sender->Update(current);
+    ASSERT_FALSE(segments.empty());
+
+    // Garbage is rejected
+    EXPECT_LT(kcp->Input(testData, testDataLength), 0);
+
     // Input data
-    int inputResult = kcp->Input(testData, testDataLength);
-    EXPECT_GE(inputResult, 0);
+    for (const auto &segment : segments)
+    {
+        int inputResult = kcp->Input(segment.data(), static_cast<int>(segment.size()));
+        EXPECT_GE(inputResult, 0);
+    }
 
     // Update to process
-    uint32_t current = static_cast<uint32_t>(std::chrono::system_clock::now().time_since_epoch().count() / 1000000);
     kcp->Update(current);
 
     // Try to receive
     std::vector<uint8_t> recvBuffer(1024);
     int recvLength = kcp->Recv(recvBuffer.data(), static_cast<int>(recvBuffer.size()));
-    EXPECT_LE(recvLength, testDataLength);
+    ASSERT_EQ(recvLength, testDataLength);
+    EXPECT_EQ(std::memcmp(recvBuffer.data(), testData, testDataLength), 0);
 
     kcp.reset();
+    sender.reset();
 }
 
 TEST_F(KCPTest, KCPAdapterMultipleSends)
@@ -135,10 +167,10 @@ TEST_F(KCPTest, KCPAdapterMultipleSends)
     kcp->Update(current);
     kcp->Update(current);
 
-    // Try to receive
+    // Nothing was input, so the receive queue is empty (ikcp_recv returns < 0)
     std::vector<uint8_t> recvBuffer(1024);
     int recvLength = kcp->Recv(recvBuffer.data(), static_cast<int>(recvBuffer.size()));
-    EXPECT_GE(recvLength, 0);
+    EXPECT_LT(recvLength, 0);
 
     kcp.reset();
 }
@@ -275,9 +307,9 @@ TEST_F(KCPTest, KCPWrapperEmptyData)
 
     kcpWrapper->Initialize(conv);
 
-    // Send empty data
+    // Send empty data (rejected: the wrapper only queues 1..1024 byte payloads)
     int sent = kcpWrapper->Send("", 0);
-    EXPECT_GE(sent, 0);
+    EXPECT_LT(sent, 0);
 
     // Update
     uint32_t current = static_cast<uint32_t>(std::chrono::system_clock::now().time_since_epoch().count() / 1000000);
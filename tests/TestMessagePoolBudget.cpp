@@ -0,0 +1,108 @@
+#include "System/Dispatcher/MessagePool.h"
+#include "System/Metrics/IMetrics.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace System;
+
+// MessagePool Memory Budget
+// - Soft limit: Optional 할당만 거부
+// - Hard limit: Pool 확장 / Heap 폴백 거부 (이미 캐시된 블록 재사용은 허용), Critical 은 항상 허용
+
+class MessagePoolBudgetTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        MessagePool::Prepare(1000, 10, 10);
+    }
+
+    void TearDown() override
+    {
+        MessagePool::SetMemoryBudget(0, 0);
+    }
+};
+
+TEST_F(MessagePoolBudgetTest, UnlimitedByDefault)
+{
+    EXPECT_FALSE(MessagePool::IsOverSoftLimit());
+    EXPECT_FALSE(MessagePool::IsOverHardLimit());
+
+    PacketMessage *msg = MessagePool::AllocatePacket(64, AllocPriority::Optional);
+    ASSERT_NE(msg, nullptr);
+    MessagePool::Free(msg);
+}
+
+TEST_F(MessagePoolBudgetTest, SoftLimitShedsOptionalTrafficOnly)
+{
+    auto shed = GetMetrics().GetCounter("msgpool_budget_shed_optional");
+    const uint64_t before = shed->GetValue();
+
+    // Already at the limit -> over soft, hard unlimited
+    MessagePool::SetMemoryBudget(MessagePool::GetInUseBytes(), 0);
+    EXPECT_TRUE(MessagePool::IsOverSoftLimit());
+    EXPECT_FALSE(MessagePool::IsOverHardLimit());
+
+    EXPECT_EQ(MessagePool::AllocatePacket(64, AllocPriority::Optional), nullptr);
+    EXPECT_TRUE(MessagePool::ShouldShedOptional());
+
+    PacketMessage *normal = MessagePool::AllocatePacket(64);
+    ASSERT_NE(normal, nullptr);
+    MessagePool::Free(normal);
+
+    EXPECT_EQ(shed->GetValue() - before, 2u);
+    EXPECT_EQ(GetMetrics().GetGauge("msgpool_budget_state")->GetValue(), 1);
+}
+
+TEST_F(MessagePoolBudgetTest, HardLimitRefusesGrowthButNotCriticalTraffic)
+{
+    auto reject = GetMetrics().GetCounter("msgpool_budget_reject");
+    const uint64_t before = reject->GetValue();
+
+    MessagePool::SetMemoryBudget(MessagePool::GetInUseBytes(), MessagePool::GetInUseBytes());
+    EXPECT_TRUE(MessagePool::IsOverHardLimit());
+    EXPECT_EQ(GetMetrics().GetGauge("msgpool_budget_state")->GetValue(), 2);
+
+    // Heap fallback is refused for normal traffic, allowed for critical traffic
+    EXPECT_EQ(MessagePool::AllocatePacket(20000), nullptr);
+    PacketMessage *big = MessagePool::AllocatePacket(20000, AllocPriority::Critical);
+    ASSERT_NE(big, nullptr);
+    MessagePool::Free(big);
+
+    // Cached / depot blocks are still handed out, but the pool stops carving new ones
+    const size_t slabBytes = MessagePool::GetSlabBytes();
+    std::vector<PacketMessage *> held;
+    PacketMessage *msg = nullptr;
+    while ((msg = MessagePool::AllocatePacket(64)) != nullptr)
+        held.push_back(msg);
+
+    EXPECT_EQ(MessagePool::GetSlabBytes(), slabBytes);
+    EXPECT_GT(reject->GetValue() - before, 1u);
+
+    PacketMessage *critical = MessagePool::AllocatePacket(64, AllocPriority::Critical);
+    ASSERT_NE(critical, nullptr);
+    held.push_back(critical);
+
+    for (PacketMessage *p : held)
+        MessagePool::Free(p);
+}
+
+TEST_F(MessagePoolBudgetTest, HeapFallbackIsAccounted)
+{
+    const size_t heapBefore = MessagePool::GetHeapBytes();
+    const size_t inUseBefore = MessagePool::GetInUseBytes();
+    const uint64_t heapCounterBefore = GetMetrics().GetCounter("msgpool_heap_bytes")->GetValue();
+
+    PacketMessage *big = MessagePool::AllocatePacket(20000);
+    ASSERT_NE(big, nullptr);
+    const size_t allocSize = PacketMessage::CalculateAllocSize(20000);
+    EXPECT_EQ(MessagePool::GetHeapBytes() - heapBefore, allocSize);
+    EXPECT_EQ(MessagePool::GetInUseBytes() - inUseBefore, allocSize);
+    // msgpool_heap_bytes counts the same quantity as the live heap gauge
+    EXPECT_EQ(GetMetrics().GetCounter("msgpool_heap_bytes")->GetValue() - heapCounterBefore, allocSize);
+    EXPECT_EQ(big->heapSize, allocSize);
+
+    big->length = 10; // Owner may shrink the payload; accounting uses the allocation size
+    MessagePool::Free(big);
+    EXPECT_EQ(MessagePool::GetHeapBytes(), heapBefore);
+}
@@ -1,7 +1,17 @@
 #include "System/Dispatcher/MessagePool.h"
+#include "System/Dispatcher/SystemMessages.h"
+#include "System/Metrics/IMetrics.h"
+#include <chrono>
 #include <gtest/gtest.h>
+#include <iostream>
+#include <thread>
 #include <vector>
 
+#if defined(__linux__)
+#include <fstream>
+#include <unistd.h>
+#endif
+
 using namespace System;
 
 class MessagePoolExpansionTest : public ::testing::Test
@@ -65,3 +75,162 @@ TEST_F(MessagePoolExpansionTest, LambdaAllocation)
     EXPECT_FALSE(msg->isPooled);
     MessagePool::Free(msg); // delete msg가 내부에서 호출되어야 함
 }
+
+TEST_F(MessagePoolExpansionTest, CrossThreadFreesReturnThroughDepot)
+{
+    // IO 스레드 할당 -> 로직 스레드 해제 패턴: 블록은 Magazine 단위로 Depot 을 거쳐 돌아와야 한다
+    const size_t COUNT = MessagePool::MAGAZINE_SIZE * 4;
+    auto crossFree = GetMetrics().GetCounter("msgpool_cross_thread_free_64b");
+    auto depotHit = GetMetrics().GetCounter("msgpool_depot_hit_64b");
+    const uint64_t crossBefore = crossFree->GetValue();
+
+    std::vector<PacketMessage *> packets;
+    std::thread producer(
+        [&]()
+        {
+            for (size_t i = 0; i < COUNT; ++i)
+            {
+                PacketMessage *msg = MessagePool::AllocatePacket(64);
+                ASSERT_NE(msg, nullptr);
+                packets.push_back(msg);
+            }
+        }
+    );
+    producer.join();
+
+    std::thread consumer(
+        [&]()
+        {
+            for (PacketMessage *msg : packets)
+            {
+                MessagePool::Free(msg);
+            }
+        }
+    ); // Thread exit flushes its magazines and counters to the depot
+    consumer.join();
+
+    EXPECT_EQ(crossFree->GetValue() - crossBefore, COUNT);
+
+    const uint64_t hitBefore = depotHit->GetValue();
+    const int poolBefore = MessagePool::GetPoolSize();
+    std::thread reuser(
+        [&]()
+        {
+            PacketMessage *msg = MessagePool::AllocatePacket(64);
+            ASSERT_NE(msg, nullptr);
+            MessagePool::Free(msg);
+        }
+    );
+    reuser.join();
+
+    EXPECT_EQ(depotHit->GetValue() - hitBefore, 1u);
+    EXPECT_EQ(MessagePool::GetPoolSize(), poolBefore); // Magazine went out and came back on thread exit
+}
+
+TEST_F(MessagePoolExpansionTest, PrepareAfterClearReusesSlabs)
+{
+    // SetUp already prepared this budget: repeated Prepare/Clear cycles must not carve new slabs
+    MessagePool::Prepare(100, 100, 100);
+    const size_t slabBytes = MessagePool::GetSlabBytes();
+
+    for (int cycle = 0; cycle < 5; ++cycle)
+    {
+        std::vector<PacketMessage *> held;
+        for (int i = 0; i < 50; ++i)
+            held.push_back(MessagePool::AllocatePacket(512));
+        for (PacketMessage *msg : held)
+            MessagePool::Free(msg);
+
+        MessagePool::Clear();
+        MessagePool::Prepare(100, 100, 100);
+    }
+
+    EXPECT_EQ(MessagePool::GetSlabBytes(), slabBytes);
+}
+
+TEST_F(MessagePoolExpansionTest, SmallPacketsUseSmallClasses)
+{
+    EXPECT_EQ(MessagePool::ClassOfBody(1), 0u);
+    EXPECT_EQ(MessagePool::ClassOfBody(40), 0u); // C_MOVE_INPUT
+    EXPECT_EQ(MessagePool::ClassOfBody(64), 0u);
+    EXPECT_EQ(MessagePool::ClassOfBody(65), 1u);
+    EXPECT_EQ(MessagePool::ClassOfBody(1024), 4u);
+    EXPECT_EQ(MessagePool::ClassOfBody(16384), MessagePool::PACKET_CLASS_COUNT - 1);
+    EXPECT_EQ(MessagePool::ClassOfBody(16385), MessagePool::PACKET_CLASS_COUNT);
+
+    PacketMessage *tiny = MessagePool::AllocatePacket(40);
+    ASSERT_NE(tiny, nullptr);
+    EXPECT_EQ(tiny->sizeLevel, 0);
+    EXPECT_LE(MessagePool::ClassBlockSize(tiny->sizeLevel), 128u);
+    MessagePool::Free(tiny);
+
+    // Timer / Event messages must fit the class they are carved from
+    auto *tick = MessagePool::AllocateTimerTick();
+    ASSERT_NE(tick, nullptr);
+    EXPECT_LT(tick->sizeLevel, MessagePool::PACKET_CLASS_COUNT);
+    MessagePool::Free(tick);
+}
+
+#if defined(__linux__)
+namespace {
+
+size_t ReadRssBytes()
+{
+    std::ifstream statm("/proc/self/statm");
+    size_t pages = 0, resident = 0;
+    if (!(statm >> pages >> resident))
+        return 0;
+    return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+} // namespace
+#endif
+
+// 클래스별 RSS 증가량 / Alloc 처리량 리포트 (Linux /proc 기준)
+TEST_F(MessagePoolExpansionTest, PerClassRssAndThroughputReport)
+{
+#if !defined(__linux__)
+    GTEST_SKIP() << "RSS is read from /proc/self/statm (Linux only)";
+#else
+    constexpr size_t LIVE_BLOCKS = 4096;
+    constexpr int ROUNDS = 50;
+
+    for (size_t level = 0; level < MessagePool::PACKET_CLASS_COUNT; ++level)
+    {
+        const uint16_t bodySize = static_cast<uint16_t>(MessagePool::ClassBodySize(level));
+        std::vector<PacketMessage *> live;
+        live.reserve(LIVE_BLOCKS);
+
+        const size_t rssBefore = ReadRssBytes();
+        for (size_t i = 0; i < LIVE_BLOCKS; ++i)
+        {
+            PacketMessage *msg = MessagePool::AllocatePacket(bodySize);
+            ASSERT_NE(msg, nullptr);
+            ASSERT_EQ(msg->sizeLevel, level);
+            std::memset(msg->Payload(), 0x5A, bodySize); // Touch pages
+            live.push_back(msg);
+        }
+        const size_t rssAfter = ReadRssBytes();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < ROUNDS; ++r)
+        {
+            for (PacketMessage *&msg : live)
+            {
+                MessagePool::Free(msg);
+                msg = MessagePool::AllocatePacket(bodySize);
+            }
+        }
+        auto elapsed = std::chrono::high_resolution_clock::now() - start;
+
+        for (PacketMessage *msg : live)
+            MessagePool::Free(msg);
+
+        double seconds = std::chrono::duration<double>(elapsed).count();
+        double allocsPerSec = (static_cast<double>(LIVE_BLOCKS) * ROUNDS) / seconds;
+        std::cout << "[MessagePool] class " << bodySize << "B: block " << MessagePool::ClassBlockSize(level)
+                  << "B, RSS +" << (rssAfter > rssBefore ? (rssAfter - rssBefore) / 1024 : 0) << "KB for "
+                  << LIVE_BLOCKS << " blocks, " << static_cast<uint64_t>(allocsPerSec) << " allocs/sec" << std::endl;
+    }
+#endif
+}
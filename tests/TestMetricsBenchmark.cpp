@@ -0,0 +1,109 @@
+#include "System/Dispatcher/MessagePool.h"
+#include "System/Metrics/IMetrics.h"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace System;
+
+// AllocatePacket 의 Metric 비용 비교 (4 스레드 Alloc/Free 루프)
+// - Legacy: 할당마다 GetMetrics().GetCounter(name) (mutex + map 조회 + shared_ptr 복사)
+// - Handle: CounterHandle (스레드 샤드 슬롯 relaxed fetch_add) -> 현재 AllocatePacket 구현
+
+class MetricsBenchmark : public ::testing::Test
+{
+protected:
+    static constexpr int THREAD_COUNT = 4;
+    static constexpr int ALLOCS_PER_THREAD = 200000;
+
+    void SetUp() override
+    {
+        MessagePool::Prepare(1000, 10, 10);
+    }
+
+    template <typename Fn> double MeasureAllocsPerSec(Fn body)
+    {
+        std::atomic<bool> go{false};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREAD_COUNT; ++t)
+        {
+            threads.emplace_back(
+                [&]()
+                {
+                    while (!go.load())
+                    {
+                        std::this_thread::yield();
+                    }
+                    for (int i = 0; i < ALLOCS_PER_THREAD; ++i)
+                    {
+                        body();
+                    }
+                }
+            );
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        go.store(true);
+        for (auto &t : threads)
+            t.join();
+        auto elapsed = std::chrono::high_resolution_clock::now() - start;
+
+        double seconds = std::chrono::duration<double>(elapsed).count();
+        return (static_cast<double>(THREAD_COUNT) * ALLOCS_PER_THREAD) / seconds;
+    }
+};
+
+TEST_F(MetricsBenchmark, AllocatePacketLegacyLookupVsHandle)
+{
+    double legacy = MeasureAllocsPerSec(
+        []()
+        {
+            // 기존 AllocatePacket 의 Metric 경로 재현
+            GetMetrics().GetCounter("msgpool_alloc_64b_legacy")->Increment();
+            MessagePool::Free(MessagePool::AllocatePacket(64));
+        }
+    );
+
+    double handle = MeasureAllocsPerSec(
+        []()
+        {
+            MessagePool::Free(MessagePool::AllocatePacket(64));
+        }
+    );
+
+    std::cout << "[AllocatePacket] legacy lookup: " << static_cast<uint64_t>(legacy)
+              << " allocs/sec, handle: " << static_cast<uint64_t>(handle) << " allocs/sec" << std::endl;
+
+    EXPECT_GE(GetMetrics().GetCounter("msgpool_alloc_64b")->GetValue(),
+              static_cast<uint64_t>(THREAD_COUNT) * ALLOCS_PER_THREAD);
+}
+
+TEST_F(MetricsBenchmark, HandleAndLookupShareTheSameCounter)
+{
+    CounterHandle handle("metrics_test_shared");
+    auto counter = GetMetrics().GetCounter("metrics_test_shared");
+    const uint64_t before = counter->GetValue();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREAD_COUNT; ++t)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    handle.Increment();
+                    counter->Increment();
+                }
+            }
+        );
+    }
+    for (auto &t : threads)
+        t.join();
+
+    EXPECT_EQ(counter->GetValue() - before, static_cast<uint64_t>(THREAD_COUNT) * 2000);
+    EXPECT_EQ(handle.GetValue(), counter->GetValue());
+}
@@ -0,0 +1,140 @@
+#include "System/Dispatcher/MessagePool.h"
+#include "System/Thread/CpuTopology.h"
+#include <atomic>
+#include <chrono>
+#include <concurrentqueue/moodycamel/concurrentqueue.h>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace System;
+
+TEST(CpuTopologyTest, ParseCpuList)
+{
+    EXPECT_EQ(ParseCpuList("0-3,8"), (std::vector<int>{0, 1, 2, 3, 8}));
+    EXPECT_EQ(ParseCpuList(" 5, 2-2 ,5\n"), (std::vector<int>{2, 5}));
+    EXPECT_TRUE(ParseCpuList("").empty());
+    EXPECT_EQ(ParseCpuList("x,3-1,4"), (std::vector<int>{4}));
+}
+
+TEST(CpuTopologyTest, CurrentThreadMapsToAKnownNode)
+{
+    ASSERT_GE(CpuTopology::GetNodeCount(), 1);
+    int node = CpuTopology::GetCurrentNode();
+    EXPECT_GE(node, 0);
+    EXPECT_LT(node, CpuTopology::GetNodeCount());
+    EXPECT_FALSE(CpuTopology::GetCpusOfNode(node).empty());
+
+    // Locality off -> every pool uses node 0
+    EXPECT_EQ(CpuTopology::GetPoolNodeCount(), 1u);
+    EXPECT_EQ(CpuTopology::GetCurrentPoolNode(), 0u);
+}
+
+TEST(CpuTopologyTest, PinCurrentThread)
+{
+    std::thread(
+        []()
+        {
+            int cpu = CpuTopology::GetCurrentCpu();
+            EXPECT_FALSE(CpuTopology::PinCurrentThread({}));
+#if defined(__linux__) || defined(_WIN32)
+            EXPECT_TRUE(CpuTopology::PinCurrentThread({cpu}));
+            EXPECT_EQ(CpuTopology::GetCurrentCpu(), cpu);
+#endif
+        }
+    ).join();
+}
+
+// Blocks carved on another node go back to that node's depot, never into the freeing thread's cache
+TEST(NumaLocalityTest, RemoteFreesReturnToHomeNodeDepot)
+{
+    MessagePool::Prepare(1000, 10, 10);
+
+    std::vector<PacketMessage *> packets;
+    for (size_t i = 0; i < MessagePool::MAGAZINE_SIZE; ++i)
+    {
+        PacketMessage *msg = MessagePool::AllocatePacket(64);
+        ASSERT_NE(msg, nullptr);
+        EXPECT_EQ(msg->homeNode, 0);
+        msg->homeNode = 1; // Pretend the block came from node 1
+        packets.push_back(msg);
+    }
+
+    const int before = MessagePool::GetPoolSize();
+    for (PacketMessage *msg : packets)
+        MessagePool::Free(msg);
+
+    // One full remote magazine handed to node 1's depot
+    EXPECT_EQ(MessagePool::GetPoolSize() - before, static_cast<int>(MessagePool::MAGAZINE_SIZE));
+}
+
+// IO -> Logic packet hand-off (alloc on one thread, free on another), locality off vs on.
+// 의미 있는 비교는 멀티 소켓 장비에서:
+//   numactl --cpunodebind=0 --membind=1 ./UnitTests --gtest_filter=NumaBenchmark.*   (remote memory)
+//   numactl --cpunodebind=0 --membind=0 ./UnitTests --gtest_filter=NumaBenchmark.*   (local memory)
+// Producer 는 첫 노드, Consumer 는 마지막 노드의 첫 CPU 에 고정된다 (단일 노드면 같은 노드).
+TEST(NumaBenchmark, CrossThreadPacketHandoff)
+{
+    constexpr int PACKETS = 500000;
+    constexpr uint16_t BODY = 256;
+
+    const std::vector<int> producerCpus = CpuTopology::GetCpusOfNode(0);
+    const std::vector<int> consumerCpus = CpuTopology::GetCpusOfNode(CpuTopology::GetNodeCount() - 1);
+
+    auto Run = [&]() -> double
+    {
+        moodycamel::ConcurrentQueue<PacketMessage *> queue;
+        std::atomic<bool> done{false};
+        auto start = std::chrono::high_resolution_clock::now();
+
+        std::thread consumer(
+            [&]()
+            {
+                CpuTopology::PinCurrentThread({consumerCpus.front()});
+                int received = 0;
+                PacketMessage *msg = nullptr;
+                while (received < PACKETS)
+                {
+                    if (queue.try_dequeue(msg))
+                    {
+                        msg->Payload()[0] ^= 1; // Touch the payload like a handler would
+                        MessagePool::Free(msg);
+                        ++received;
+                    }
+                }
+                done.store(true);
+            }
+        );
+        std::thread producer(
+            [&]()
+            {
+                CpuTopology::PinCurrentThread({producerCpus.front()});
+                for (int i = 0; i < PACKETS; ++i)
+                {
+                    PacketMessage *msg = MessagePool::AllocatePacket(BODY);
+                    msg->Payload()[0] = static_cast<uint8_t>(i);
+                    queue.enqueue(msg);
+                }
+            }
+        );
+
+        producer.join();
+        consumer.join();
+        EXPECT_TRUE(done.load());
+
+        double seconds =
+            std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        return PACKETS / seconds;
+    };
+
+    double shared = Run();
+    CpuTopology::SetPoolLocality(true);
+    double local = Run();
+    CpuTopology::SetPoolLocality(false);
+
+    CpuTopology::LogTopology();
+    std::cout << "[NUMA] nodes: " << CpuTopology::GetNodeCount() << ", producer CPU " << producerCpus.front()
+              << " -> consumer CPU " << consumerCpus.front() << " | shared pools: " << static_cast<uint64_t>(shared)
+              << " pkt/s, node-local pools: " << static_cast<uint64_t>(local) << " pkt/s" << std::endl;
+}
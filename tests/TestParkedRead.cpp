@@ -0,0 +1,109 @@
+#include "System/Dispatcher/DISPATCHER/DispatcherImpl.h"
+#include "System/Dispatcher/MessagePool.h"
+#include "System/Network/RecvBuffer.h"
+#include "System/Packet/PacketHeader.h"
+#include "System/Session/GatewaySession.h"
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace System;
+using boost::asio::ip::tcp;
+
+namespace {
+
+class CountingHandler : public IPacketHandler
+{
+public:
+    void HandlePacket(SessionContext ctx, PacketView packet) override
+    {
+        ++count;
+        lastId = packet.GetId();
+    }
+
+    int count = 0;
+    uint16_t lastId = 0;
+};
+
+std::vector<uint8_t> MakeFrame(uint16_t id, uint16_t bodySize)
+{
+    std::vector<uint8_t> frame(sizeof(PacketHeader) + bodySize, 0x5A);
+    PacketHeader header{static_cast<uint16_t>(frame.size()), id};
+    std::memcpy(frame.data(), &header, sizeof(header));
+    return frame;
+}
+
+bool PollUntil(boost::asio::io_context &io, const std::function<bool()> &done)
+{
+    for (int i = 0; i < 200; ++i)
+    {
+        io.poll();
+        io.restart();
+        if (done())
+            return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return false;
+}
+
+} // namespace
+
+// Idle parked session: no receive block. Complete frames are framed straight out of the
+// per-thread scratch; only a partial frame borrows a block, which goes back once it completes.
+TEST(ParkedReadTest, OnlyPartialFramesBorrowAReceiveBlock)
+{
+    MessagePool::Prepare(1000, 10, 10);
+
+    boost::asio::io_context io;
+    tcp::acceptor acceptor(io, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    auto serverSocket = std::make_shared<tcp::socket>(io);
+    tcp::socket client(io);
+    client.connect(acceptor.local_endpoint());
+    acceptor.accept(*serverSocket);
+
+    auto handler = std::make_shared<CountingHandler>();
+    DispatcherImpl dispatcher(handler);
+    const size_t baseline = RecvBuffer::GetAttachedBlockCount();
+
+    auto *session = new GatewaySession();
+    session->Reset(serverSocket, 1, &dispatcher);
+    session->SetParkIdleReads(true);
+    session->OnConnect();
+    io.poll();
+    io.restart();
+    EXPECT_EQ(RecvBuffer::GetAttachedBlockCount(), baseline);
+
+    std::vector<uint8_t> first = MakeFrame(7, 100);
+    std::vector<uint8_t> second = MakeFrame(8, 300);
+    std::vector<uint8_t> stream = first;
+    stream.insert(stream.end(), second.begin(), second.end());
+
+    // Frame 1 complete + 10 bytes of frame 2
+    const size_t split = first.size() + 10;
+    boost::asio::write(client, boost::asio::buffer(stream.data(), split));
+    ASSERT_TRUE(PollUntil(io, [&]() { return RecvBuffer::GetAttachedBlockCount() == baseline + 1; }));
+    while (dispatcher.Process())
+    {
+    }
+    EXPECT_EQ(handler->count, 1);
+    EXPECT_EQ(handler->lastId, 7);
+
+    // Rest of frame 2 -> block released, session parked again
+    boost::asio::write(client, boost::asio::buffer(stream.data() + split, stream.size() - split));
+    ASSERT_TRUE(PollUntil(io, [&]() { return RecvBuffer::GetAttachedBlockCount() == baseline; }));
+    while (dispatcher.Process())
+    {
+    }
+    EXPECT_EQ(handler->count, 2);
+    EXPECT_EQ(handler->lastId, 8);
+
+    session->Close();
+    io.poll();
+    while (dispatcher.Process())
+    {
+    }
+}
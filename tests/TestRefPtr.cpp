@@ -1,6 +1,8 @@
 #include "System/Memory/RefCounted.h"
 #include "System/Memory/RefPtr.h"
+#include "System/Thread/StrandContext.h"
 #include <gtest/gtest.h>
+#include <thread>
 
 namespace System {
 namespace Testing {
@@ -133,5 +135,116 @@ TEST_F(RefPtrTest, ResetAndDetach)
     delete raw;
 }
 
+// Strand-confined entity: non-atomic count
+class LocalEntity : public RefCounted<LocalEntity, StrandLocalRefCount>
+{
+public:
+    int returned = 0;
+
+    void ReturnToPool()
+    {
+        ++returned;
+    }
+};
+
+TEST_F(RefPtrTest, StrandLocalPolicyCounts)
+{
+    static_assert(LocalEntity::IS_STRAND_LOCAL);
+    static_assert(!MockEntity::IS_STRAND_LOCAL);
+    // Atomic policy pays nothing for the local state
+    struct PlainCounted
+    {
+        virtual ~PlainCounted() = default;
+        std::atomic<uint32_t> count;
+    };
+    static_assert(sizeof(RefCounted<MockEntity>) == sizeof(PlainCounted));
+
+    LocalEntity entity;
+    EXPECT_FALSE(entity.IsSharedAcrossThreads());
+    {
+        RefPtr<LocalEntity> a(&entity);
+        RefPtr<LocalEntity> b = a;
+        EXPECT_EQ(entity.GetRefCount(), 2u);
+        RefPtr<LocalEntity> c = std::move(b);
+        EXPECT_EQ(entity.GetRefCount(), 2u);
+    }
+    EXPECT_EQ(entity.GetRefCount(), 0u);
+    EXPECT_EQ(entity.returned, 1);
+}
+
+TEST_F(RefPtrTest, StrandLocalSharedInstanceUsesAtomics)
+{
+    LocalEntity entity;
+    entity.ShareAcrossThreads();
+    RefPtr<LocalEntity> root(&entity);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for (int i = 0; i < 10000; ++i)
+                {
+                    RefPtr<LocalEntity> copy = root;
+                }
+            }
+        );
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_EQ(entity.GetRefCount(), 1u);
+    EXPECT_EQ(entity.returned, 0);
+}
+
+TEST_F(RefPtrTest, StrandContextTokenFollowsStrandNotThread)
+{
+    int strand = 0;
+    const uintptr_t threadToken = StrandContext::OwnerToken();
+    uintptr_t inside = 0;
+    {
+        StrandContext::Scope scope(&strand);
+        inside = StrandContext::OwnerToken();
+        EXPECT_EQ(StrandContext::Current(), &strand);
+    }
+    EXPECT_EQ(StrandContext::Current(), nullptr);
+    EXPECT_EQ(StrandContext::OwnerToken(), threadToken);
+
+    // Same strand on another pool thread -> same owner
+    std::thread(
+        [&]()
+        {
+            StrandContext::Scope scope(&strand);
+            EXPECT_EQ(StrandContext::OwnerToken(), inside);
+        }
+    ).join();
+}
+
+#ifndef NDEBUG
+TEST_F(RefPtrTest, StrandLocalDebugOwnerAssertion)
+{
+    LocalEntity entity;
+    RefPtr<LocalEntity> owner(&entity);
+
+    EXPECT_DEATH(
+        {
+            std::thread([&]() { RefPtr<LocalEntity> copy = owner; }).join();
+        },
+        "outside its owning strand"
+    );
+
+    // Explicit hand-off is allowed
+    std::thread(
+        [&]()
+        {
+            entity.TransferOwnership();
+            RefPtr<LocalEntity> copy = owner;
+        }
+    ).join();
+    entity.TransferOwnership();
+}
+#endif
+
 } // namespace Testing
 } // namespace System
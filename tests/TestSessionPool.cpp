@@ -0,0 +1,120 @@
+#include "System/Network/RecvBuffer.h"
+#include "System/Session/SessionPool.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace System;
+
+namespace {
+
+struct FakeSession
+{
+    static inline std::atomic<int> s_constructed{0};
+
+    FakeSession()
+    {
+        s_constructed.fetch_add(1);
+    }
+};
+
+bool WaitUntilIdle(SessionPoolBase<FakeSession> &pool)
+{
+    for (int i = 0; i < 500 && pool.IsGrowing(); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    return !pool.IsGrowing();
+}
+
+} // namespace
+
+TEST(RecvBufferTest, NoStorageUntilAttach)
+{
+    const size_t before = RecvBuffer::GetAttachedBlockCount();
+    RecvBuffer buffer;
+    EXPECT_FALSE(buffer.IsAttached());
+    EXPECT_EQ(buffer.FreeSize(), 0);
+    EXPECT_EQ(RecvBuffer::GetAttachedBlockCount(), before);
+
+    buffer.Attach();
+    EXPECT_TRUE(buffer.IsAttached());
+    EXPECT_EQ(buffer.FreeSize(), RecvBuffer::DEFAULT_CAPACITY);
+    EXPECT_EQ(RecvBuffer::GetAttachedBlockCount(), before + 1);
+
+    buffer.Reset();
+    EXPECT_FALSE(buffer.IsAttached());
+    EXPECT_EQ(RecvBuffer::GetAttachedBlockCount(), before);
+}
+
+TEST(RecvBufferTest, DetachedBlockIsReusedFromSharedPool)
+{
+    RecvBuffer a;
+    a.Attach();
+    uint8_t *block = a.WritePos();
+    std::memset(block, 0xAB, 16);
+    ASSERT_TRUE(a.MoveWritePos(16));
+    ASSERT_TRUE(a.MoveReadPos(16));
+    a.Detach();
+
+    const size_t pooled = RecvBuffer::GetPooledBlockCount();
+    ASSERT_GE(pooled, 1u);
+
+    RecvBuffer b;
+    b.Attach();
+    EXPECT_EQ(RecvBuffer::GetPooledBlockCount(), pooled - 1);
+    EXPECT_EQ(b.DataSize(), 0);
+    b.Reset();
+}
+
+TEST(RecvBufferTest, PendingDataSurvivesCompaction)
+{
+    RecvBuffer buffer(64);
+    buffer.Attach();
+    ASSERT_TRUE(buffer.MoveWritePos(60));
+    std::memcpy(buffer.ReadPos() + 50, "0123456789", 10);
+    ASSERT_TRUE(buffer.MoveReadPos(50));
+
+    buffer.Clean(); // FreeSize 4 < COMPACT_THRESHOLD -> memmove to front
+    EXPECT_EQ(buffer.DataSize(), 10);
+    EXPECT_EQ(std::memcmp(buffer.ReadPos(), "0123456789", 10), 0);
+    EXPECT_EQ(buffer.FreeSize(), 54);
+}
+
+TEST(SessionPoolTest, WarmUpSeedsSynchronouslyAndFillsInBackground)
+{
+    SessionPoolBase<FakeSession> pool;
+    pool.WarmUp(5000); // 6000 sessions
+
+    ASSERT_TRUE(WaitUntilIdle(pool));
+    EXPECT_EQ(pool.GetTotalAllocated(), 6000u);
+    EXPECT_EQ(pool.GetAvailableCount(), 6000u);
+}
+
+TEST(SessionPoolTest, EmptyPoolNeverBlocksOnBatchGrowth)
+{
+    SessionPoolBase<FakeSession> pool;
+    const int before = FakeSession::s_constructed.load();
+
+    // Cold pool: exactly one inline construction, the batch is left to the grower
+    FakeSession *session = pool.Acquire();
+    ASSERT_NE(session, nullptr);
+
+    ASSERT_TRUE(WaitUntilIdle(pool));
+    EXPECT_EQ(pool.GetTotalAllocated(), 1u + SessionPoolBase<FakeSession>::DEFAULT_GROWTH_SIZE);
+    EXPECT_EQ(FakeSession::s_constructed.load() - before, 1 + static_cast<int>(pool.GetAvailableCount()));
+
+    pool.Release(session);
+    EXPECT_EQ(pool.GetAvailableCount(), pool.GetTotalAllocated());
+}
+
+TEST(SessionPoolTest, ClearStopsBackgroundGrower)
+{
+    SessionPoolBase<FakeSession> pool;
+    pool.WarmUp(200000);
+    pool.Clear(); // Joins the grower; nothing may be enqueued afterwards
+
+    EXPECT_FALSE(pool.IsGrowing());
+    EXPECT_EQ(pool.GetTotalAllocated(), 0u);
+    EXPECT_EQ(pool.GetAvailableCount(), 0u);
+}
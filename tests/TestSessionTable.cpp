@@ -0,0 +1,173 @@
+#include "System/Dispatcher/DISPATCHER/SessionTable.h"
+#include "System/Session/SessionHandleAllocator.h"
+#include <chrono>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace System;
+
+namespace {
+
+// SessionTable 은 포인터만 보관하므로 더미 주소로 충분
+ISession *FakeSession(size_t i)
+{
+    return reinterpret_cast<ISession *>(static_cast<uintptr_t>(0x1000 + i * 16));
+}
+
+} // namespace
+
+TEST(SessionHandleAllocatorTest, FirstGenerationIdsAreSequential)
+{
+    SessionHandleAllocator handles;
+    EXPECT_EQ(handles.Allocate(), 1ULL);
+    EXPECT_EQ(handles.Allocate(), 2ULL);
+    EXPECT_EQ(handles.Allocate(), 3ULL);
+}
+
+TEST(SessionHandleAllocatorTest, ReleasedSlotIsReusedWithNewVersion)
+{
+    SessionHandleAllocator handles;
+    uint64_t first = handles.Allocate();
+    handles.Release(first);
+    handles.Release(first); // Duplicate release ignored
+
+    uint64_t second = handles.Allocate();
+    EXPECT_EQ(SessionHandle::GetSlot(second), SessionHandle::GetSlot(first));
+    EXPECT_EQ(SessionHandle::GetVersion(second), SessionHandle::GetVersion(first) + 1);
+    EXPECT_NE(handles.Allocate(), second);
+    EXPECT_EQ(handles.GetSlotCount(), 2u);
+}
+
+TEST(SessionTableTest, StaleIdIsRejectedAfterSlotReuse)
+{
+    SessionHandleAllocator handles;
+    SessionTable table;
+
+    uint64_t oldId = handles.Allocate();
+    table.Add(oldId, FakeSession(1));
+    EXPECT_EQ(table.Find(oldId), FakeSession(1));
+
+    table.Remove(oldId);
+    handles.Release(oldId);
+
+    uint64_t newId = handles.Allocate();
+    table.Add(newId, FakeSession(2));
+
+    EXPECT_EQ(table.Find(oldId), nullptr);
+    EXPECT_EQ(table.Find(newId), FakeSession(2));
+    EXPECT_EQ(table.Size(), 1u);
+
+    // Stale Remove must not evict the new owner
+    table.Remove(oldId);
+    EXPECT_EQ(table.Find(newId), FakeSession(2));
+}
+
+TEST(SessionTableTest, ForeignIdsFallBackToOverflow)
+{
+    SessionTable table;
+    uint64_t huge = SessionHandle::Make(0, SessionTable::MAX_DENSE_SLOTS + 5);
+    uint64_t collide = SessionHandle::Make(7, 3);
+
+    table.Add(3, FakeSession(3));
+    table.Add(collide, FakeSession(4)); // Same slot, different version, both live
+    table.Add(huge, FakeSession(5));
+
+    EXPECT_EQ(table.Find(3), FakeSession(3));
+    EXPECT_EQ(table.Find(collide), FakeSession(4));
+    EXPECT_EQ(table.Find(huge), FakeSession(5));
+    EXPECT_EQ(table.Size(), 3u);
+
+    table.Remove(collide);
+    table.Remove(huge);
+    EXPECT_EQ(table.Find(collide), nullptr);
+    EXPECT_EQ(table.Find(3), FakeSession(3));
+    EXPECT_EQ(table.Size(), 1u);
+}
+
+// 10k CCU Connect/Disconnect Churn + WithSession 조회 비용 비교 (기존 unordered_map vs SessionTable)
+TEST(SessionTableBenchmark, ConnectDisconnectChurn10kCcu)
+{
+    constexpr size_t CCU = 10000;
+    constexpr int ROUNDS = 200;
+    constexpr size_t CHURN_PER_ROUND = 500;
+    constexpr size_t LOOKUPS_PER_ROUND = 20000;
+
+    auto Run = [&](auto &&add, auto &&remove, auto &&find) -> std::pair<long long, size_t>
+    {
+        SessionHandleAllocator handles;
+        std::vector<uint64_t> live;
+        live.reserve(CCU);
+        for (size_t i = 0; i < CCU; ++i)
+        {
+            live.push_back(handles.Allocate());
+            add(live.back(), FakeSession(i));
+        }
+
+        std::mt19937 rng(42);
+        size_t hits = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for (int round = 0; round < ROUNDS; ++round)
+        {
+            for (size_t c = 0; c < CHURN_PER_ROUND; ++c)
+            {
+                size_t victim = rng() % live.size();
+                remove(live[victim]);
+                handles.Release(live[victim]);
+                live[victim] = handles.Allocate();
+                add(live[victim], FakeSession(victim));
+            }
+            for (size_t l = 0; l < LOOKUPS_PER_ROUND; ++l)
+            {
+                if (find(live[rng() % live.size()]) != nullptr)
+                    ++hits;
+            }
+        }
+
+        auto elapsed = std::chrono::high_resolution_clock::now() - start;
+        return {std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(), hits};
+    };
+
+    std::unordered_map<uint64_t, ISession *> map;
+    auto [mapUs, mapHits] = Run(
+        [&](uint64_t id, ISession *s)
+        {
+            map[id] = s;
+        },
+        [&](uint64_t id)
+        {
+            map.erase(id);
+        },
+        [&](uint64_t id) -> ISession *
+        {
+            auto it = map.find(id);
+            return it != map.end() ? it->second : nullptr;
+        }
+    );
+
+    SessionTable table;
+    auto [tableUs, tableHits] = Run(
+        [&](uint64_t id, ISession *s)
+        {
+            table.Add(id, s);
+        },
+        [&](uint64_t id)
+        {
+            table.Remove(id);
+        },
+        [&](uint64_t id)
+        {
+            return table.Find(id);
+        }
+    );
+
+    const size_t expected = static_cast<size_t>(ROUNDS) * LOOKUPS_PER_ROUND;
+    EXPECT_EQ(mapHits, expected);
+    EXPECT_EQ(tableHits, expected);
+    EXPECT_EQ(table.Size(), CCU);
+
+    std::cout << "[SessionTable] unordered_map: " << mapUs << " us, SessionTable: " << tableUs << " us" << std::endl;
+}
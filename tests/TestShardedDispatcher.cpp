@@ -0,0 +1,360 @@
+#include "System/Dispatcher/DISPATCHER/ShardedDispatcherImpl.h"
+#include "System/Dispatcher/MessagePool.h"
+#include "System/ISession.h"
+#include "System/Session/SessionContext.h"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace System;
+
+namespace {
+
+class NullPacketHandler : public IPacketHandler
+{
+public:
+    void HandlePacket(SessionContext ctx, PacketView packet) override
+    {
+    }
+};
+
+// 최소 세션 (Dispatcher 라우팅 검증용)
+class ShardTestSession : public ISession
+{
+public:
+    explicit ShardTestSession(uint64_t id) : _id(id)
+    {
+    }
+
+    void SendPacket(const IPacket &pkt) override
+    {
+    }
+    void SendPacket(PacketPtr msg) override
+    {
+        _sent.fetch_add(1, std::memory_order_relaxed);
+    }
+    void SendReliable(const IPacket &pkt) override
+    {
+    }
+    void SendUnreliable(const IPacket &pkt) override
+    {
+    }
+    void SendPreSerialized(const PacketMessage *msg) override
+    {
+    }
+    void Close() override
+    {
+    }
+    uint64_t GetId() const override
+    {
+        return _id;
+    }
+    void Reset() override
+    {
+    }
+    bool CanDestroy() const override
+    {
+        return false;
+    }
+    void OnConnect() override
+    {
+    }
+    void OnDisconnect() override
+    {
+    }
+    bool IsConnected() const override
+    {
+        return true;
+    }
+    void IncRef() override
+    {
+        _ref.fetch_add(1, std::memory_order_relaxed);
+    }
+    void DecRef() override
+    {
+        _ref.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    int GetSentCount() const
+    {
+        return _sent.load(std::memory_order_relaxed);
+    }
+
+private:
+    uint64_t _id;
+    std::atomic<int> _ref{0};
+    std::atomic<int> _sent{0};
+};
+
+void PostConnect(IDispatcher &dispatcher, ISession *session)
+{
+    EventMessage *msg = MessagePool::AllocateEvent();
+    msg->type = MessageType::NETWORK_CONNECT;
+    msg->sessionId = session->GetId();
+    msg->session = session;
+    session->IncRef();
+    dispatcher.Post(msg);
+}
+
+} // namespace
+
+class ShardedDispatcherTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        MessagePool::Prepare(10000, 100, 10);
+    }
+};
+
+TEST_F(ShardedDispatcherTest, SessionAffinityKeepsOrderAndThread)
+{
+    constexpr size_t SHARDS = 4;
+    constexpr int SESSIONS = 16;
+    constexpr int JOBS_PER_SESSION = 1000;
+
+    ShardedDispatcherImpl dispatcher(std::make_shared<NullPacketHandler>(), SHARDS);
+
+    std::vector<std::unique_ptr<ShardTestSession>> sessions;
+    for (int i = 0; i < SESSIONS; ++i)
+    {
+        sessions.push_back(std::make_unique<ShardTestSession>(i + 1));
+        PostConnect(dispatcher, sessions.back().get());
+    }
+
+    // Per-session state is only touched by the owning shard thread -> no lock needed
+    std::vector<int> lastSeq(SESSIONS + 1, -1);
+    std::vector<std::thread::id> owner(SESSIONS + 1);
+    std::atomic<int> outOfOrder{0};
+    std::atomic<int> threadHops{0};
+    std::atomic<int> executed{0};
+
+    std::atomic<bool> running{true};
+    std::thread mainLoop(
+        [&]()
+        {
+            while (running)
+            {
+                if (!dispatcher.Process())
+                    dispatcher.Wait(1);
+            }
+        }
+    );
+
+    for (int seq = 0; seq < JOBS_PER_SESSION; ++seq)
+    {
+        for (int i = 1; i <= SESSIONS; ++i)
+        {
+            dispatcher.WithSession(
+                static_cast<uint64_t>(i),
+                [&, i, seq](SessionContext &ctx)
+                {
+                    if (lastSeq[i] + 1 != seq)
+                        outOfOrder.fetch_add(1);
+                    lastSeq[i] = seq;
+
+                    if (owner[i] == std::thread::id())
+                        owner[i] = std::this_thread::get_id();
+                    else if (owner[i] != std::this_thread::get_id())
+                        threadHops.fetch_add(1);
+
+                    executed.fetch_add(1);
+                }
+            );
+        }
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (executed.load() < SESSIONS * JOBS_PER_SESSION && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    running = false;
+    mainLoop.join();
+    dispatcher.Shutdown();
+
+    EXPECT_EQ(executed.load(), SESSIONS * JOBS_PER_SESSION);
+    EXPECT_EQ(outOfOrder.load(), 0);
+    EXPECT_EQ(threadHops.load(), 0);
+
+    // 세션들이 실제로 여러 샤드 스레드에 분산되었는지 확인
+    std::set<std::thread::id> distinctOwners(owner.begin() + 1, owner.end());
+    EXPECT_EQ(distinctOwners.size(), SHARDS);
+}
+
+TEST_F(ShardedDispatcherTest, SessionlessPushRunsOnMainShard)
+{
+    ShardedDispatcherImpl dispatcher(std::make_shared<NullPacketHandler>(), 4);
+
+    std::thread::id pushThread;
+    dispatcher.Push(
+        [&]()
+        {
+            pushThread = std::this_thread::get_id();
+        }
+    );
+
+    // Shard 0 is driven by the caller of Process()
+    while (!dispatcher.Process())
+    {
+    }
+
+    EXPECT_EQ(pushThread, std::this_thread::get_id());
+    EXPECT_EQ(dispatcher.GetShardCount(), 4u);
+}
+
+TEST_F(ShardedDispatcherTest, SendToSessionsReachesEachRecipientOnce)
+{
+    constexpr size_t SHARDS = 4;
+    constexpr int SESSIONS = 16;
+    constexpr int PACKETS = 10;
+
+    ShardedDispatcherImpl dispatcher(std::make_shared<NullPacketHandler>(), SHARDS);
+
+    std::vector<std::unique_ptr<ShardTestSession>> sessions;
+    std::vector<uint64_t> recipients;
+    for (int i = 0; i < SESSIONS; ++i)
+    {
+        sessions.push_back(std::make_unique<ShardTestSession>(i + 1));
+        PostConnect(dispatcher, sessions.back().get());
+        recipients.push_back(static_cast<uint64_t>(i + 1));
+    }
+    recipients.push_back(999); // Unknown session is skipped
+
+    std::atomic<bool> running{true};
+    std::thread mainLoop(
+        [&]()
+        {
+            while (running)
+            {
+                if (!dispatcher.Process())
+                    dispatcher.Wait(1);
+            }
+        }
+    );
+
+    PacketPtr packet(MessagePool::AllocatePacket(16));
+    for (int i = 0; i < PACKETS; ++i)
+    {
+        dispatcher.SendToSessions(recipients, packet);
+    }
+
+    auto totalSent = [&]()
+    {
+        int total = 0;
+        for (const auto &s : sessions)
+            total += s->GetSentCount();
+        return total;
+    };
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (totalSent() < SESSIONS * PACKETS && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    running = false;
+    mainLoop.join();
+    dispatcher.Shutdown();
+
+    for (const auto &s : sessions)
+    {
+        EXPECT_EQ(s->GetSentCount(), PACKETS) << "session " << s->GetId();
+    }
+
+    // Every multicast message released its reference; only ours remains
+    EXPECT_EQ(packet->refCount.load(), 1);
+}
+
+// A multicast dropped before fan-out (queue full, shutdown) still returns its packet reference
+TEST_F(ShardedDispatcherTest, UndispatchedMulticastReleasesPacket)
+{
+    PacketPtr packet(MessagePool::AllocatePacket(16));
+    MulticastMessage *msg = MessagePool::AllocateMulticast(2);
+    ASSERT_NE(msg, nullptr);
+    msg->packet = PacketPtr(packet).Release();
+    EXPECT_EQ(packet->refCount.load(), 2);
+
+    MessagePool::Free(msg);
+    EXPECT_EQ(packet->refCount.load(), 1);
+}
+
+TEST_F(ShardedDispatcherTest, ShardedLoadTest)
+{
+    constexpr size_t SHARDS = 4;
+    constexpr int SESSIONS = 64;
+    constexpr int messageCount = 200000;
+    constexpr int producerCount = 4;
+
+    ShardedDispatcherImpl dispatcher(std::make_shared<NullPacketHandler>(), SHARDS);
+
+    std::vector<std::unique_ptr<ShardTestSession>> sessions;
+    for (int i = 0; i < SESSIONS; ++i)
+    {
+        sessions.push_back(std::make_unique<ShardTestSession>(i + 1));
+        PostConnect(dispatcher, sessions.back().get());
+    }
+
+    std::atomic<int> executed{0};
+    std::atomic<bool> running{true};
+    std::thread mainLoop(
+        [&]()
+        {
+            while (running)
+            {
+                if (!dispatcher.Process())
+                    dispatcher.Wait(1);
+            }
+        }
+    );
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producerCount; ++p)
+    {
+        producers.emplace_back(
+            [&, p]()
+            {
+                for (int i = 0; i < messageCount / producerCount; ++i)
+                {
+                    uint64_t sid = static_cast<uint64_t>((i + p) % SESSIONS) + 1;
+                    dispatcher.WithSession(
+                        sid,
+                        [&](SessionContext &ctx)
+                        {
+                            executed.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    );
+                }
+            }
+        );
+    }
+
+    for (auto &t : producers)
+        t.join();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (executed.load() < messageCount && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+    running = false;
+    mainLoop.join();
+    dispatcher.Shutdown();
+
+    EXPECT_EQ(executed.load(), messageCount);
+    std::cout << "[Dispatcher] [Sharded x" << SHARDS << "] Processed " << messageCount << " messages in " << duration
+              << "ms" << std::endl;
+}
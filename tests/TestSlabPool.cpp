@@ -0,0 +1,138 @@
+#include "System/Memory/RefCounted.h"
+#include "System/Memory/RefPtr.h"
+#include "System/Memory/SlabPool.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace System {
+namespace Testing {
+
+class SlabEntity : public RefCounted<SlabEntity, StrandLocalRefCount>, public SlabPooled<SlabEntity>
+{
+public:
+    static inline int s_destroyed = 0;
+
+    int value = 0;
+    int resets = 0;
+
+    ~SlabEntity() override
+    {
+        ++s_destroyed;
+    }
+
+    void Reset()
+    {
+        value = 0;
+        ++resets;
+    }
+
+    void ReturnToPool()
+    {
+        if (!ReturnToSlab())
+            delete this;
+    }
+};
+
+using SmallPool = SlabPool<SlabEntity, 4>;
+
+TEST(SlabPoolTest, ObjectsAreContiguousWithinAChunk)
+{
+    SmallPool pool;
+    std::vector<RefPtr<SlabEntity>> held;
+    for (int i = 0; i < 10; ++i)
+        held.push_back(pool.Pop());
+
+    EXPECT_EQ(pool.GetLiveCount(), 10u);
+    EXPECT_EQ(pool.GetChunkCount(), 3u);
+    EXPECT_EQ(pool.GetCapacity(), 12u);
+    for (int i = 1; i < 4; ++i)
+    {
+        auto *prev = reinterpret_cast<std::byte *>(held[i - 1].get());
+        auto *curr = reinterpret_cast<std::byte *>(held[i].get());
+        EXPECT_EQ(curr - prev, static_cast<std::ptrdiff_t>(sizeof(SlabEntity)));
+    }
+    EXPECT_TRUE(held[0]->IsSlabAllocated());
+}
+
+TEST(SlabPoolTest, IterationSkipsFreedSlotsAndReuseIsLifo)
+{
+    SmallPool pool;
+    std::vector<RefPtr<SlabEntity>> held;
+    for (int i = 0; i < 8; ++i)
+    {
+        held.push_back(pool.Pop());
+        held.back()->value = i;
+    }
+
+    SlabEntity *freed = held[5].get();
+    held[2].reset();
+    held[5].reset();
+    EXPECT_EQ(pool.GetLiveCount(), 6u);
+
+    int count = 0;
+    int sum = 0;
+    for (SlabEntity &entity : pool)
+    {
+        ++count;
+        sum += entity.value;
+    }
+    EXPECT_EQ(count, 6);
+    EXPECT_EQ(sum, 28 - 2 - 5);
+
+    // Last freed slot comes back first, reset
+    RefPtr<SlabEntity> reused = pool.Pop();
+    EXPECT_EQ(reused.get(), freed);
+    EXPECT_EQ(reused->value, 0);
+    EXPECT_EQ(reused->resets, 1);
+    EXPECT_EQ(pool.GetChunkCount(), 2u);
+}
+
+TEST(SlabPoolTest, SpawnDuringIterationGrowsSafely)
+{
+    SmallPool pool;
+    std::vector<RefPtr<SlabEntity>> held;
+    for (int i = 0; i < 4; ++i)
+        held.push_back(pool.Pop());
+
+    int visited = 0;
+    for (SlabEntity &entity : pool)
+    {
+        (void)entity;
+        if (visited == 0)
+        {
+            for (int i = 0; i < 5; ++i)
+                held.push_back(pool.Pop()); // New chunks mid-loop
+        }
+        ++visited;
+    }
+    EXPECT_EQ(visited, 9);
+    EXPECT_EQ(pool.GetChunkCount(), 3u);
+}
+
+TEST(SlabPoolTest, StorageOutlivesPoolWhileReferenced)
+{
+    SlabEntity::s_destroyed = 0;
+    RefPtr<SlabEntity> survivor;
+    {
+        SmallPool pool;
+        survivor = pool.Pop();
+        RefPtr<SlabEntity> other = pool.Pop();
+    }
+    EXPECT_EQ(SlabEntity::s_destroyed, 0);
+    survivor->value = 42; // Still valid
+
+    survivor.reset();
+    EXPECT_EQ(SlabEntity::s_destroyed, 2);
+}
+
+TEST(SlabPoolTest, HeapObjectsFallBackToDelete)
+{
+    SlabEntity::s_destroyed = 0;
+    RefPtr<SlabEntity> standalone(new SlabEntity());
+    EXPECT_FALSE(standalone->IsSlabAllocated());
+    standalone.reset();
+    EXPECT_EQ(SlabEntity::s_destroyed, 1);
+}
+
+} // namespace Testing
+} // namespace System
@@ -5,13 +5,19 @@
  * Measures:
  * 1. notify_one() call count comparison (Smart vs Always)
  * 2. System call overhead under high load
+ * 3. Post-to-process latency (p50/p99) per WaitPolicy on the real DispatcherImpl
  */
 
+#include "System/Dispatcher/DISPATCHER/DispatcherImpl.h"
+#include "System/Dispatcher/DISPATCHER/WaitStrategy.h"
+#include "System/Dispatcher/MessagePool.h"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <gtest/gtest.h>
+#include <iomanip>
 #include <iostream>
 #include <mutex>
 #include <queue>
@@ -347,3 +353,101 @@ TEST_F(SmartNotifyBenchmark, HighLoadScenario)
     // Most notifies should be skipped under high load
     EXPECT_GT(skipRatio, 50.0) << "High load scenario should skip most notifies";
 }
+
+// Bursty idle-to-busy transitions: how fast does a sleeping logic loop pick up a new message?
+class NullWaitHandler : public System::IPacketHandler
+{
+public:
+    void HandlePacket(System::SessionContext ctx, System::PacketView packet) override
+    {
+    }
+};
+
+TEST_F(SmartNotifyBenchmark, WaitPolicyLatency)
+{
+    using Clock = std::chrono::steady_clock;
+    constexpr int BURSTS = 200;
+    constexpr int BURST_SIZE = 8;
+    constexpr auto IDLE_GAP = std::chrono::microseconds(500);
+
+    System::MessagePool::Prepare(1000, 10, 10);
+
+    std::cout << "\n========================================\n";
+    std::cout << " Wait Policy Latency (" << BURSTS << " bursts x " << BURST_SIZE << ")\n";
+    std::cout << "========================================\n";
+
+    const System::WaitPolicy policies[] = {
+        System::WaitPolicy::ConditionVariable,
+        System::WaitPolicy::BusySpin,
+        System::WaitPolicy::SpinYield,
+        System::WaitPolicy::SpinPark,
+    };
+
+    for (System::WaitPolicy policy : policies)
+    {
+        System::DispatcherImpl dispatcher(std::make_shared<NullWaitHandler>(), policy);
+
+        // Only the consumer thread appends (tasks run on the logic thread)
+        std::vector<int64_t> latencyNs;
+        latencyNs.reserve(BURSTS * BURST_SIZE);
+        std::atomic<int> processed{0};
+        std::atomic<bool> running{true};
+
+        std::thread consumer(
+            [&]()
+            {
+                while (running)
+                {
+                    if (!dispatcher.Process())
+                        dispatcher.Wait(10);
+                }
+            }
+        );
+
+        for (int b = 0; b < BURSTS; ++b)
+        {
+            std::this_thread::sleep_for(IDLE_GAP); // Let the consumer go idle
+            for (int i = 0; i < BURST_SIZE; ++i)
+            {
+                auto posted = Clock::now();
+                dispatcher.Push(
+                    [&latencyNs, &processed, posted]()
+                    {
+                        latencyNs.push_back(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - posted).count()
+                        );
+                        processed.fetch_add(1, std::memory_order_release);
+                    }
+                );
+            }
+        }
+
+        while (processed.load(std::memory_order_acquire) < BURSTS * BURST_SIZE)
+            std::this_thread::yield();
+
+        running = false;
+        dispatcher.Shutdown();
+        consumer.join();
+
+        std::sort(latencyNs.begin(), latencyNs.end());
+        auto percentile = [&](double p)
+        {
+            return latencyNs[static_cast<size_t>(p * (latencyNs.size() - 1))] / 1000.0;
+        };
+
+        System::WaitStats stats = dispatcher.GetWaitStats();
+        std::cout << "[" << System::ToString(policy) << "]\n";
+        std::cout << "  p50: " << std::fixed << std::setprecision(1) << percentile(0.50) << "us"
+                  << "  p99: " << percentile(0.99) << "us\n";
+        std::cout << "  spin: " << stats.spinNs / 1000000 << "ms  park: " << stats.parkNs / 1000000
+                  << "ms  waits: " << stats.waits << "  wakeups: " << stats.wakeups << "  parks: " << stats.parks
+                  << "\n";
+
+        EXPECT_EQ(latencyNs.size(), static_cast<size_t>(BURSTS * BURST_SIZE));
+        EXPECT_GT(stats.wakeups, 0u);
+        if (policy == System::WaitPolicy::BusySpin || policy == System::WaitPolicy::SpinYield)
+        {
+            EXPECT_EQ(stats.parks, 0u);
+        }
+    }
+}
@@ -0,0 +1,162 @@
+#include "System/Dispatcher/DISPATCHER/DispatcherImpl.h"
+#include "System/Dispatcher/DispatchTask.h"
+#include "System/Dispatcher/MessagePool.h"
+#include "System/Packet/PacketPtr.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace System;
+
+// Dispatcher::Push 할당 비용 비교 (glibc malloc 기준)
+// - Legacy: new LambdaMessage + std::function (PacketPtr 캡처는 비-trivially-copyable 이라 항상 힙)
+// - Inline: MessagePool Task Slab + DispatchTask (SBO, 힙 없음)
+
+class NullTaskHandler : public IPacketHandler
+{
+public:
+    void HandlePacket(SessionContext ctx, PacketView packet) override
+    {
+    }
+};
+
+class TaskAllocBenchmark : public ::testing::Test
+{
+protected:
+    static constexpr int MESSAGE_COUNT = 400000;
+    static constexpr int PRODUCER_COUNT = 4;
+
+    void SetUp() override
+    {
+        MessagePool::Prepare(1000, 10, 10);
+    }
+
+    template <typename ProduceFn> long long RunLoad(DispatcherImpl &dispatcher, std::atomic<int> &executed, ProduceFn produce)
+    {
+        std::atomic<bool> running{true};
+        std::thread consumer(
+            [&]()
+            {
+                while (running || dispatcher.GetQueueSize() > 0)
+                {
+                    if (!dispatcher.Process())
+                        dispatcher.Wait(1);
+                }
+            }
+        );
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        std::vector<std::thread> producers;
+        for (int p = 0; p < PRODUCER_COUNT; ++p)
+        {
+            producers.emplace_back(
+                [&, p]()
+                {
+                    for (int i = 0; i < MESSAGE_COUNT / PRODUCER_COUNT; ++i)
+                        produce(p, i);
+                }
+            );
+        }
+        for (auto &t : producers)
+            t.join();
+
+        while (executed.load() < MESSAGE_COUNT)
+            std::this_thread::yield();
+
+        auto end = std::chrono::high_resolution_clock::now();
+        running = false;
+        consumer.join();
+
+        return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    }
+};
+
+TEST_F(TaskAllocBenchmark, CommonCaptureIsInline)
+{
+    PacketPtr pkt(MessagePool::AllocatePacket(16));
+    uint64_t sessionId = 42;
+
+    DispatchTask task(
+        [pkt, sessionId]()
+        {
+        }
+    );
+    EXPECT_TRUE(task.IsInline());
+
+    SessionTask sessionTask(
+        [pkt](SessionContext &ctx)
+        {
+        }
+    );
+    EXPECT_TRUE(sessionTask.IsInline());
+
+    // Oversized captures must still work (heap fallback)
+    struct Big
+    {
+        char data[256];
+    } big{};
+    DispatchTask bigTask(
+        [big]()
+        {
+        }
+    );
+    EXPECT_FALSE(bigTask.IsInline());
+    bigTask();
+}
+
+TEST_F(TaskAllocBenchmark, LegacyStdFunctionPush)
+{
+    DispatcherImpl dispatcher(std::make_shared<NullTaskHandler>());
+    PacketPtr pkt(MessagePool::AllocatePacket(16));
+    std::atomic<int> executed{0};
+
+    auto duration = RunLoad(
+        dispatcher,
+        executed,
+        [&](int p, int i)
+        {
+            // 레거시 시뮬레이션: new LambdaMessage + std::function 힙 캡처
+            uint64_t sessionId = static_cast<uint64_t>(i);
+            std::function<void()> fn = [&executed, pkt, sessionId]()
+            {
+                executed.fetch_add(1, std::memory_order_relaxed);
+            };
+            LambdaMessage *msg = new LambdaMessage();
+            msg->task = std::move(fn);
+            dispatcher.Post(msg);
+        }
+    );
+
+    std::cout << "[TaskAlloc] [Legacy] new LambdaMessage + std::function: " << MESSAGE_COUNT << " tasks in "
+              << duration << "ms" << std::endl;
+}
+
+TEST_F(TaskAllocBenchmark, InlineTaskPooledPush)
+{
+    DispatcherImpl dispatcher(std::make_shared<NullTaskHandler>());
+    PacketPtr pkt(MessagePool::AllocatePacket(16));
+    std::atomic<int> executed{0};
+
+    auto duration = RunLoad(
+        dispatcher,
+        executed,
+        [&](int p, int i)
+        {
+            uint64_t sessionId = static_cast<uint64_t>(i);
+            dispatcher.Push(
+                [&executed, pkt, sessionId]()
+                {
+                    executed.fetch_add(1, std::memory_order_relaxed);
+                }
+            );
+        }
+    );
+
+    std::cout << "[TaskAlloc] [Inline] Slab LambdaMessage + DispatchTask: " << MESSAGE_COUNT << " tasks in "
+              << duration << "ms" << std::endl;
+}
@@ -1,10 +1,15 @@
 #include "System/Network/UDPEndpointRegistry.h"
 #include "System/Session/UDPSession.h"
 #include "System/Dispatcher/IDispatcher.h"
+#include "System/Dispatcher/MessagePool.h"
 #include <gtest/gtest.h>
 #include <memory>
 #include <vector>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdio>
+#include <thread>
 
 namespace System {
 
@@ -17,16 +22,13 @@ public:
 
     void SetEndpoint(const boost::asio::ip::udp::endpoint &ep)
     {
-        _impl->endpoint = ep;
-        _impl->lastActivity = std::chrono::steady_clock::now();
+        Reset(nullptr, 0, nullptr, ep);
     }
 
-    uint64_t GetLastActivityMs() const
+    // Milliseconds of the last activity on the steady clock
+    int64_t GetLastActivityMs() const
     {
-        auto now = std::chrono::steady_clock::now();
-        return std::chrono::duration_cast<std::chrono::milliseconds>(
-            now - _impl->lastActivity
-        ).count();
+        return std::chrono::duration_cast<std::chrono::milliseconds>(GetLastActivity().time_since_epoch()).count();
     }
 };
 
@@ -36,8 +38,8 @@ class TestUDPSessionMockDispatcher : public IDispatcher
 public:
     void Post(IMessage *msg) override
     {
-        // Record the message
-        _receivedMessages.push_back(msg);
+        // Nothing inspects dispatched messages here
+        MessagePool::Free(msg);
     }
 
     bool Process() override { return false; }
@@ -46,7 +48,9 @@ public:
     bool IsOverloaded() const override { return false; }
     bool IsRecovered() const override { return true; }
     void RegisterTimerHandler(ITimerHandler *) override {}
-    void WithSession(uint64_t, std::function<void(SessionContext &)>) override {}
+    void WithSession(uint64_t, SessionTask) override {}
+    void SendToSessions(std::span<const uint64_t>, PacketPtr) override {}
+    void Push(DispatchTask) override {}
     void Shutdown() override {}
 };
 
@@ -150,7 +154,7 @@ TEST_F(UDPEndpointRegistryTest, RemoveNonExistentEndpoint)
 {
     auto endpoint = boost::asio::ip::udp::endpoint(
         boost::asio::ip::address::from_string("127.0.0.4"),
-        99999
+        19999
     );
 
     // Should not throw
@@ -221,8 +225,9 @@ TEST_F(UDPEndpointRegistryTest, CleanupTimeouts)
     // Wait a bit
     std::this_thread::sleep_for(std::chrono::milliseconds(20));
 
-    // Remove middle session
+    // Remove middle session, keep session3 active
     _registry->Remove(endpoint2);
+    _registry->UpdateActivity(endpoint3);
 
     // Cleanup with 15ms timeout (should remove session1 but keep session3)
     auto removed = _registry->CleanupTimeouts(15);
@@ -244,11 +249,11 @@ TEST_F(UDPEndpointRegistryTest, CleanupAllTimeouts)
 
     auto endpoint1 = boost::asio::ip::udp::endpoint(
         boost::asio::ip::address::from_string("127.0.0.9"),
-        66666
+        16666
     );
     auto endpoint2 = boost::asio::ip::udp::endpoint(
         boost::asio::ip::address::from_string("127.0.0.10"),
-        77777
+        17777
     );
 
     session1->SetEndpoint(endpoint1);
@@ -275,7 +280,7 @@ TEST_F(UDPEndpointRegistryTest, FindNonExistent)
 {
     auto endpoint = boost::asio::ip::udp::endpoint(
         boost::asio::ip::address::from_string("127.0.0.11"),
-        88888
+        18888
     );
 
     auto found = _registry->Find(endpoint);
@@ -291,24 +296,31 @@ TEST_F(UDPEndpointRegistryTest, ThreadSafety)
     auto session = std::make_unique<TestUDPSession>();
     auto endpoint = boost::asio::ip::udp::endpoint(
         boost::asio::ip::address::from_string("127.0.0.12"),
-        99999
+        29999
     );
     session->SetEndpoint(endpoint);
 
+    // Sessions outlive the threads: Find / UpdateActivity may hand out another thread's session
+    std::vector<std::unique_ptr<TestUDPSession>> tempSessions;
+    for (int i = 0; i < numThreads; ++i)
+    {
+        tempSessions.push_back(std::make_unique<TestUDPSession>());
+        tempSessions.back()->SetEndpoint(endpoint);
+    }
+
     // Start threads that will modify registry concurrently
     for (int i = 0; i < numThreads; ++i)
     {
-        threads.emplace_back([this, &endpoint, i] {
+        threads.emplace_back([this, &endpoint, &tempSessions, i] {
             for (int j = 0; j < opsPerThread; ++j)
             {
-                auto tempSession = std::make_unique<TestUDPSession>();
-                tempSession->SetEndpoint(endpoint);
+                TestUDPSession *tempSession = tempSessions[i].get();
 
-                _registry->Register(endpoint, tempSession.get());
+                _registry->Register(endpoint, tempSession);
                 _registry->Find(endpoint);
                 _registry->UpdateActivity(endpoint);
                 _registry->Remove(endpoint);
-                _registry->Register(endpoint, tempSession.get());
+                _registry->Register(endpoint, tempSession);
             }
         });
     }
@@ -328,3 +340,267 @@ TEST_F(UDPEndpointRegistryTest, ThreadSafety)
     ASSERT_NE(found, nullptr);
     ASSERT_EQ(found, session2.get());
 }
+
+TEST_F(UDPEndpointRegistryTest, TokenLookupFollowsEndpoint)
+{
+    auto session = std::make_unique<TestUDPSession>();
+    auto endpoint = boost::asio::ip::udp::endpoint(boost::asio::ip::make_address("10.0.0.1"), 4000);
+    auto ipv6 = boost::asio::ip::udp::endpoint(boost::asio::ip::make_address("::1"), 4000);
+    session->SetEndpoint(endpoint);
+
+    const uint128_t token(0x1122334455667788ULL, 0x99AABBCCDDEEFF00ULL);
+    _registry->RegisterWithToken(endpoint, session.get(), token);
+
+    EXPECT_EQ(_registry->GetEndpointByToken(token), session.get());
+    EXPECT_EQ(_registry->GetEndpointByToken(uint128_t(token.high, token.low + 1)), nullptr);
+    EXPECT_EQ(_registry->Find(ipv6), nullptr); // Same port, different family
+    EXPECT_EQ(_registry->Size(), 1u);
+
+    _registry->Remove(endpoint);
+    EXPECT_EQ(_registry->GetEndpointByToken(token), nullptr);
+    EXPECT_EQ(_registry->Size(), 0u);
+}
+
+// Re-registering an endpoint drops the token its previous mapping carried (new token or new session).
+TEST_F(UDPEndpointRegistryTest, ReRegisterReleasesOldToken)
+{
+    auto session1 = std::make_unique<TestUDPSession>();
+    auto session2 = std::make_unique<TestUDPSession>();
+    auto endpoint = boost::asio::ip::udp::endpoint(boost::asio::ip::make_address("10.0.0.2"), 4001);
+    session1->SetEndpoint(endpoint);
+    session2->SetEndpoint(endpoint);
+
+    const uint128_t tokenA(1, 1);
+    const uint128_t tokenB(1, 2);
+    const uint128_t tokenC(1, 3);
+
+    _registry->RegisterWithToken(endpoint, session1.get(), tokenA);
+    _registry->RegisterWithToken(endpoint, session1.get(), tokenB); // New token, same session
+    EXPECT_EQ(_registry->GetEndpointByToken(tokenA), nullptr);
+    EXPECT_EQ(_registry->GetEndpointByToken(tokenB), session1.get());
+
+    _registry->RegisterWithToken(endpoint, session2.get(), tokenC); // New session
+    EXPECT_EQ(_registry->GetEndpointByToken(tokenB), nullptr);
+    EXPECT_EQ(_registry->GetEndpointByToken(tokenC), session2.get());
+
+    _registry->RegisterWithToken(endpoint, session2.get(), tokenC); // Unchanged registration keeps its token
+    EXPECT_EQ(_registry->GetEndpointByToken(tokenC), session2.get());
+
+    _registry->Register(endpoint, session1.get()); // Token-less registration over a tokened one
+    EXPECT_EQ(_registry->GetEndpointByToken(tokenC), nullptr);
+    EXPECT_EQ(_registry->Find(endpoint), session1.get());
+    EXPECT_EQ(_registry->Size(), 1u);
+}
+
+// Enough entries to grow every shard several times, then remove every other one
+// (backward-shift deletes must keep the remaining probe chains intact).
+TEST_F(UDPEndpointRegistryTest, GrowAndShrink)
+{
+    constexpr int COUNT = 4096;
+    auto session = std::make_unique<TestUDPSession>();
+    auto endpointOf = [](int i) {
+        return boost::asio::ip::udp::endpoint(
+            boost::asio::ip::address_v4(0x0A000000u + static_cast<uint32_t>(i)), static_cast<uint16_t>(1000 + i % 7)
+        );
+    };
+
+    for (int i = 0; i < COUNT; ++i)
+        _registry->Register(endpointOf(i), session.get());
+    ASSERT_EQ(_registry->Size(), static_cast<size_t>(COUNT));
+
+    for (int i = 0; i < COUNT; i += 2)
+        _registry->Remove(endpointOf(i));
+    ASSERT_EQ(_registry->Size(), static_cast<size_t>(COUNT / 2));
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+        if (i % 2 == 0)
+            ASSERT_EQ(_registry->Find(endpointOf(i)), nullptr) << i;
+        else
+            ASSERT_EQ(_registry->Find(endpointOf(i)), session.get()) << i;
+    }
+}
+
+// [Benchmark] Receive-path lookups (Find + token fallback) from several threads while
+// one thread keeps registering and removing sessions.
+TEST_F(UDPEndpointRegistryTest, ContendedLookupBenchmark)
+{
+    constexpr int SESSIONS = 10000;
+    constexpr int CHURN = 256;
+    const int readers = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+
+    std::vector<std::unique_ptr<TestUDPSession>> sessions;
+    std::vector<boost::asio::ip::udp::endpoint> endpoints;
+    for (int i = 0; i < SESSIONS + CHURN; ++i)
+    {
+        endpoints.emplace_back(
+            boost::asio::ip::address_v4(0x0A000000u + static_cast<uint32_t>(i)), static_cast<uint16_t>(20000 + i % 100)
+        );
+        sessions.push_back(std::make_unique<TestUDPSession>());
+        sessions.back()->SetEndpoint(endpoints.back());
+    }
+    for (int i = 0; i < SESSIONS; ++i)
+        _registry->RegisterWithToken(endpoints[i], sessions[i].get(), uint128_t(0, static_cast<uint64_t>(i) + 1));
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> lookups{0};
+    std::atomic<uint64_t> misses{0};
+    std::vector<std::thread> threads;
+    for (int r = 0; r < readers; ++r)
+    {
+        threads.emplace_back(
+            [&, r]
+            {
+                uint64_t local = 0;
+                uint64_t localMisses = 0;
+                for (uint32_t i = static_cast<uint32_t>(r) * 7919; !stop.load(std::memory_order_relaxed); ++i)
+                {
+                    const int index = static_cast<int>(i % SESSIONS);
+                    UDPSession *found = _registry->Find(endpoints[index]);
+                    if (found == nullptr)
+                        found = _registry->GetEndpointByToken(uint128_t(0, static_cast<uint64_t>(index) + 1));
+                    if (found != sessions[index].get())
+                        ++localMisses;
+                    ++local;
+                }
+                lookups.fetch_add(local);
+                misses.fetch_add(localMisses);
+            }
+        );
+    }
+
+    uint64_t writes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(300))
+    {
+        for (int i = SESSIONS; i < SESSIONS + CHURN; ++i)
+            _registry->RegisterWithToken(endpoints[i], sessions[i].get(), uint128_t(1, static_cast<uint64_t>(i)));
+        for (int i = SESSIONS; i < SESSIONS + CHURN; ++i)
+            _registry->Remove(endpoints[i]);
+        writes += CHURN * 2;
+    }
+    stop.store(true);
+    for (auto &t : threads)
+        t.join();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf(
+        "[UDPEndpointRegistry] %d readers: %.1f M lookups/s, writer %.1f K ops/s\n", readers,
+        lookups.load() / seconds / 1e6, writes / seconds / 1e3
+    );
+    EXPECT_EQ(misses.load(), 0u);
+    EXPECT_EQ(_registry->Size(), static_cast<size_t>(SESSIONS));
+}
+
+// [Lazy Re-arm] A session kept active across many sweeps survives; it expires once it goes quiet.
+TEST_F(UDPEndpointRegistryTest, ActiveSessionIsRearmed)
+{
+    auto active = std::make_unique<TestUDPSession>();
+    auto idle = std::make_unique<TestUDPSession>();
+    auto activeEndpoint = boost::asio::ip::udp::endpoint(boost::asio::ip::make_address("10.1.0.1"), 5000);
+    auto idleEndpoint = boost::asio::ip::udp::endpoint(boost::asio::ip::make_address("10.1.0.2"), 5000);
+    active->SetEndpoint(activeEndpoint);
+    idle->SetEndpoint(idleEndpoint);
+
+    _registry->RegisterWithToken(activeEndpoint, active.get(), uint128_t(0, 1));
+    _registry->Register(idleEndpoint, idle.get());
+
+    size_t removed = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        active->UpdateActivity(); // Receive path: no registry call
+        removed += _registry->CleanupTimeouts(30);
+    }
+    EXPECT_EQ(removed, 1u);
+    EXPECT_EQ(_registry->Find(idleEndpoint), nullptr);
+    EXPECT_EQ(_registry->Find(activeEndpoint), active.get());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(_registry->CleanupTimeouts(30), 1u);
+    EXPECT_EQ(_registry->Find(activeEndpoint), nullptr);
+    EXPECT_EQ(_registry->GetEndpointByToken(uint128_t(0, 1)), nullptr);
+}
+
+// Remove + Register of the same session and endpoint leaves one live wheel entry, not two re-armed forever
+TEST_F(UDPEndpointRegistryTest, ReRegisterDoesNotDuplicateWheelEntry)
+{
+    auto session = std::make_unique<TestUDPSession>();
+    auto endpoint = boost::asio::ip::udp::endpoint(boost::asio::ip::make_address("10.2.0.1"), 5000);
+    session->SetEndpoint(endpoint);
+
+    _registry->Register(endpoint, session.get());
+    _registry->Register(endpoint, session.get()); // Same registration: not armed again
+    EXPECT_EQ(_registry->GetIdleEntryCount(), 1u);
+
+    _registry->Remove(endpoint);
+    _registry->Register(endpoint, session.get());
+    EXPECT_EQ(_registry->GetIdleEntryCount(), 2u); // Stale entry waits for its bucket
+
+    for (int i = 0; i < 10; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        session->UpdateActivity();
+        EXPECT_EQ(_registry->CleanupTimeouts(30), 0u);
+    }
+    EXPECT_EQ(_registry->GetIdleEntryCount(), 1u);
+    EXPECT_EQ(_registry->Find(endpoint), session.get());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(_registry->CleanupTimeouts(30), 1u);
+    EXPECT_EQ(_registry->GetIdleEntryCount(), 0u);
+}
+
+// [Benchmark] Short timeout swept every tick: half the sessions stay active (re-armed), half expire.
+// A full scan visits every session per sweep; the wheel visits each one about once per timeout.
+TEST_F(UDPEndpointRegistryTest, SweepCostIndependentOfSessionCount)
+{
+    constexpr int SESSIONS = 20000;
+    constexpr uint32_t TIMEOUT_MS = 100;
+    constexpr auto RUN = std::chrono::milliseconds(400);
+
+    std::vector<std::unique_ptr<TestUDPSession>> sessions;
+    for (int i = 0; i < SESSIONS; ++i)
+    {
+        sessions.push_back(std::make_unique<TestUDPSession>());
+        _registry->Register(
+            boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4(0x0B000000u + static_cast<uint32_t>(i)), 7000),
+            sessions.back().get()
+        );
+    }
+
+    size_t removed = 0;
+    int sweeps = 0;
+    double sweepMicros = 0;
+    double scanMicros = 0;
+    const auto end = std::chrono::steady_clock::now() + RUN;
+    while (std::chrono::steady_clock::now() < end)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        for (int i = 0; i < SESSIONS; i += 2)
+            sessions[i]->UpdateActivity();
+
+        auto start = std::chrono::steady_clock::now();
+        removed += _registry->CleanupTimeouts(TIMEOUT_MS);
+        sweepMicros += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        // Full-scan baseline: read every session's activity once
+        start = std::chrono::steady_clock::now();
+        const auto cutoff = start - std::chrono::milliseconds(TIMEOUT_MS);
+        size_t idle = 0;
+        for (const auto &session : sessions)
+            idle += session->GetLastActivity() < cutoff ? 1 : 0;
+        scanMicros += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        EXPECT_LE(idle, static_cast<size_t>(SESSIONS));
+        ++sweeps;
+    }
+
+    std::printf(
+        "[UDPEndpointRegistry] %d sessions, %ums timeout, %d sweeps: wheel %.2f us per sweep, full scan %.2f us\n",
+        SESSIONS, TIMEOUT_MS, sweeps, sweepMicros / sweeps, scanMicros / sweeps
+    );
+    EXPECT_EQ(removed, static_cast<size_t>(SESSIONS / 2));
+    EXPECT_EQ(_registry->Size(), static_cast<size_t>(SESSIONS / 2));
+    EXPECT_EQ(_registry->GetIdleEntryCount(), static_cast<size_t>(SESSIONS / 2)); // One entry per live session
+    EXPECT_LT(sweepMicros, scanMicros);
+}
@@ -2,20 +2,31 @@
 #include "System/Session/SessionFactory.h"
 #include "System/Network/UDPEndpointRegistry.h"
 #include "System/Dispatcher/IDispatcher.h"
+#include "System/Dispatcher/MessagePool.h"
+#include "System/Network/UDPNetworkImpl.h"
+#include "System/Network/UDPTransportHeader.h"
 #include <gtest/gtest.h>
 #include <memory>
 #include <vector>
 #include <boost/asio/ip/address.hpp>
 #include <boost/asio/ip/udp.hpp>
 #include <cstddef>
+#include <cstring>
+#include <iostream>
 #include <set>
 
 namespace System {
 
 // Mock Dispatcher that records and manages messages
-class TestUDPSessionMockDispatcher : public IDispatcher
+class UDPNetworkMockDispatcher : public IDispatcher
 {
 public:
+    ~UDPNetworkMockDispatcher() override
+    {
+        for (IMessage *msg : _receivedMessages)
+            MessagePool::Free(msg);
+    }
+
     void Post(IMessage *msg) override
     {
         _receivedMessages.push_back(msg);
@@ -26,7 +37,7 @@ public:
         bool processed = false;
         while (!_queue.empty())
         {
-            auto task = _queue.front();
+            auto task = std::move(_queue.front());
             _queue.pop_front();
             task();
             processed = true;
@@ -43,20 +54,21 @@ public:
     bool IsOverloaded() const override { return false; }
     bool IsRecovered() const override { return true; }
     void RegisterTimerHandler(ITimerHandler *) override {}
-    void WithSession(uint64_t, std::function<void(SessionContext &)>) override {}
+    void WithSession(uint64_t, SessionTask) override {}
+    void SendToSessions(std::span<const uint64_t>, PacketPtr) override {}
     void Shutdown() override {}
 
-    void Push(std::function<void()> task) override
+    void Push(DispatchTask task) override
     {
         std::lock_guard<std::mutex> lock(_mutex);
-        _queue.push_back(task);
+        _queue.push_back(std::move(task));
     }
 
     const std::vector<IMessage*>& GetReceivedMessages() const { return _receivedMessages; }
 
 private:
     std::vector<IMessage*> _receivedMessages;
-    std::deque<std::function<void()>> _queue;
+    std::deque<DispatchTask> _queue;
     std::mutex _mutex;
 };
 
@@ -70,7 +82,7 @@ protected:
     void SetUp() override
     {
         SessionFactory::SetServerRole(ServerRole::Backend);
-        _dispatcher = std::make_unique<TestUDPSessionMockDispatcher>();
+        _dispatcher = std::make_unique<UDPNetworkMockDispatcher>();
         _registry = std::make_unique<UDPEndpointRegistry>();
     }
 
@@ -80,7 +92,7 @@ protected:
         _registry.reset();
     }
 
-    std::unique_ptr<TestUDPSessionMockDispatcher> _dispatcher;
+    std::unique_ptr<UDPNetworkMockDispatcher> _dispatcher;
     std::unique_ptr<UDPEndpointRegistry> _registry;
 };
 
@@ -95,7 +107,7 @@ TEST_F(UDPNetworkTest, UDPSessionCreation)
     ASSERT_NE(session, nullptr);
 
     EXPECT_TRUE(session->IsConnected());
-    EXPECT_EQ(session->GetId(), 1ULL);
+    EXPECT_NE(session->GetId(), 0ULL);
 
     SessionFactory::Destroy(session);
 }
@@ -173,7 +185,7 @@ TEST_F(UDPNetworkTest, UDPEndpointRegistryIntegration)
     );
     auto endpoint2 = boost::asio::ip::udp::endpoint(
         boost::asio::ip::make_address("127.0.0.8"),
-        66666
+        56666
     );
 
     auto session1 = SessionFactory::CreateUDPSession(endpoint1, _dispatcher.get());
@@ -182,8 +194,8 @@ TEST_F(UDPNetworkTest, UDPEndpointRegistryIntegration)
     ASSERT_NE(session1, nullptr);
     ASSERT_NE(session2, nullptr);
 
-    _registry->Register(endpoint1, session1);
-    _registry->Register(endpoint2, session2);
+    _registry->Register(endpoint1, static_cast<UDPSession *>(session1));
+    _registry->Register(endpoint2, static_cast<UDPSession *>(session2));
 
     auto found1 = _registry->Find(endpoint1);
     auto found2 = _registry->Find(endpoint2);
@@ -204,7 +216,7 @@ TEST_F(UDPNetworkTest, UDPSessionSendPacket)
 {
     auto endpoint = boost::asio::ip::udp::endpoint(
         boost::asio::ip::make_address("127.0.0.9"),
-        77777
+        57777
     );
 
     auto session = SessionFactory::CreateUDPSession(endpoint, _dispatcher.get());
@@ -223,7 +235,7 @@ TEST_F(UDPNetworkTest, UDPSessionSessionIdUniqueness)
     {
         auto endpoint = boost::asio::ip::udp::endpoint(
             boost::asio::ip::make_address("127.0.0.10"),
-            88888 + i
+            static_cast<unsigned short>(40000 + i)
         );
 
         auto session = SessionFactory::CreateUDPSession(endpoint, _dispatcher.get());
@@ -232,13 +244,9 @@ TEST_F(UDPNetworkTest, UDPSessionSessionIdUniqueness)
         ids.insert(session->GetId());
     }
 
+    // Ids come from the session handle allocator (Version|Slot), so only uniqueness and non-zero are guaranteed
     EXPECT_EQ(ids.size(), static_cast<size_t>(numSessions));
-
-    uint64_t expectedId = 1;
-    for (auto id : ids)
-    {
-        EXPECT_EQ(id, expectedId++);
-    }
+    EXPECT_EQ(ids.count(0), 0u);
 
     for (auto session : sessions)
     {
@@ -250,14 +258,14 @@ TEST_F(UDPNetworkTest, UDPSessionConnectionLifecycle)
 {
     auto endpoint = boost::asio::ip::udp::endpoint(
         boost::asio::ip::make_address("127.0.0.11"),
-        99999
+        59999
     );
 
     auto session = SessionFactory::CreateUDPSession(endpoint, _dispatcher.get());
     ASSERT_NE(session, nullptr);
 
     EXPECT_TRUE(session->IsConnected());
-    EXPECT_EQ(session->GetId(), 1ULL);
+    EXPECT_NE(session->GetId(), 0ULL);
 
     session->Close();
     EXPECT_FALSE(session->IsConnected());
@@ -288,17 +296,95 @@ TEST_F(UDPNetworkTest, UDPEndpointRegistryCleanup)
     ASSERT_NE(session2, nullptr);
     ASSERT_NE(session3, nullptr);
 
-    _registry->Register(endpoint1, session1);
-    _registry->Register(endpoint2, session2);
-    _registry->Register(endpoint3, session3);
+    _registry->Register(endpoint1, static_cast<UDPSession *>(session1));
+    _registry->Register(endpoint2, static_cast<UDPSession *>(session2));
+    _registry->Register(endpoint3, static_cast<UDPSession *>(session3));
 
     std::this_thread::sleep_for(std::chrono::milliseconds(20));
 
     size_t removed = _registry->CleanupTimeouts(15);
 
-    EXPECT_TRUE(removed == 2);
+    // All three have been idle longer than the timeout
+    EXPECT_EQ(removed, 3u);
 
     SessionFactory::Destroy(session1);
     SessionFactory::Destroy(session2);
     SessionFactory::Destroy(session3);
 }
+
+// [Benchmark] Loopback UDP throughput: one syscall per datagram vs recvmmsg/sendmmsg batches (+ GSO).
+// The sender keeps at most 512 datagrams in flight (UDPSendContextPool holds 1024).
+TEST(UDPNetworkBenchmark, BatchedThroughput)
+{
+    MessagePool::Prepare(8192, 1024, 256);
+    constexpr uint32_t COUNT = 200000;
+    constexpr uint16_t PAYLOAD = 200;
+
+    struct Mode
+    {
+        const char *name;
+        size_t batchSize;
+        bool gso;
+    };
+    const Mode modes[] = {{"async_send_to", 0, false}, {"sendmmsg x32", 32, false}, {"sendmmsg x32 + GSO", 32, true}};
+
+    for (const Mode &mode : modes)
+    {
+        boost::asio::io_context receiverIo;
+        boost::asio::io_context senderIo;
+        auto receiverGuard = boost::asio::make_work_guard(receiverIo);
+        auto senderGuard = boost::asio::make_work_guard(senderIo);
+
+        UDPNetworkImpl receiver(receiverIo);
+        UDPNetworkImpl sender(senderIo);
+        receiver.SetBatching(mode.batchSize, false);
+        sender.SetBatching(mode.batchSize, mode.gso);
+        ASSERT_TRUE(receiver.Start(0));
+        ASSERT_TRUE(sender.Start(0));
+
+        std::thread receiverThread([&]() { receiverIo.run(); });
+        std::thread senderThread([&]() { senderIo.run(); });
+
+        const boost::asio::ip::udp::endpoint target(boost::asio::ip::address_v4::loopback(), receiver.GetLocalPort());
+        const uint128_t token(0x1122334455667788ULL, 0x99AABBCCDDEEFF00ULL);
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < COUNT; ++i)
+        {
+            while (i - sender.GetSentCount() > 512)
+                std::this_thread::yield();
+
+            PacketMessage *packet = MessagePool::AllocatePacket(PAYLOAD);
+            ASSERT_NE(packet, nullptr);
+            std::memset(packet->Payload(), 0x5A, PAYLOAD);
+            sender.AsyncSend(target, UDPTransportHeader::TAG_RAW_UDP, 1, token, packet, PAYLOAD);
+        }
+        while (sender.GetSentCount() < COUNT &&
+               std::chrono::steady_clock::now() - start < std::chrono::seconds(10))
+            std::this_thread::yield();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        uint64_t received = receiver.GetReceivedCount(0);
+
+        std::cout << "[UDP " << mode.name << "] sent " << sender.GetSentCount() << " in " << seconds * 1000.0
+                  << " ms (" << static_cast<uint64_t>(sender.GetSentCount() / seconds) << " pps), "
+                  << static_cast<double>(sender.GetSendCallCount()) / static_cast<double>(sender.GetSentCount())
+                  << " send syscalls/datagram, received " << received << std::endl;
+
+        EXPECT_EQ(sender.GetSentCount(), COUNT);
+        if (mode.batchSize > 0)
+        {
+            EXPECT_LT(sender.GetSendCallCount(), sender.GetSentCount());
+        }
+
+        sender.Stop();
+        receiver.Stop();
+        senderGuard.reset();
+        receiverGuard.reset();
+        senderIo.stop();
+        receiverIo.stop();
+        senderThread.join();
+        receiverThread.join();
+    }
+}
@@ -0,0 +1,222 @@
+#include "System/Dispatcher/MessagePool.h"
+#include "System/Network/UDPBatchIO.h"
+#include "System/Network/UDPNetworkImpl.h"
+#include "System/Network/UDPTransportHeader.h"
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace System;
+using boost::asio::ip::udp;
+
+namespace {
+
+uint64_t TotalReceived(const UDPNetworkImpl &net)
+{
+    uint64_t total = 0;
+    for (size_t i = 0; i < net.GetShardCount(); ++i)
+        total += net.GetReceivedCount(i);
+    return total;
+}
+
+bool WaitForTotal(const UDPNetworkImpl &net, uint64_t expected)
+{
+    for (int i = 0; i < 400 && TotalReceived(net) < expected; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    return TotalReceived(net) >= expected;
+}
+
+} // namespace
+
+// SO_REUSEPORT shards: the kernel hashes the 4-tuple, so every datagram of one client
+// lands on the same shard while different clients spread over several shards.
+TEST(UDPSocketShardsTest, ClientStaysOnOneShard)
+{
+    boost::asio::io_context sharedIo;
+    UDPNetworkImpl net(sharedIo);
+    net.SetShardCount(4);
+    ASSERT_TRUE(net.Start(0));
+    if (net.GetShardCount() < 4)
+    {
+        GTEST_SKIP() << "SO_REUSEPORT not available";
+    }
+
+    boost::asio::io_context clientIo;
+    const udp::endpoint server(boost::asio::ip::address_v4::loopback(), net.GetLocalPort());
+    std::vector<uint8_t> datagram(UDPTransportHeader::SIZE + 16, 0xEE); // Invalid tag: counted, then dropped
+
+    std::set<size_t> usedShards;
+    uint64_t expected = 0;
+    for (int client = 0; client < 16; ++client)
+    {
+        udp::socket socket(clientIo, udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+        std::vector<uint64_t> before(net.GetShardCount());
+        for (size_t i = 0; i < before.size(); ++i)
+            before[i] = net.GetReceivedCount(i);
+
+        for (int i = 0; i < 8; ++i)
+            socket.send_to(boost::asio::buffer(datagram), server);
+        expected += 8;
+        ASSERT_TRUE(WaitForTotal(net, expected));
+
+        size_t hitShards = 0;
+        for (size_t i = 0; i < before.size(); ++i)
+        {
+            uint64_t delta = net.GetReceivedCount(i) - before[i];
+            if (delta > 0)
+            {
+                EXPECT_EQ(delta, 8u);
+                usedShards.insert(i);
+                ++hitShards;
+            }
+        }
+        EXPECT_EQ(hitShards, 1u);
+    }
+    EXPECT_GT(usedShards.size(), 1u);
+
+    net.Stop();
+}
+
+// Stop tears the shards down, so the same network object can Start again (shared and owned contexts).
+TEST(UDPSocketShardsTest, StartAfterStop)
+{
+    boost::asio::io_context clientIo;
+    udp::socket client(clientIo, udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    std::vector<uint8_t> datagram(UDPTransportHeader::SIZE + 16, 0xEE); // Invalid tag: counted, then dropped
+
+    for (size_t shardCount : {size_t(1), size_t(2)})
+    {
+        boost::asio::io_context sharedIo;
+        UDPNetworkImpl net(sharedIo);
+        net.SetShardCount(shardCount);
+
+        for (int round = 0; round < 2; ++round)
+        {
+            ASSERT_TRUE(net.Start(0)) << "shards=" << shardCount << " round=" << round;
+            const udp::endpoint server(boost::asio::ip::address_v4::loopback(), net.GetLocalPort());
+            for (int i = 0; i < 4; ++i)
+                client.send_to(boost::asio::buffer(datagram), server);
+
+            sharedIo.restart(); // Ran out of work during the previous round
+            for (int wait = 0; wait < 400 && TotalReceived(net) < 4; ++wait)
+                sharedIo.run_for(std::chrono::milliseconds(5));
+            EXPECT_EQ(TotalReceived(net), 4u) << "shards=" << shardCount << " round=" << round;
+
+            net.Stop();
+            EXPECT_EQ(net.GetShardCount(), 0u);
+            EXPECT_EQ(net.GetLocalPort(), 0u);
+        }
+    }
+}
+
+// Sends go out through the destination's shard but always from the shared bound port.
+TEST(UDPSocketShardsTest, AsyncSendUsesBoundPort)
+{
+    MessagePool::Prepare(1000, 10, 10);
+
+    boost::asio::io_context sharedIo;
+    UDPNetworkImpl net(sharedIo);
+    net.SetShardCount(4);
+    ASSERT_TRUE(net.Start(0));
+
+    boost::asio::io_context clientIo;
+    std::vector<udp::socket> clients;
+    for (int i = 0; i < 8; ++i)
+        clients.emplace_back(clientIo, udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+
+    for (size_t i = 0; i < clients.size(); ++i)
+    {
+        PacketMessage *packet = MessagePool::AllocatePacket(32);
+        ASSERT_NE(packet, nullptr);
+        std::memset(packet->Payload(), static_cast<int>(i), 32);
+        net.AsyncSend(clients[i].local_endpoint(), UDPTransportHeader::TAG_RAW_UDP, 100 + i, uint128_t(), packet, 32);
+    }
+    if (net.GetShardCount() == 1)
+    {
+        sharedIo.run_for(std::chrono::milliseconds(100));
+    }
+
+    for (size_t i = 0; i < clients.size(); ++i)
+    {
+        std::array<uint8_t, 256> buffer{};
+        udp::endpoint sender;
+        for (int wait = 0; wait < 400 && clients[i].available() == 0; ++wait)
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        ASSERT_GT(clients[i].available(), 0u);
+        size_t bytes = clients[i].receive_from(boost::asio::buffer(buffer), sender);
+
+        ASSERT_EQ(bytes, UDPTransportHeader::SIZE + 32);
+        EXPECT_EQ(sender.port(), net.GetLocalPort());
+        uint64_t sessionId = 0;
+        std::memcpy(&sessionId, buffer.data() + 1, sizeof(sessionId));
+        EXPECT_EQ(sessionId, 100 + i);
+        EXPECT_EQ(buffer[UDPTransportHeader::SIZE], static_cast<uint8_t>(i));
+    }
+
+    net.Stop();
+}
+
+// [Batch] Queued sends leave in sendmmsg batches (GSO on) in order, and the receive side
+// drains them with recvmmsg.
+TEST(UDPSocketShardsTest, BatchedSendAndReceive)
+{
+    if (!IsUDPBatchIOSupported())
+        GTEST_SKIP() << "recvmmsg/sendmmsg not available on this platform";
+
+    MessagePool::Prepare(1000, 10, 10);
+    constexpr size_t COUNT = 100;
+
+    boost::asio::io_context senderIo;
+    UDPNetworkImpl sender(senderIo);
+    sender.SetBatching(16, true);
+    ASSERT_TRUE(sender.Start(0));
+
+    boost::asio::io_context plainIo;
+    udp::socket plain(plainIo, udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    plain.set_option(boost::asio::socket_base::receive_buffer_size(1 << 20));
+
+    // Queued before the context runs: the flush finds them all and batches
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        PacketMessage *packet = MessagePool::AllocatePacket(64);
+        ASSERT_NE(packet, nullptr);
+        std::memset(packet->Payload(), static_cast<int>(i), 64);
+        sender.AsyncSend(plain.local_endpoint(), UDPTransportHeader::TAG_RAW_UDP, i, uint128_t(), packet, 64);
+    }
+    for (int i = 0; i < 400 && sender.GetSentCount() < COUNT; ++i)
+        senderIo.run_for(std::chrono::milliseconds(5));
+
+    EXPECT_EQ(sender.GetSentCount(), COUNT);
+    EXPECT_LE(sender.GetSendCallCount(), COUNT / 16 + 1);
+
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        std::array<uint8_t, 256> buffer{};
+        udp::endpoint from;
+        for (int wait = 0; wait < 400 && plain.available() == 0; ++wait)
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        ASSERT_GT(plain.available(), 0u);
+        ASSERT_EQ(plain.receive_from(boost::asio::buffer(buffer), from), UDPTransportHeader::SIZE + 64);
+        EXPECT_EQ(buffer[UDPTransportHeader::SIZE], static_cast<uint8_t>(i));
+    }
+
+    // Receive side: plain datagrams into a batched socket shard
+    boost::asio::io_context receiverIo;
+    UDPNetworkImpl receiver(receiverIo);
+    receiver.SetBatching(16, false);
+    ASSERT_TRUE(receiver.Start(0));
+    const udp::endpoint target(boost::asio::ip::address_v4::loopback(), receiver.GetLocalPort());
+    std::vector<uint8_t> datagram(UDPTransportHeader::SIZE + 16, 0);
+    for (size_t i = 0; i < 40; ++i)
+        plain.send_to(boost::asio::buffer(datagram), target);
+    for (int i = 0; i < 400 && receiver.GetReceivedCount(0) < 40; ++i)
+        receiverIo.run_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(receiver.GetReceivedCount(0), 40u);
+
+    sender.Stop();
+    receiver.Stop();
+}
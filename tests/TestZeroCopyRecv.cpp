@@ -0,0 +1,187 @@
+#include "System/Dispatcher/DISPATCHER/DispatcherImpl.h"
+#include "System/Dispatcher/MessagePool.h"
+#include "System/Network/RecvBuffer.h"
+#include "System/Packet/PacketHeader.h"
+#include "System/Session/GatewaySession.h"
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace System;
+using boost::asio::ip::tcp;
+
+namespace {
+
+class RecordingHandler : public IPacketHandler
+{
+public:
+    void HandlePacket(SessionContext ctx, PacketView packet) override
+    {
+        ids.push_back(packet.GetId());
+        const uint8_t *body = packet.GetPayload();
+        bool intact = true;
+        for (size_t i = 0; i < packet.GetLength(); ++i)
+            intact = intact && body[i] == static_cast<uint8_t>(packet.GetId());
+        allIntact = allIntact && intact;
+    }
+
+    std::vector<uint16_t> ids;
+    bool allIntact = true;
+};
+
+std::vector<uint8_t> MakeFrame(uint16_t id, uint16_t bodySize)
+{
+    std::vector<uint8_t> frame(sizeof(PacketHeader) + bodySize, static_cast<uint8_t>(id));
+    PacketHeader header{static_cast<uint16_t>(frame.size()), id};
+    std::memcpy(frame.data(), &header, sizeof(header));
+    return frame;
+}
+
+bool PollUntil(boost::asio::io_context &io, const std::function<bool()> &done)
+{
+    for (int i = 0; i < 200; ++i)
+    {
+        io.poll();
+        io.restart();
+        if (done())
+            return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return false;
+}
+
+} // namespace
+
+// Frames handed out in place keep the block alive; the block is written forward only and
+// rotates with just the straddling partial frame once it runs low on space.
+TEST(ZeroCopyRecvTest, SharedBlockRotatesOnlyWhileReferenced)
+{
+    const size_t baseline = RecvBuffer::GetAttachedBlockCount();
+    {
+        RecvBuffer buffer;
+        buffer.SetShared(true);
+        buffer.Attach();
+        EXPECT_EQ(RecvBuffer::GetAttachedBlockCount(), baseline + 1);
+
+        // Fill until less than COMPACT_THRESHOLD is left, consume all but a 10 byte tail
+        const int32_t fill = buffer.FreeSize() - RecvBuffer::COMPACT_THRESHOLD + 1;
+        std::memset(buffer.WritePos(), 0xAB, fill);
+        ASSERT_TRUE(buffer.MoveWritePos(fill));
+        ASSERT_TRUE(buffer.MoveReadPos(fill - 10));
+
+        uint8_t *first = buffer.RetainBlock();
+        buffer.Clean();
+        EXPECT_EQ(buffer.DataSize(), 10);
+        EXPECT_EQ(buffer.ReadPos()[0], 0xAB);
+        EXPECT_EQ(RecvBuffer::GetAttachedBlockCount(), baseline + 2); // Old block pinned by the reference
+
+        RecvBuffer::ReleaseBlock(first);
+        EXPECT_EQ(RecvBuffer::GetAttachedBlockCount(), baseline + 1);
+
+        // Unreferenced: plain compaction again, no new block
+        buffer.Clean();
+        EXPECT_EQ(RecvBuffer::GetAttachedBlockCount(), baseline + 1);
+        ASSERT_TRUE(buffer.MoveReadPos(10));
+    }
+    EXPECT_EQ(RecvBuffer::GetAttachedBlockCount(), baseline);
+}
+
+// Plain gateway session: queued packets are PacketRefMessages into the receive block,
+// delivered intact, and the block goes back to the pool once they are processed.
+TEST(ZeroCopyRecvTest, GatewayDeliversFramesInPlace)
+{
+    MessagePool::Prepare(1000, 10, 10);
+
+    boost::asio::io_context io;
+    tcp::acceptor acceptor(io, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    auto serverSocket = std::make_shared<tcp::socket>(io);
+    tcp::socket client(io);
+    client.connect(acceptor.local_endpoint());
+    acceptor.accept(*serverSocket);
+
+    auto handler = std::make_shared<RecordingHandler>();
+    DispatcherImpl dispatcher(handler);
+    const size_t baseline = RecvBuffer::GetAttachedBlockCount();
+
+    auto *session = new GatewaySession();
+    session->Reset(serverSocket, 1, &dispatcher);
+    session->SetZeroCopyRecv(true);
+    session->OnConnect();
+
+    std::vector<uint8_t> stream;
+    for (uint16_t id = 1; id <= 32; ++id)
+    {
+        std::vector<uint8_t> frame = MakeFrame(id, 64 + id * 8);
+        stream.insert(stream.end(), frame.begin(), frame.end());
+    }
+    boost::asio::write(client, boost::asio::buffer(stream));
+    ASSERT_TRUE(PollUntil(io, [&]() { return dispatcher.GetQueueSize() >= 33; })); // Connect + 32 frames
+
+    while (dispatcher.Process())
+    {
+    }
+    ASSERT_EQ(handler->ids.size(), 32u);
+    for (uint16_t id = 1; id <= 32; ++id)
+        EXPECT_EQ(handler->ids[id - 1], id);
+    EXPECT_TRUE(handler->allIntact);
+
+    session->Close();
+    io.poll();
+    while (dispatcher.Process())
+    {
+    }
+    EXPECT_EQ(RecvBuffer::GetAttachedBlockCount(), baseline);
+}
+
+// A shared block holds MaxFrameSize (< 65535) bytes: the largest frame that fits is delivered in place,
+// a 65535-byte frame closes the session instead of filling the block and spinning on zero-length reads.
+TEST(ZeroCopyRecvTest, GatewayRejectsFrameLargerThanSharedBlock)
+{
+    MessagePool::Prepare(1000, 10, 10);
+
+    boost::asio::io_context io;
+    tcp::acceptor acceptor(io, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    auto serverSocket = std::make_shared<tcp::socket>(io);
+    tcp::socket client(io);
+    client.connect(acceptor.local_endpoint());
+    acceptor.accept(*serverSocket);
+
+    auto handler = std::make_shared<RecordingHandler>();
+    DispatcherImpl dispatcher(handler);
+    const size_t baseline = RecvBuffer::GetAttachedBlockCount();
+
+    auto *session = new GatewaySession();
+    session->Reset(serverSocket, 1, &dispatcher);
+    session->SetZeroCopyRecv(true);
+    session->OnConnect();
+
+    RecvBuffer shared;
+    shared.SetShared(true);
+    const uint16_t maxFrame = static_cast<uint16_t>(shared.MaxFrameSize());
+    ASSERT_LT(maxFrame, 65535);
+
+    std::vector<uint8_t> largest = MakeFrame(7, maxFrame - sizeof(PacketHeader));
+    boost::asio::write(client, boost::asio::buffer(largest));
+    ASSERT_TRUE(PollUntil(io, [&]() { return dispatcher.GetQueueSize() >= 2; })); // Connect + frame
+    while (dispatcher.Process())
+    {
+    }
+    ASSERT_EQ(handler->ids.size(), 1u);
+    EXPECT_EQ(handler->ids[0], 7);
+    EXPECT_TRUE(handler->allIntact);
+
+    std::vector<uint8_t> oversized = MakeFrame(8, 65535 - sizeof(PacketHeader));
+    boost::asio::write(client, boost::asio::buffer(oversized));
+    ASSERT_TRUE(PollUntil(io, [&]() { return !session->IsConnected(); }));
+
+    io.poll();
+    while (dispatcher.Process())
+    {
+    }
+    EXPECT_EQ(handler->ids.size(), 1u);
+    EXPECT_EQ(RecvBuffer::GetAttachedBlockCount(), baseline);
+}